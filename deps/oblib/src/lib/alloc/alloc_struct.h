@@ -139,6 +139,7 @@ struct AChunk {
   static constexpr int MAX_BLOCKS_CNT = 256;
   OB_INLINE AChunk();
   OB_INLINE bool is_valid() const;
+  OB_INLINE bool is_huge_page() const { return is_hugetlb_ || is_thp_; }
   OB_INLINE uint64_t hold(uint64_t *payload=nullptr) const;
   OB_INLINE uint64_t aligned();
   OB_INLINE static uint64_t calc_hold(int64_t size, int64_t washed_size=0, uint64_t *payload=nullptr);
@@ -163,6 +164,7 @@ struct AChunk {
     struct {
       struct {
         uint8_t is_hugetlb_ : 1;
+        uint8_t is_thp_ : 1; // advised to be backed by transparent huge pages
       };
     };
   };
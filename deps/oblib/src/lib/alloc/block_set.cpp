@@ -399,9 +399,16 @@ int64_t BlockSet::sync_wash(int64_t wash_size)
       do {
         block = next;
         AChunk *chunk = block->chunk();
+        if (chunk->is_thp_) {
+          // the whole chunk falls back to normal pages, the washed range can't be collapsed again
+          tallocator_->unadvise_huge_page(chunk);
+        }
         if (chunk->is_hugetlb_) {
           _OB_LOG(DEBUG, "cannot be applied to Huge TLB pages");
           has_ignore = true;
+        } else if (chunk->is_thp_) {
+          _OB_LOG(DEBUG, "cannot stop using transparent huge pages");
+          has_ignore = true;
         } else {
         #if MEMCHK_LEVEL >= 1
           abort_unless(!block->in_use_ && !block->is_washed_);
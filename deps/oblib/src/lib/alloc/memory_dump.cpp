@@ -13,6 +13,7 @@
 #define USING_LOG_PREFIX COMMON
 
 #include "lib/alloc/memory_dump.h"
+#include "lib/alloc/object_mgr.h"
 #include <setjmp.h>
 #include "lib/signal/ob_signal_struct.h"
 #include "lib/rc/context.h"
@@ -181,12 +182,17 @@ void ObMemoryDump::run1()
   int ret = OB_SUCCESS;
   lib::set_thread_name("MemoryDump");
   static int64_t last_dump_ts = ObTimeUtility::current_time();
+  int64_t last_flush_ts = last_dump_ts;
   while (!has_set_stop()) {
     void *task = NULL;
     if (OB_SUCC(queue_.pop(task, 100 * 1000))) {
       handle(task);
     } else if (OB_ENTRY_NOT_EXIST == ret) {
       int64_t current_ts = ObTimeUtility::current_time();
+      if (current_ts - last_flush_ts > lib::ObjectThreadCache::FLUSH_INTERVAL) {
+        lib::ObjectThreadCache::flush_idle();
+        last_flush_ts = current_ts;
+      }
       if (current_ts - last_dump_ts > STAT_LABEL_INTERVAL) {
         auto *task = alloc_task();
         if (OB_ISNULL(task)) {
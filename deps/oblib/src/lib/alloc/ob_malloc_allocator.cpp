@@ -45,6 +45,7 @@ ObMallocAllocator::ObMallocAllocator() : locks_(), allocators_(), reserved_(0),
 ObMallocAllocator::~ObMallocAllocator()
 {
   is_inited_ = false;
+  ObjectThreadCache::set_allocator_destroyed();
 }
 
 void *ObMallocAllocator::alloc(const int64_t size)
@@ -161,7 +162,15 @@ void ObMallocAllocator::free(void *ptr)
     abort_unless(block->obj_set_ != NULL);
 
     ObjectSet *set = block->obj_set_;
-    set->free_object(obj);
+    ObjectMgr *obj_mgr = NULL;
+    if (ObjectMgr::is_thread_cache_enabled() || ObjectThreadCache::get_thread_hold() > 0) {
+      obj_mgr = ObjectMgr::get_owner(set);
+    }
+    if (NULL != obj_mgr) {
+      obj_mgr->free_object(obj);
+    } else {
+      set->free_object(obj);
+    }
   }
 #endif // PERF_MODE
 }
@@ -386,7 +395,7 @@ void ObMallocAllocator::print_tenant_memory_usage(uint64_t tenant_id) const
         buf[std::min(ctx_pos, BUFLEN - 1)] = '\0';
 
         _LOG_INFO("[MEMORY] tenant: %lu, limit: %'lu hold: %'lu rpc_hold: %'lu cache_hold: %'lu "
-                  "cache_used: %'lu cache_item_count: %'lu \n%s",
+                  "cache_used: %'lu cache_item_count: %'lu huge_page_advised_hold: %'lu \n%s",
             tenant_id,
             mgr->get_limit(),
             mgr->get_sum_hold(),
@@ -394,6 +403,7 @@ void ObMallocAllocator::print_tenant_memory_usage(uint64_t tenant_id) const
             mgr->get_cache_hold(),
             mgr->get_cache_hold(),
             mgr->get_cache_item_count(),
+            mgr->get_huge_page_advised_hold(),
             buf);
       }
     }
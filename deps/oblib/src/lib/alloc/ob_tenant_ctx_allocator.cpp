@@ -310,6 +310,15 @@ void ObTenantCtxAllocator::free_chunk(AChunk *chunk, const ObMemAttr &attr)
   }
 }
 
+void ObTenantCtxAllocator::unadvise_huge_page(AChunk *chunk)
+{
+  if (!resource_handle_.is_valid()) {
+    LIB_LOG(ERROR, "resource_handle is invalid", K_(tenant_id), K_(ctx_id));
+  } else {
+    resource_handle_.get_memory_mgr()->unadvise_huge_page(chunk);
+  }
+}
+
 bool ObTenantCtxAllocator::update_hold(const int64_t size)
 {
   bool update = false;
@@ -431,6 +440,8 @@ int64_t ObTenantCtxAllocator::sync_wash(int64_t wash_size)
 {
   int64_t washed_size = 0;
 
+  // objects cached by threads count as used, return them before judging the utilization
+  obj_mgr_.flush_thread_caches();
   auto stat = obj_mgr_.get_stat();
   const double min_utilization = 0.9;
   if (stat.payload_ * min_utilization > stat.used_) {
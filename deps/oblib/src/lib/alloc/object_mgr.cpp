@@ -17,6 +17,191 @@
 using namespace oceanbase;
 using namespace lib;
 
+thread_local ObjectThreadCache *ObjectThreadCache::thread_cache_ = NULL;
+thread_local bool ObjectThreadCache::thread_destroyed_ = false;
+int ObjectThreadCache::registry_lock_ = 0;
+ObjectThreadCache *ObjectThreadCache::registry_head_ = NULL;
+bool ObjectThreadCache::allocator_destroyed_ = false;
+bool ObjectMgr::thread_cache_enabled_ = false;
+
+ObjectThreadCache::ObjectThreadCache()
+  : prev_(NULL), next_(NULL), lock_(0), hold_(0), ops_(0),
+    last_flush_ts_(common::ObTimeUtility::fast_current_time()), victim_(0)
+{
+  MEMSET(slots_, 0, sizeof(slots_));
+  registry_lock();
+  next_ = registry_head_;
+  if (NULL != next_) {
+    next_->prev_ = this;
+  }
+  registry_head_ = this;
+  registry_unlock();
+  thread_cache_ = this;
+}
+
+ObjectThreadCache::~ObjectThreadCache()
+{
+  thread_cache_ = NULL;
+  thread_destroyed_ = true;
+  registry_lock();
+  if (NULL != prev_) {
+    prev_->next_ = next_;
+  } else {
+    registry_head_ = next_;
+  }
+  if (NULL != next_) {
+    next_->prev_ = prev_;
+  }
+  registry_unlock();
+  if (!ATOMIC_LOAD(&allocator_destroyed_)) {
+    flush();
+  }
+}
+
+ObjectThreadCache &ObjectThreadCache::get_instance()
+{
+  static thread_local ObjectThreadCache cache;
+  return cache;
+}
+
+AObject *ObjectThreadCache::pop(ObjectMgr &mgr, const uint32_t cells, const ObMemAttr &attr)
+{
+  AObject *obj = NULL;
+  if (OB_LIKELY(trylock())) {
+    for (int64_t i = 0; NULL == obj && i < MAX_SLOT_CNT; ++i) {
+      Slot &slot = slots_[i];
+      if (&mgr == slot.owner_ && NULL != slot.lists_[cells]) {
+        obj = slot.lists_[cells];
+        slot.lists_[cells] = obj->next_;
+        slot.cnts_[cells]--;
+        ATOMIC_STORE(&hold_, hold_ - cells * AOBJECT_CELL_BYTES);
+      }
+    }
+    unlock();
+  }
+  if (NULL != obj) {
+    if (attr.label_.str_ != nullptr) {
+      STRNCPY(&obj->label_[0], attr.label_.str_, sizeof(obj->label_));
+      obj->label_[sizeof(obj->label_) - 1] = '\0';
+    } else {
+      obj->label_[0] = '\0';
+    }
+  }
+  return obj;
+}
+
+bool ObjectThreadCache::push(ObjectMgr &mgr, AObject *obj)
+{
+  bool cached = false;
+  const uint32_t cells = obj->nobjs_;
+  if (obj->is_large_ || cells > MAX_CELLS
+      || obj->alloc_bytes_ != capacity_of(cells)
+      || !mgr.is_own_set(obj->block()->obj_set_)) {
+    // not allocated for the cache
+  } else if (OB_UNLIKELY(!trylock())) {
+    // being drained by another thread, or freed by the flush of this thread
+  } else {
+    if (OB_UNLIKELY(++ops_ >= FLUSH_CHECK_OPS)) {
+      ops_ = 0;
+      const int64_t now = common::ObTimeUtility::fast_current_time();
+      if (now - last_flush_ts_ >= FLUSH_INTERVAL) {
+        do_flush(NULL);
+        ATOMIC_STORE(&last_flush_ts_, now);
+      }
+    } else if (hold_ + cells * AOBJECT_CELL_BYTES > MAX_HOLD) {
+      // full
+    } else {
+      abort_unless(AOBJECT_TAIL_MAGIC_CODE == reinterpret_cast<uint64_t&>(obj->data_[obj->alloc_bytes_]));
+      Slot *slot = NULL;
+      Slot *empty_slot = NULL;
+      for (int64_t i = 0; NULL == slot && i < MAX_SLOT_CNT; ++i) {
+        if (&mgr == slots_[i].owner_) {
+          slot = &slots_[i];
+        } else if (NULL == empty_slot && NULL == slots_[i].owner_) {
+          empty_slot = &slots_[i];
+        }
+      }
+      if (NULL == slot) {
+        if (NULL == empty_slot) {
+          empty_slot = &slots_[victim_++ % MAX_SLOT_CNT];
+          flush_slot(*empty_slot);
+        }
+        slot = empty_slot;
+        slot->owner_ = &mgr;
+      }
+      if (slot->cnts_[cells] < MAX_OBJECT_CNT_PER_CELLS) {
+        obj->next_ = slot->lists_[cells];
+        slot->lists_[cells] = obj;
+        slot->cnts_[cells]++;
+        ATOMIC_STORE(&hold_, hold_ + cells * AOBJECT_CELL_BYTES);
+        cached = true;
+      }
+    }
+    unlock();
+  }
+  return cached;
+}
+
+void ObjectThreadCache::flush(ObjectMgr *mgr)
+{
+  lock();
+  do_flush(mgr);
+  unlock();
+}
+
+void ObjectThreadCache::flush_all(ObjectMgr *mgr)
+{
+  registry_lock();
+  for (ObjectThreadCache *cache = registry_head_; NULL != cache; cache = cache->next_) {
+    if (cache->get_hold() > 0) {
+      cache->flush(mgr);
+    }
+  }
+  registry_unlock();
+}
+
+void ObjectThreadCache::flush_idle()
+{
+  const int64_t now = common::ObTimeUtility::fast_current_time();
+  registry_lock();
+  for (ObjectThreadCache *cache = registry_head_; NULL != cache; cache = cache->next_) {
+    if (cache->get_hold() > 0 && now - ATOMIC_LOAD(&cache->last_flush_ts_) >= FLUSH_INTERVAL) {
+      cache->lock();
+      cache->do_flush(NULL);
+      ATOMIC_STORE(&cache->last_flush_ts_, now);
+      cache->unlock();
+    }
+  }
+  registry_unlock();
+}
+
+void ObjectThreadCache::do_flush(ObjectMgr *mgr)
+{
+  for (int64_t i = 0; i < MAX_SLOT_CNT; ++i) {
+    if (NULL == mgr || mgr == slots_[i].owner_) {
+      flush_slot(slots_[i]);
+    }
+  }
+}
+
+void ObjectThreadCache::flush_slot(Slot &slot)
+{
+  if (NULL != slot.owner_) {
+    for (uint32_t cells = 0; cells <= MAX_CELLS; ++cells) {
+      AObject *obj = slot.lists_[cells];
+      while (NULL != obj) {
+        AObject *next = obj->next_;
+        obj->block()->obj_set_->free_object(obj);
+        ATOMIC_STORE(&hold_, hold_ - cells * AOBJECT_CELL_BYTES);
+        obj = next;
+      }
+      slot.lists_[cells] = NULL;
+      slot.cnts_[cells] = 0;
+    }
+    slot.owner_ = NULL;
+  }
+}
+
 SubObjectMgr::SubObjectMgr(const bool for_logger)
   : mutex_(common::ObLatchIds::ALLOC_OBJECT_LOCK),
     normal_locker_(mutex_), logger_locker_(mutex_),
@@ -63,9 +248,12 @@ ObjectMgr::ObjectMgr(ObTenantCtxAllocator &allocator, uint64_t tenant_id, uint64
   : ta_(allocator), attr_(tenant_id, nullptr, ctx_id),
     sub_cnt_(1),
     root_mgr_(common::ObCtxIds::LOGGER_CTX_ID == attr_.ctx_id_),
-    last_wash_ts_(0), last_washed_size_(0)
+    last_wash_ts_(0), last_washed_size_(0),
+    use_thread_cache_(common::ObCtxIds::LOGGER_CTX_ID != attr_.ctx_id_
+                      && common::ObCtxIds::LIBEASY != attr_.ctx_id_)
 {
   root_mgr_.set_tenant_ctx_allocator(allocator, attr_);
+  root_mgr_.os_.set_obj_mgr(this);
   MEMSET(sub_mgrs_, 0, sizeof(sub_mgrs_));
   sub_mgrs_[0] = &root_mgr_;
 }
@@ -76,6 +264,8 @@ ObjectMgr::~ObjectMgr()
 }
 
 void ObjectMgr::reset() {
+  // cached objects of this mgr may stay in any thread
+  flush_thread_caches();
   for (int i = 1; i < ATOMIC_LOAD(&sub_cnt_); i++) {
     if (sub_mgrs_[i] != nullptr) {
       destroy_sub_mgr(sub_mgrs_[i]);
@@ -88,6 +278,16 @@ void ObjectMgr::reset() {
 AObject *ObjectMgr::alloc_object(uint64_t size, const ObMemAttr &attr)
 {
   AObject *obj = NULL;
+#ifndef ENABLE_SANITY
+  uint32_t cells = 0;
+  if (use_thread_cache_ && is_thread_cache_enabled()
+      && !ObjectThreadCache::is_thread_destroyed()
+      && 0 != (cells = ObjectThreadCache::cells_of(size))) {
+    // allocate the full capacity, so that the object can be reused by any size of its cells
+    size = ObjectThreadCache::capacity_of(cells);
+    obj = ObjectThreadCache::get_instance().pop(*this, cells, attr);
+  }
+#endif
   const uint64_t start = common::get_itid();
   SubObjectMgr *sub_mgr = nullptr;
   for (uint64_t i = 0; NULL == obj && i < ATOMIC_LOAD(&sub_cnt_); i++) {
@@ -159,10 +359,40 @@ void ObjectMgr::free_object(AObject *obj)
   abort_unless(block->obj_set_ != NULL);
 
   ObjectSet *set = block->obj_set_;
-  set->free_object(obj);
+  bool cached = false;
+#ifndef ENABLE_SANITY
+  if (!is_thread_cache_enabled()) {
+    if (OB_UNLIKELY(ObjectThreadCache::get_thread_hold() > 0)) {
+      // disabled after objects were cached
+      ObjectThreadCache::get_instance().flush();
+    }
+  } else if (use_thread_cache_ && !ObjectThreadCache::is_thread_destroyed()) {
+    cached = ObjectThreadCache::get_instance().push(*this, obj);
+  }
+#endif
+  if (!cached) {
+    set->free_object(obj);
+  }
   // TODO by fengshuo.fs: when object_set is empty, try free the sub_mgr of it.
 }
 
+void ObjectMgr::flush_thread_caches()
+{
+  if (use_thread_cache_) {
+    ObjectThreadCache::flush_all(this);
+  }
+}
+
+ObjectMgr *ObjectMgr::get_owner(ObjectSet *set)
+{
+  return set->get_obj_mgr();
+}
+
+bool ObjectMgr::is_own_set(ObjectSet *set) const
+{
+  return set->get_obj_mgr() == this;
+}
+
 ABlock *ObjectMgr::alloc_block(uint64_t size, const ObMemAttr &attr)
 {
   ABlock *block = NULL;
@@ -230,6 +460,7 @@ SubObjectMgr *ObjectMgr::create_sub_mgr()
     SANITY_UNPOISON(obj->data_, obj->alloc_bytes_);
     sub_mgr = new (obj->data_) SubObjectMgr(common::ObCtxIds::LOGGER_CTX_ID == attr_.ctx_id_);
     sub_mgr->set_tenant_ctx_allocator(ta_, attr_);
+    sub_mgr->os_.set_obj_mgr(this);
   }
   return sub_mgr;
 }
@@ -251,6 +482,8 @@ void ObjectMgr::destroy_sub_mgr(SubObjectMgr *sub_mgr)
 int64_t ObjectMgr::sync_wash(int64_t wash_size)
 {
   int64_t washed_size = 0;
+  // cached objects pin their blocks
+  flush_thread_caches();
   const uint64_t start = common::get_itid();
   for (uint64_t i = 0; washed_size < wash_size && i < ATOMIC_LOAD(&sub_cnt_); i++) {
     uint64_t idx = (start + i) % sub_cnt_;
@@ -35,6 +35,7 @@ namespace lib
 class SubObjectMgr : public IBlockMgr
 {
   friend class ObTenantCtxAllocator;
+  friend class ObjectMgr;
 public:
   SubObjectMgr(const bool for_logger);
   virtual ~SubObjectMgr() {}
@@ -76,8 +77,93 @@ private:
   ObjectSet os_;
 };
 
+class ObjectMgr;
+// Per-thread cache of small objects freed to ObjectMgr, so that most alloc/free pairs of
+// short requests skip the sub mgr selection and its lock.
+//
+// Objects are cached by their cells and stay in use from the view of their ObjectSet, so
+// hold is always exact and used/label statistics are exact at flush granularity. Objects
+// that may be cached are allocated with the full capacity of their cells, the capacity
+// never changes on reuse and their ObjectSet needs no update. A thread caches objects of
+// up to MAX_SLOT_CNT ObjectMgrs and at most MAX_HOLD bytes, everything is flushed back
+// every FLUSH_INTERVAL and when the thread exits. Caches are registered globally, so that
+// sync_wash and the destruction of an ObjectMgr drain the caches of all threads, and
+// flush_idle drains the caches not flushed for FLUSH_INTERVAL. The owner thread only
+// trylocks its cache and bypasses it while being drained, or once its cache is destroyed
+// by the thread exit.
+class ObjectThreadCache
+{
+public:
+  static const uint64_t MAX_OBJECT_SIZE = 1024;
+  static const uint32_t MAX_CELLS = (MAX_OBJECT_SIZE + AOBJECT_META_SIZE) / AOBJECT_CELL_BYTES + 2;
+  static const int64_t MAX_SLOT_CNT = 4;
+  static const int64_t MAX_OBJECT_CNT_PER_CELLS = 64;
+  static const int64_t MAX_HOLD = 256L << 10;
+  static const int64_t FLUSH_CHECK_OPS = 1L << 14;
+  static const int64_t FLUSH_INTERVAL = 1000L * 1000L; // 1s
+  struct Slot
+  {
+    ObjectMgr *owner_;
+    AObject *lists_[MAX_CELLS + 1];
+    uint16_t cnts_[MAX_CELLS + 1];
+  };
+public:
+  ObjectThreadCache();
+  ~ObjectThreadCache();
+  static ObjectThreadCache &get_instance();
+  // thread local destructors running after the cache's one must not recreate it
+  static bool is_thread_destroyed() { return thread_destroyed_; }
+  static int64_t get_thread_hold() { return NULL == thread_cache_ ? 0 : thread_cache_->get_hold(); }
+  int64_t get_hold() const { return ATOMIC_LOAD(&hold_); }
+  // cells of objects to allocate for @size, 0 if not cacheable
+  static OB_INLINE uint32_t cells_of(const uint64_t size)
+  {
+    return size > 0 && size <= MAX_OBJECT_SIZE ?
+        static_cast<uint32_t>(align_up2(MAX(size, MIN_AOBJECT_SIZE) + AOBJECT_META_SIZE, 16) / AOBJECT_CELL_BYTES) : 0;
+  }
+  static OB_INLINE uint64_t capacity_of(const uint32_t cells)
+  {
+    return cells * AOBJECT_CELL_BYTES - AOBJECT_META_SIZE;
+  }
+  AObject *pop(ObjectMgr &mgr, const uint32_t cells, const ObMemAttr &attr);
+  bool push(ObjectMgr &mgr, AObject *obj);
+  // flush the objects of @mgr, or of all ObjectMgrs if NULL
+  void flush(ObjectMgr *mgr = NULL);
+  // flush the caches of all threads
+  static void flush_all(ObjectMgr *mgr = NULL);
+  // flush the caches of all threads that have not been flushed for FLUSH_INTERVAL,
+  // threads that stop freeing objects never reach their own periodic flush
+  static void flush_idle();
+  // objects can't be freed once the allocators are gone, the exit flush is skipped then
+  static void set_allocator_destroyed() { ATOMIC_STORE(&allocator_destroyed_, true); }
+private:
+  OB_INLINE bool trylock() { return ATOMIC_BCAS(&lock_, 0, 1); }
+  OB_INLINE void lock() { while (!trylock()) { sched_yield(); } }
+  OB_INLINE void unlock() { ATOMIC_STORE(&lock_, 0); }
+  void do_flush(ObjectMgr *mgr);
+  void flush_slot(Slot &slot);
+  static void registry_lock() { while (!ATOMIC_BCAS(&registry_lock_, 0, 1)) { sched_yield(); } }
+  static void registry_unlock() { ATOMIC_STORE(&registry_lock_, 0); }
+private:
+  static thread_local ObjectThreadCache *thread_cache_;
+  static thread_local bool thread_destroyed_;
+  static int registry_lock_;
+  static ObjectThreadCache *registry_head_;
+  static bool allocator_destroyed_;
+  ObjectThreadCache *prev_;
+  ObjectThreadCache *next_;
+  int lock_;
+  int64_t hold_;
+  int64_t ops_;
+  int64_t last_flush_ts_;
+  int64_t victim_;
+  Slot slots_[MAX_SLOT_CNT];
+  DISALLOW_COPY_AND_ASSIGN(ObjectThreadCache);
+};
+
 class ObjectMgr : public IBlockMgr
 {
+  friend class ObjectThreadCache;
   static const int N = 32;
 public:
   struct Stat
@@ -97,6 +183,12 @@ public:
   AObject *realloc_object(
       AObject *obj, const uint64_t size, const ObMemAttr &attr);
   void free_object(AObject *obj);
+  // return the objects of this mgr cached by all threads
+  void flush_thread_caches();
+  // ObjectMgr owning @set, NULL if @set doesn't belong to any sub mgr
+  static ObjectMgr *get_owner(ObjectSet *set);
+  static void set_thread_cache_enabled(const bool enabled) { ATOMIC_STORE(&thread_cache_enabled_, enabled); }
+  static bool is_thread_cache_enabled() { return ATOMIC_LOAD(&thread_cache_enabled_); }
 
   ABlock *alloc_block(uint64_t size, const ObMemAttr &attr) override;
   void free_block(ABlock *block) override;
@@ -111,6 +203,8 @@ public:
 private:
   SubObjectMgr *create_sub_mgr();
   void destroy_sub_mgr(SubObjectMgr *sub_mgr);
+  bool is_own_set(ObjectSet *set) const;
+  static bool thread_cache_enabled_;
 
 public:
   ObTenantCtxAllocator &ta_;
@@ -120,6 +214,7 @@ public:
   SubObjectMgr *sub_mgrs_[N];
   int64_t last_wash_ts_;
   int64_t last_washed_size_;
+  const bool use_thread_cache_;
 }; // end of class ObjectMgr
 
 } // end of namespace lib
@@ -10,12 +10,15 @@
  * See the Mulan PubL v2 for more details.
  */
 
+#define USING_LOG_PREFIX LIB
 #include "lib/cpu/ob_cpu_topology.h"
 
 #include <stdio.h>
 #include <string.h>
 #include <pthread.h>
+#include <sched.h>
 #include "lib/ob_define.h"
+#include "lib/oblog/ob_log.h"
 
 using namespace oceanbase::common;
 
@@ -26,6 +29,152 @@ int64_t __attribute__((weak)) get_cpu_count()
 {
   return get_cpu_num();
 }
+
+// from linux/mempolicy.h, numaif.h is not always installed
+static const int OB_MPOL_DEFAULT = 0;
+static const int OB_MPOL_PREFERRED = 1;
+
+ObNumaTopology::ObNumaTopology()
+  : is_inited_(false),
+    node_cnt_(0)
+{
+  int ret = OB_SUCCESS;
+  if (OB_FAIL(init())) {
+    LOG_WARN("init numa topology failed, treat the machine as one node", K(ret));
+  }
+}
+
+ObNumaTopology &ObNumaTopology::get_instance()
+{
+  static ObNumaTopology instance;
+  return instance;
+}
+
+int ObNumaTopology::init()
+{
+  int ret = OB_SUCCESS;
+  char path[64];
+  char buf[4096];
+  node_cnt_ = 0;
+  // the cpus the process may run on, e.g. limited by taskset or a cgroup cpuset,
+  // nodes only keep these cpus and INVALID_NODE restores them
+  CPU_ZERO(&process_cpus_);
+  if (0 != sched_getaffinity(0, sizeof(process_cpus_), &process_cpus_)) {
+    LOG_WARN("get process affinity failed, use all cpus", K(errno));
+    for (int64_t cpu = 0; cpu < get_cpu_num() && cpu < CPU_SETSIZE; ++cpu) {
+      CPU_SET(cpu, &process_cpus_);
+    }
+  }
+  for (int64_t node = 0; OB_SUCC(ret) && node < MAX_NODE_CNT; ++node) {
+    snprintf(path, sizeof(path), "/sys/devices/system/node/node%ld/cpulist", node);
+    FILE *file = fopen(path, "r");
+    if (NULL == file) {
+      break;
+    } else {
+      if (NULL == fgets(buf, sizeof(buf), file)) {
+        ret = OB_IO_ERROR;
+        LOG_WARN("read cpulist failed", K(ret), K(path));
+      } else if (OB_FAIL(parse_cpu_list(buf, node_cpus_[node]))) {
+        LOG_WARN("parse cpulist failed", K(ret), K(path), K(buf));
+      } else {
+        CPU_AND(&node_cpus_[node], &node_cpus_[node], &process_cpus_);
+        ++node_cnt_;
+      }
+      fclose(file);
+    }
+  }
+  if (OB_FAIL(ret) || 0 == node_cnt_) {
+    node_cnt_ = 1;
+    node_cpus_[0] = process_cpus_;
+  }
+  is_inited_ = true;
+  LOG_INFO("init numa topology", K(ret), K_(node_cnt), "process_cpu_cnt", CPU_COUNT(&process_cpus_));
+  return ret;
+}
+
+int64_t ObNumaTopology::get_node_cpu_cnt(const int64_t node) const
+{
+  int64_t cnt = 0;
+  if (node >= 0 && node < node_cnt_) {
+    cnt = CPU_COUNT(&node_cpus_[node]);
+  }
+  return cnt;
+}
+
+int ObNumaTopology::bind_self_to_node(const int64_t node) const
+{
+  int ret = OB_SUCCESS;
+  cpu_set_t cpu_set;
+  unsigned long node_mask = 0;
+  int mode = OB_MPOL_DEFAULT;
+  if (!is_inited_) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("numa topology not init", K(ret));
+  } else if (INVALID_NODE == node) {
+    cpu_set = process_cpus_;
+  } else if (node < 0 || node >= node_cnt_) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid numa node", K(ret), K(node), K_(node_cnt));
+  } else {
+    cpu_set = node_cpus_[node];
+    node_mask = 1UL << node;
+    mode = OB_MPOL_PREFERRED;
+  }
+  if (OB_FAIL(ret)) {
+  } else if (0 != pthread_setaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set)) {
+    ret = OB_ERR_SYS;
+    LOG_WARN("set thread affinity failed", K(ret), K(node), K(errno));
+  } else if (node_cnt_ > 1
+             && 0 != syscall(SYS_set_mempolicy, mode,
+                             OB_MPOL_DEFAULT == mode ? NULL : &node_mask,
+                             OB_MPOL_DEFAULT == mode ? 0 : sizeof(node_mask) * 8)) {
+    // the affinity is kept, pages are still mostly local by first touch
+    ret = OB_ERR_SYS;
+    LOG_WARN("set memory policy failed", K(ret), K(node), K(errno));
+  }
+  return ret;
+}
+
+int ObNumaTopology::parse_cpu_list(const char *str, cpu_set_t &cpu_set)
+{
+  int ret = OB_SUCCESS;
+  CPU_ZERO(&cpu_set);
+  if (OB_ISNULL(str)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid argument", K(ret));
+  }
+  const char *p = str;
+  while (OB_SUCC(ret) && NULL != p && '\0' != *p && '\n' != *p) {
+    char *end = NULL;
+    const long begin_cpu = strtol(p, &end, 10);
+    long end_cpu = begin_cpu;
+    if (end == p || begin_cpu < 0) {
+      ret = OB_INVALID_ARGUMENT;
+    } else if ('-' == *end) {
+      p = end + 1;
+      end_cpu = strtol(p, &end, 10);
+      if (end == p || end_cpu < begin_cpu) {
+        ret = OB_INVALID_ARGUMENT;
+      }
+    }
+    if (OB_SUCC(ret)) {
+      for (long cpu = begin_cpu; cpu <= end_cpu && cpu < CPU_SETSIZE; ++cpu) {
+        CPU_SET(cpu, &cpu_set);
+      }
+      if (',' == *end) {
+        p = end + 1;
+      } else if ('\0' == *end || '\n' == *end) {
+        p = end;
+      } else {
+        ret = OB_INVALID_ARGUMENT;
+      }
+    }
+  }
+  if (OB_FAIL(ret)) {
+    LOG_WARN("invalid cpu list", K(ret), K(str));
+  }
+  return ret;
+}
 } // common
 } // oceanbase
 
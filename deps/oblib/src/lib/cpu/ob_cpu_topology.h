@@ -14,6 +14,7 @@
 #define OCEANBASE_LIB_OB_CPU_TOPOLOGY_
 
 #include <stdint.h>
+#include <sched.h>
 #include "lib/utility/ob_macro_utils.h"
 #include "lib/utility/utility.h"
 
@@ -22,6 +23,36 @@ namespace oceanbase
 namespace common
 {
 int64_t get_cpu_count();
+
+// NUMA nodes of the machine, read from /sys/devices/system/node once at startup.
+// Each node only keeps the cpus of the process affinity seen at that time.
+// On machines without NUMA, or when sysfs is unavailable, there is a single node 0
+// holding all cpus of the process.
+class ObNumaTopology
+{
+public:
+  static const int64_t MAX_NODE_CNT = 64;
+  static const int64_t INVALID_NODE = -1;
+
+  static ObNumaTopology &get_instance();
+  int64_t get_node_cnt() const { return node_cnt_; }
+  int64_t get_node_cpu_cnt(const int64_t node) const;
+  // Bind the calling thread to the cpus of @node and prefer allocating its pages from
+  // @node. INVALID_NODE restores the default: the process affinity saved at init and
+  // the default memory policy.
+  int bind_self_to_node(const int64_t node) const;
+  // parse cpu list like "0-3,8,10-11"
+  static int parse_cpu_list(const char *str, cpu_set_t &cpu_set);
+private:
+  ObNumaTopology();
+  int init();
+private:
+  bool is_inited_;
+  int64_t node_cnt_;
+  cpu_set_t process_cpus_;
+  cpu_set_t node_cpus_[MAX_NODE_CNT];
+  DISALLOW_COPY_AND_ASSIGN(ObNumaTopology);
+};
 } // namespace common
 } // namespace oceanbase
 
@@ -14,7 +14,9 @@
 #define OCEANBASE_QUEUE_OB_PRIORITY_QUEUE_
 
 #include "lib/queue/ob_link_queue.h"
+#include "lib/queue/ob_ring_queue.h"
 #include "lib/lock/ob_scond.h"
+#include "lib/allocator/ob_malloc.h"
 
 namespace oceanbase
 {
@@ -101,7 +103,8 @@ private:
   DISALLOW_COPY_AND_ASSIGN(ObPriorityQueue);
 };
 
-template <int HIGH_HIGH_PRIOS, int HIGH_PRIOS=0, int LOW_PRIOS=0>
+// @RING_CAPACITY: elements of each priority served by the ring before spilling to a link queue
+template <int HIGH_HIGH_PRIOS, int HIGH_PRIOS, int LOW_PRIOS, int64_t RING_CAPACITY>
 class ObPriorityQueue2
 {
 public:
@@ -198,11 +201,195 @@ private:
   }
 
   SCondTemp<3> cond_;
-  ObLinkQueue queue_[PRIO_CNT];
+  ObLinkRingQueue<RING_CAPACITY> queue_[PRIO_CNT];
   int64_t size_ CACHE_ALIGNED;
   int64_t limit_ CACHE_ALIGNED;
   DISALLOW_COPY_AND_ASSIGN(ObPriorityQueue2);
 };
+
+// Same priorities and pop semantics as ObPriorityQueue2, but the link queues and the size
+// counter are split into shards, so that network threads pushing and workers popping on a
+// many-core host do not bounce the same cache lines. A request is pushed to the shard of the
+// cpu the pusher runs on; a worker pops from the shard of its own cpu first and steals from
+// the other shards when it is empty. Priorities hold across shards: a request of higher
+// priority in any shard is popped before the lower priorities of the local shard.
+template <int HIGH_HIGH_PRIOS, int HIGH_PRIOS, int LOW_PRIOS, int64_t RING_CAPACITY>
+class ObShardedPriorityQueue2
+{
+public:
+  enum { PRIO_CNT = HIGH_HIGH_PRIOS + HIGH_PRIOS + LOW_PRIOS };
+  static const int64_t MAX_SHARD_CNT = 64;
+  // adjacent cpus share a shard, so a tenant using the first few cpus does not spread over all shards
+  static const int64_t CPU_PER_SHARD = 8;
+
+  ObShardedPriorityQueue2() : shards_(NULL), shard_cnt_(0), limit_(INT64_MAX) {}
+  ~ObShardedPriorityQueue2() { destroy(); }
+
+  int init(const int64_t shard_cnt, const ObMemAttr &attr)
+  {
+    int ret = OB_SUCCESS;
+    void *buf = NULL;
+    if (OB_UNLIKELY(NULL != shards_)) {
+      ret = OB_INIT_TWICE;
+      COMMON_LOG(WARN, "init twice", K(ret), K_(shard_cnt));
+    } else if (OB_UNLIKELY(shard_cnt <= 0 || shard_cnt > MAX_SHARD_CNT)) {
+      ret = OB_INVALID_ARGUMENT;
+      COMMON_LOG(WARN, "invalid shard count", K(ret), K(shard_cnt));
+    } else if (OB_ISNULL(buf = ob_malloc(sizeof(Shard) * shard_cnt, attr))) {
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+      COMMON_LOG(WARN, "failed to alloc queue shards", K(ret), K(shard_cnt));
+    } else {
+      shards_ = new (buf) Shard[shard_cnt];
+      shard_cnt_ = shard_cnt;
+    }
+    return ret;
+  }
+  // the queue should have been drained, requests left in it are not freed
+  void destroy()
+  {
+    if (NULL != shards_) {
+      for (int64_t i = 0; i < shard_cnt_; i++) {
+        shards_[i].~Shard();
+      }
+      ob_free(shards_);
+      shards_ = NULL;
+      shard_cnt_ = 0;
+    }
+  }
+
+  void set_limit(int64_t limit) { limit_ = limit; }
+  int64_t get_shard_cnt() const { return shard_cnt_; }
+  int64_t size() const
+  {
+    int64_t size = 0;
+    for (int64_t i = 0; i < shard_cnt_; i++) {
+      size += ATOMIC_LOAD(&shards_[i].size_);
+    }
+    return size;
+  }
+  int64_t queue_size(const int i) const
+  {
+    int64_t size = 0;
+    for (int64_t j = 0; j < shard_cnt_; j++) {
+      size += shards_[j].queue_[i].size();
+    }
+    return size;
+  }
+  int64_t to_string(char *buf, const int64_t buf_len) const
+  {
+    int64_t pos = 0;
+    common::databuff_printf(buf, buf_len, pos, "total_size=%ld shard_cnt=%ld ", size(), shard_cnt_);
+    for(int i = 0; i < PRIO_CNT; i++) {
+      common::databuff_printf(buf, buf_len, pos, "queue[%d]=%ld ", i, queue_size(i));
+    }
+    return pos;
+  }
+
+  int push(ObLink* data, int priority)
+  {
+    int ret = OB_SUCCESS;
+    Shard *shard = NULL == shards_ ? NULL : &shards_[get_home_shard()];
+    if (OB_ISNULL(shard)) {
+      ret = OB_NOT_INIT;
+    } else if (ATOMIC_FAA(&shard->size_, 1) >= limit_ / shard_cnt_ && size() - 1 > limit_) {
+      // only sum up all the shards when the local one is beyond its share of the limit
+      ret = OB_SIZE_OVERFLOW;
+    } else if (OB_UNLIKELY(NULL == data) || OB_UNLIKELY(priority < 0) || OB_UNLIKELY(priority >= PRIO_CNT)) {
+      ret = OB_INVALID_ARGUMENT;
+      COMMON_LOG(WARN, "push error, invalid argument", KP(data), K(priority));
+    } else if (OB_FAIL(shard->queue_[priority].push(data))) {
+      // do nothing
+    } else {
+      if (priority < HIGH_HIGH_PRIOS) {
+        cond_.signal(1, 0);
+      } else if (priority < HIGH_PRIOS + HIGH_HIGH_PRIOS) {
+        cond_.signal(1, 1);
+      } else {
+        cond_.signal(1, 2);
+      }
+    }
+
+    if (OB_FAIL(ret) && NULL != shard) {
+      (void)ATOMIC_FAA(&shard->size_, -1);
+    }
+    return ret;
+  }
+
+  int pop(ObLink*& data, int64_t timeout_us)
+  {
+    return do_pop(data, PRIO_CNT, timeout_us);
+  }
+
+  int pop_high(ObLink*& data, int64_t timeout_us)
+  {
+    return do_pop(data, HIGH_HIGH_PRIOS + HIGH_PRIOS, timeout_us);
+  }
+
+  int pop_high_high(ObLink*& data, int64_t timeout_us)
+  {
+    return do_pop(data, HIGH_HIGH_PRIOS, timeout_us);
+  }
+
+private:
+  struct Shard
+  {
+    Shard() : queue_(), size_(0) {}
+    ObLinkRingQueue<RING_CAPACITY> queue_[PRIO_CNT];
+    int64_t size_ CACHE_ALIGNED;
+  } CACHE_ALIGNED;
+
+  inline int64_t get_home_shard() const
+  {
+    const int64_t cpu_id = icpu_id();
+    return cpu_id < 0 ? 0 : std::min(cpu_id / CPU_PER_SHARD, shard_cnt_ - 1);
+  }
+
+  inline int do_pop(ObLink*& data, int64_t plimit, int64_t timeout_us)
+  {
+    int ret = OB_ENTRY_NOT_EXIST;
+    if (OB_UNLIKELY(timeout_us < 0)) {
+      ret = OB_INVALID_ARGUMENT;
+      COMMON_LOG(ERROR, "timeout is invalid", K(ret), K(timeout_us));
+    } else if (OB_ISNULL(shards_)) {
+      ret = OB_NOT_INIT;
+    } else {
+      if (plimit <= HIGH_HIGH_PRIOS) {
+        cond_.prepare(0);
+      } else if (plimit <= HIGH_PRIOS + HIGH_HIGH_PRIOS) {
+        cond_.prepare(1);
+      } else {
+        cond_.prepare(2);
+      }
+      const int64_t home = get_home_shard();
+      Shard *shard = NULL;
+      for (int i = 0; OB_ENTRY_NOT_EXIST == ret && i < plimit; i++) {
+        for (int64_t j = 0; OB_ENTRY_NOT_EXIST == ret && j < shard_cnt_; j++) {
+          shard = &shards_[(home + j) % shard_cnt_];
+          // size_ is increased before the push, so a shard with zero size_ holds nothing
+          if (ATOMIC_LOAD(&shard->size_) > 0 && OB_SUCCESS == shard->queue_[i].pop(data)) {
+            ret = OB_SUCCESS;
+          }
+        }
+      }
+      if (OB_FAIL(ret)) {
+        cond_.wait(timeout_us);
+        data = NULL;
+      } else {
+        (void)ATOMIC_FAA(&shard->size_, -1);
+      }
+    }
+    return ret;
+  }
+
+  SCondTemp<3> cond_;
+  Shard *shards_;
+  int64_t shard_cnt_;
+  int64_t limit_ CACHE_ALIGNED;
+  DISALLOW_COPY_AND_ASSIGN(ObShardedPriorityQueue2);
+};
+
+template <int HIGH_HIGH_PRIOS, int HIGH_PRIOS, int LOW_PRIOS, int64_t RING_CAPACITY>
+const int64_t ObShardedPriorityQueue2<HIGH_HIGH_PRIOS, HIGH_PRIOS, LOW_PRIOS, RING_CAPACITY>::MAX_SHARD_CNT;
 } // end namespace common
 } // end namespace oceanbase
 
@@ -0,0 +1,453 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#ifndef OCEANBASE_QUEUE_OB_RING_QUEUE_
+#define OCEANBASE_QUEUE_OB_RING_QUEUE_
+#include "lib/ob_define.h"
+#include "lib/atomic/ob_atomic.h"
+#include "lib/lock/ob_thread_cond.h"
+#include "lib/utility/ob_template_utils.h"
+#include "lib/queue/ob_link_queue.h"
+#include "lib/time/ob_time_utility.h"
+
+namespace oceanbase
+{
+namespace common
+{
+// Bounded ring queues of pointers. Elements are kept in an array embedded in the queue, so
+// push and pop touch one slot and one cursor instead of linking a node per element, and the
+// push and pop cursors live on separate cache lines. CAPACITY must be a power of 2.
+//
+// push returns OB_SIZE_OVERFLOW when the queue is full, pop returns OB_EAGAIN when it is
+// empty. Batch push/pop move as many elements as possible and succeed if any is moved.
+
+// One producer thread and one consumer thread at a time, no atomic read-modify-write at all.
+// Each side caches the cursor of the other side and reloads it only when the cached one says
+// the queue is full or empty.
+template <typename T, int64_t CAPACITY>
+class ObSpScRingQueue
+{
+public:
+  ObSpScRingQueue() : push_(0), push_limit_(CAPACITY), pop_(0), pop_limit_(0)
+  {
+    MEMSET(data_, 0, sizeof(data_));
+  }
+  ~ObSpScRingQueue() {}
+  int push(T *p)
+  {
+    int64_t pushed = 0;
+    return OB_UNLIKELY(NULL == p) ? OB_INVALID_ARGUMENT : push_batch(&p, 1, pushed);
+  }
+  int push_batch(T *const *ps, const int64_t cnt, int64_t &pushed)
+  {
+    int ret = OB_SUCCESS;
+    pushed = 0;
+    if (OB_UNLIKELY(NULL == ps || cnt <= 0)) {
+      ret = OB_INVALID_ARGUMENT;
+    } else {
+      const uint64_t push = push_;
+      if (push + cnt > push_limit_) {
+        push_limit_ = ATOMIC_LOAD_ACQ(&pop_) + CAPACITY;
+      }
+      pushed = MIN(cnt, static_cast<int64_t>(push_limit_ - push));
+      if (0 == pushed) {
+        ret = OB_SIZE_OVERFLOW;
+      } else {
+        for (int64_t i = 0; i < pushed; i++) {
+          data_[idx(push + i)] = ps[i];
+        }
+        ATOMIC_STORE_REL(&push_, push + pushed);
+      }
+    }
+    return ret;
+  }
+  int pop(T *&p)
+  {
+    int64_t popped = 0;
+    int ret = pop_batch(&p, 1, popped);
+    if (OB_FAIL(ret)) {
+      p = NULL;
+    }
+    return ret;
+  }
+  int pop_batch(T **ps, const int64_t cnt, int64_t &popped)
+  {
+    int ret = OB_SUCCESS;
+    popped = 0;
+    if (OB_UNLIKELY(NULL == ps || cnt <= 0)) {
+      ret = OB_INVALID_ARGUMENT;
+    } else {
+      const uint64_t pop = pop_;
+      if (pop + cnt > pop_limit_) {
+        pop_limit_ = ATOMIC_LOAD_ACQ(&push_);
+      }
+      popped = MIN(cnt, static_cast<int64_t>(pop_limit_ - pop));
+      if (0 == popped) {
+        ret = OB_EAGAIN;
+      } else {
+        for (int64_t i = 0; i < popped; i++) {
+          ps[i] = data_[idx(pop + i)];
+        }
+        ATOMIC_STORE_REL(&pop_, pop + popped);
+      }
+    }
+    return ret;
+  }
+  // called by the consumer only
+  T *top() const
+  {
+    const uint64_t pop = pop_;
+    return pop < ATOMIC_LOAD_ACQ(&push_) ? data_[idx(pop)] : NULL;
+  }
+  int64_t size() const
+  {
+    const uint64_t pop = ATOMIC_LOAD(&pop_);
+    const uint64_t push = ATOMIC_LOAD(&push_);
+    return push > pop ? static_cast<int64_t>(push - pop) : 0;
+  }
+  bool is_empty() const { return 0 == size(); }
+  static int64_t capacity() { return CAPACITY; }
+private:
+  STATIC_ASSERT(CAPACITY > 0 && 0 == (CAPACITY & (CAPACITY - 1)), "capacity should be power of 2");
+  static int64_t idx(const uint64_t x) { return static_cast<int64_t>(x & (CAPACITY - 1)); }
+private:
+  uint64_t push_ CACHE_ALIGNED;
+  uint64_t push_limit_; // pop_ + CAPACITY seen by the producer
+  uint64_t pop_ CACHE_ALIGNED;
+  uint64_t pop_limit_; // push_ seen by the consumer
+  T *data_[CAPACITY] CACHE_ALIGNED;
+  DISALLOW_COPY_AND_ASSIGN(ObSpScRingQueue);
+};
+
+// Any number of producers and consumers. Every slot carries a sequence which tells the lap
+// it is ready for: slot of position pos can be pushed when seq == pos and popped when
+// seq == pos + 1, so a thread claims positions by CAS on the cursor only, and the element
+// and the sequence of a slot are written by the single thread which claimed it.
+//
+// Like ObLinkQueue, pop does not fail while an element claimed by a producer is being
+// written, it waits for the element instead.
+template <typename T, int64_t CAPACITY>
+class ObMpMcRingQueue
+{
+public:
+  ObMpMcRingQueue() : push_(0), pop_(0)
+  {
+    for (int64_t i = 0; i < CAPACITY; i++) {
+      cells_[i].seq_ = i;
+      cells_[i].data_ = NULL;
+    }
+  }
+  ~ObMpMcRingQueue() {}
+  int push(T *p)
+  {
+    int64_t pushed = 0;
+    return OB_UNLIKELY(NULL == p) ? OB_INVALID_ARGUMENT : push_batch(&p, 1, pushed);
+  }
+  int push_batch(T *const *ps, const int64_t cnt, int64_t &pushed)
+  {
+    int ret = OB_SUCCESS;
+    pushed = 0;
+    if (OB_UNLIKELY(NULL == ps || cnt <= 0)) {
+      ret = OB_INVALID_ARGUMENT;
+    } else {
+      uint64_t pos = ATOMIC_LOAD(&push_);
+      while (OB_SUCC(ret) && 0 == pushed) {
+        int64_t n = 0;
+        while (n < cnt && ATOMIC_LOAD_ACQ(&cells_[idx(pos + n)].seq_) == pos + n) {
+          n++;
+        }
+        if (n > 0) {
+          if (ATOMIC_BCAS(&push_, pos, pos + n)) {
+            for (int64_t i = 0; i < n; i++) {
+              Cell &cell = cells_[idx(pos + i)];
+              cell.data_ = ps[i];
+              ATOMIC_STORE(&cell.seq_, pos + i + 1);
+            }
+            pushed = n;
+          } else {
+            pos = ATOMIC_LOAD(&push_);
+          }
+        } else if (ATOMIC_LOAD_ACQ(&cells_[idx(pos)].seq_) > pos) {
+          // pushed by others
+          pos = ATOMIC_LOAD(&push_);
+        } else if (is_full(pos)) {
+          ret = OB_SIZE_OVERFLOW;
+        } else {
+          // the consumer of last lap has not released the slot yet
+          PAUSE();
+          pos = ATOMIC_LOAD(&push_);
+        }
+      }
+    }
+    return ret;
+  }
+  int pop(T *&p)
+  {
+    int64_t popped = 0;
+    int ret = pop_batch(&p, 1, popped);
+    if (OB_FAIL(ret)) {
+      p = NULL;
+    }
+    return ret;
+  }
+  int pop_batch(T **ps, const int64_t cnt, int64_t &popped)
+  {
+    int ret = OB_SUCCESS;
+    popped = 0;
+    if (OB_UNLIKELY(NULL == ps || cnt <= 0)) {
+      ret = OB_INVALID_ARGUMENT;
+    } else {
+      uint64_t pos = ATOMIC_LOAD(&pop_);
+      while (OB_SUCC(ret) && 0 == popped) {
+        int64_t n = 0;
+        while (n < cnt && ATOMIC_LOAD_ACQ(&cells_[idx(pos + n)].seq_) == pos + n + 1) {
+          n++;
+        }
+        if (n > 0) {
+          if (ATOMIC_BCAS(&pop_, pos, pos + n)) {
+            for (int64_t i = 0; i < n; i++) {
+              Cell &cell = cells_[idx(pos + i)];
+              ps[i] = cell.data_;
+              ATOMIC_STORE(&cell.seq_, pos + i + CAPACITY);
+            }
+            popped = n;
+          } else {
+            pos = ATOMIC_LOAD(&pop_);
+          }
+        } else if (ATOMIC_LOAD_ACQ(&cells_[idx(pos)].seq_) > pos + 1) {
+          // popped by others
+          pos = ATOMIC_LOAD(&pop_);
+        } else if (ATOMIC_LOAD(&push_) <= pos) {
+          ret = OB_EAGAIN;
+        } else {
+          // the producer has claimed the slot but not written it yet
+          PAUSE();
+          pos = ATOMIC_LOAD(&pop_);
+        }
+      }
+    }
+    return ret;
+  }
+  int64_t size() const
+  {
+    const uint64_t pop = ATOMIC_LOAD(&pop_);
+    const uint64_t push = ATOMIC_LOAD(&push_);
+    return push > pop ? static_cast<int64_t>(push - pop) : 0;
+  }
+  bool is_empty() const { return 0 == size(); }
+  static int64_t capacity() { return CAPACITY; }
+private:
+  STATIC_ASSERT(CAPACITY > 0 && 0 == (CAPACITY & (CAPACITY - 1)), "capacity should be power of 2");
+  struct Cell
+  {
+    uint64_t seq_;
+    T *data_;
+  };
+  static int64_t idx(const uint64_t x) { return static_cast<int64_t>(x & (CAPACITY - 1)); }
+  bool is_full(const uint64_t pos) const
+  {
+    // pop_ may pass pos if others push and pop after pos is loaded
+    const uint64_t pop = ATOMIC_LOAD(&pop_);
+    return pop <= pos && pos - pop >= CAPACITY;
+  }
+private:
+  uint64_t push_ CACHE_ALIGNED;
+  uint64_t pop_ CACHE_ALIGNED;
+  Cell cells_[CAPACITY] CACHE_ALIGNED;
+  DISALLOW_COPY_AND_ASSIGN(ObMpMcRingQueue);
+};
+
+// ObMpMcRingQueue whose consumers can wait for elements on an ObThreadCond. Producers only
+// take the mutex of the cond when some consumer is waiting.
+template <typename T, int64_t CAPACITY>
+class ObBlockingRingQueue
+{
+public:
+  ObBlockingRingQueue() : queue_(), cond_(), n_waiters_(0), is_inited_(false) {}
+  ~ObBlockingRingQueue() { destroy(); }
+  int init(const int32_t event_no = ObWaitEventIds::DEFAULT_COND_WAIT)
+  {
+    int ret = OB_SUCCESS;
+    if (OB_UNLIKELY(is_inited_)) {
+      ret = OB_INIT_TWICE;
+    } else if (OB_FAIL(cond_.init(event_no))) {
+      COMMON_LOG(WARN, "init thread cond failed", K(ret));
+    } else {
+      is_inited_ = true;
+    }
+    return ret;
+  }
+  void destroy()
+  {
+    if (is_inited_) {
+      cond_.destroy();
+      is_inited_ = false;
+    }
+  }
+  int push(T *p)
+  {
+    int ret = OB_SUCCESS;
+    if (OB_UNLIKELY(!is_inited_)) {
+      ret = OB_NOT_INIT;
+    } else if (OB_SUCC(queue_.push(p))) {
+      signal();
+    }
+    return ret;
+  }
+  int push_batch(T *const *ps, const int64_t cnt, int64_t &pushed)
+  {
+    int ret = OB_SUCCESS;
+    pushed = 0;
+    if (OB_UNLIKELY(!is_inited_)) {
+      ret = OB_NOT_INIT;
+    } else if (OB_SUCC(queue_.push_batch(ps, cnt, pushed))) {
+      signal(pushed > 1);
+    }
+    return ret;
+  }
+  // @timeout_us: 0 means do not wait
+  int pop(T *&p, const int64_t timeout_us)
+  {
+    int64_t popped = 0;
+    int ret = pop_batch(&p, 1, popped, timeout_us);
+    if (OB_FAIL(ret)) {
+      p = NULL;
+    }
+    return ret;
+  }
+  int pop_batch(T **ps, const int64_t cnt, int64_t &popped, const int64_t timeout_us)
+  {
+    int ret = OB_SUCCESS;
+    popped = 0;
+    if (OB_UNLIKELY(!is_inited_)) {
+      ret = OB_NOT_INIT;
+    } else if (OB_UNLIKELY(timeout_us < 0)) {
+      ret = OB_INVALID_ARGUMENT;
+    } else if (OB_EAGAIN == (ret = queue_.pop_batch(ps, cnt, popped)) && timeout_us > 0) {
+      const int64_t abs_timeout = ObTimeUtility::current_time() + timeout_us;
+      int64_t remain_us = timeout_us;
+      ObThreadCondGuard guard(cond_);
+      IGNORE_RETURN ATOMIC_AAF(&n_waiters_, 1);
+      while (OB_EAGAIN == (ret = queue_.pop_batch(ps, cnt, popped)) && remain_us > 0) {
+        IGNORE_RETURN cond_.wait_us(remain_us);
+        remain_us = abs_timeout - ObTimeUtility::current_time();
+      }
+      IGNORE_RETURN ATOMIC_AAF(&n_waiters_, -1);
+    }
+    return ret;
+  }
+  // wake up all waiting consumers, e.g. when stopping
+  void wakeup() { signal(true); }
+  int64_t size() const { return queue_.size(); }
+  bool is_empty() const { return queue_.is_empty(); }
+  static int64_t capacity() { return CAPACITY; }
+private:
+  void signal(const bool broadcast = false)
+  {
+    // pairs with the increment of n_waiters_ before the consumer checks the queue again
+    MEM_BARRIER();
+    if (ATOMIC_LOAD(&n_waiters_) > 0) {
+      ObThreadCondGuard guard(cond_);
+      if (broadcast) {
+        IGNORE_RETURN cond_.broadcast();
+      } else {
+        IGNORE_RETURN cond_.signal();
+      }
+    }
+  }
+private:
+  ObMpMcRingQueue<T, CAPACITY> queue_;
+  ObThreadCond cond_;
+  int64_t n_waiters_ CACHE_ALIGNED;
+  bool is_inited_;
+  DISALLOW_COPY_AND_ASSIGN(ObBlockingRingQueue);
+};
+
+// Drop-in replacement of ObLinkQueue: the same unbounded push/pop/size interface, served by
+// an ObMpMcRingQueue and spilling to an ObLinkQueue only when the ring is full. Pushes keep
+// going to the spill queue until it is drained, so that an element pushed after another is
+// not popped before it. push_front is not supported. CAPACITY is chosen by the user for the
+// usual backlog of the queue, as the ring is embedded in it.
+template <int64_t CAPACITY>
+class ObLinkRingQueue
+{
+public:
+  typedef QLink Link;
+  ObLinkRingQueue() : ring_(), spill_() {}
+  ~ObLinkRingQueue() {}
+  int push(Link *p)
+  {
+    int ret = OB_SUCCESS;
+    if (OB_UNLIKELY(NULL == p)) {
+      ret = OB_INVALID_ARGUMENT;
+    } else if (spill_.size() > 0 || OB_SUCCESS != ring_.push(p)) {
+      ret = spill_.push(p);
+    }
+    return ret;
+  }
+  int pop(Link *&p)
+  {
+    int ret = OB_SUCCESS;
+    if (OB_SUCCESS != ring_.pop(p)) {
+      ret = spill_.pop(p);
+    }
+    return ret;
+  }
+  int64_t size() const { return ring_.size() + spill_.size(); }
+private:
+  ObMpMcRingQueue<Link, CAPACITY> ring_;
+  ObLinkQueue spill_;
+  DISALLOW_COPY_AND_ASSIGN(ObLinkRingQueue);
+};
+
+// Drop-in replacement of ObSpScLinkQueue for one producer and one consumer at a time, served
+// by an ObSpScRingQueue and spilling to an ObSpScLinkQueue only when the ring is full. Like
+// ObLinkRingQueue, pushes keep going to the spill queue until it is drained, so the elements
+// of the ring are always older than the spilled ones and top() sees the oldest element.
+template <int64_t CAPACITY>
+class ObSpScLinkRingQueue
+{
+public:
+  typedef QLink Link;
+  ObSpScLinkRingQueue() : ring_(), spill_() {}
+  ~ObSpScLinkRingQueue() {}
+  // called by the consumer only
+  Link *top() const
+  {
+    Link *p = ring_.top();
+    return NULL != p ? p : spill_.top();
+  }
+  bool empty() const { return NULL == top(); }
+  void push(Link *p)
+  {
+    if (!spill_.empty() || OB_SUCCESS != ring_.push(p)) {
+      spill_.push(p);
+    }
+  }
+  Link *pop()
+  {
+    Link *p = NULL;
+    if (OB_SUCCESS != ring_.pop(p)) {
+      p = spill_.pop();
+    }
+    return p;
+  }
+private:
+  ObSpScRingQueue<Link, CAPACITY> ring_;
+  ObSpScLinkQueue spill_;
+  DISALLOW_COPY_AND_ASSIGN(ObSpScLinkRingQueue);
+};
+
+} // end namespace common
+} // end namespace oceanbase
+
+#endif // OCEANBASE_QUEUE_OB_RING_QUEUE_
@@ -38,6 +38,8 @@ void ObLargePageHelper::set_param(const char *param)
       large_page_type_ = PREFER_LARGE_PAGE;
     } else if (0 == strcasecmp(param, "only")) {
       large_page_type_ = ONLY_LARGE_PAGE;
+    } else if (0 == strcasecmp(param, "transparent")) {
+      large_page_type_ = TRANSPARENT_LARGE_PAGE;
     }
     LOG_INFO("set large page param", K(large_page_type_));
   }
@@ -156,6 +158,8 @@ void *AChunkMgr::low_alloc(const uint64_t size, const bool can_use_huge_page, bo
       OB_LIKELY(ObLargePageHelper::ONLY_LARGE_PAGE != large_page_type)) {
     if (MAP_FAILED == (ptr = ::mmap(ptr, size, prot, flags, fd, offset))) {
       ptr = nullptr;
+    } else if (ObLargePageHelper::TRANSPARENT_LARGE_PAGE == large_page_type && can_use_huge_page) {
+      huge_page_used = advise_huge_page(ptr, size, true);
     }
   } else {
     if (MAP_FAILED == (ptr = ::mmap(ptr, size, prot, huge_flags, fd, offset))) {
@@ -185,6 +189,44 @@ void *AChunkMgr::low_alloc(const uint64_t size, const bool can_use_huge_page, bo
   return ptr;
 }
 
+bool AChunkMgr::advise_huge_page(void *ptr, const uint64_t size, const bool enable)
+{
+  bool advised = false;
+#if defined(MADV_HUGEPAGE) && defined(MADV_NOHUGEPAGE)
+  // the kernel falls back to normal pages silently when there are no huge pages left,
+  // and the chunk can still be washed by MADV_DONTNEED, which splits the huge pages.
+  if (0 == ::madvise(ptr, size, enable ? MADV_HUGEPAGE : MADV_NOHUGEPAGE)) {
+    advised = true;
+  } else if (REACH_TIME_INTERVAL(60 * 1000 * 1000)) {
+    LOG_WARN("madvise huge page failed", K(errno), KP(ptr), K(size), K(enable));
+  }
+#else
+  UNUSED(ptr);
+  UNUSED(size);
+  UNUSED(enable);
+#endif
+  return advised;
+}
+
+void AChunkMgr::readvise_huge_page(AChunk *chunk, const bool huge_page_hint)
+{
+  if (ObLargePageHelper::TRANSPARENT_LARGE_PAGE == ObLargePageHelper::get_type()
+      && huge_page_hint != chunk->is_thp_) {
+    if (advise_huge_page(chunk, chunk->aligned(), huge_page_hint)) {
+      chunk->is_thp_ = huge_page_hint;
+    }
+  }
+}
+
+void AChunkMgr::set_huge_page_flag(AChunk *chunk, const bool huge_page_used)
+{
+  if (ObLargePageHelper::TRANSPARENT_LARGE_PAGE == ObLargePageHelper::get_type()) {
+    chunk->is_thp_ = huge_page_used;
+  } else {
+    chunk->is_hugetlb_ = huge_page_used;
+  }
+}
+
 void AChunkMgr::low_free(const void *ptr, const uint64_t size)
 {
   if (SANITY_ADDR_IN_RANGE(ptr)) {
@@ -196,11 +238,13 @@ void AChunkMgr::low_free(const void *ptr, const uint64_t size)
   ::munmap((void*)ptr, size);
 }
 
-AChunk *AChunkMgr::alloc_chunk(const uint64_t size, bool high_prio)
+AChunk *AChunkMgr::alloc_chunk(const uint64_t size, bool high_prio, const bool huge_page_hint)
 {
   const int64_t hold_size = hold(size);
   const int64_t all_size = aligned(size);
   const int64_t achunk_size = INTACT_ACHUNK_SIZE;
+  const bool can_use_huge_page =
+      ObLargePageHelper::TRANSPARENT_LARGE_PAGE != ObLargePageHelper::get_type() || huge_page_hint;
   bool is_allocated = true;
 
   AChunk *chunk = nullptr;
@@ -213,16 +257,18 @@ AChunk *AChunkMgr::alloc_chunk(const uint64_t size, bool high_prio)
     if (OB_ISNULL(chunk)) {
       if (update_hold(hold_size, high_prio)) {
         bool hugetlb_used = false;
-        void *ptr = direct_alloc(all_size, true, hugetlb_used, SANITY_BOOL_EXPR(true));
+        void *ptr = direct_alloc(all_size, can_use_huge_page, hugetlb_used, SANITY_BOOL_EXPR(true));
         if (ptr != nullptr) {
           chunk = new (ptr) AChunk();
-          chunk->is_hugetlb_ = hugetlb_used;
+          set_huge_page_flag(chunk, hugetlb_used);
         } else {
           IGNORE_RETURN update_hold(-hold_size, high_prio);
         }
       }
     } else {
       is_allocated = false;
+      // cached chunk was allocated for others, advise it by the hint on reuse
+      readvise_huge_page(chunk, huge_page_hint);
     }
   } else {
     bool updated = false;
@@ -236,10 +282,10 @@ AChunk *AChunkMgr::alloc_chunk(const uint64_t size, bool high_prio)
     }
     if (updated) {
       bool hugetlb_used = false;
-      void *ptr = direct_alloc(all_size, true, hugetlb_used, SANITY_BOOL_EXPR(true));
+      void *ptr = direct_alloc(all_size, can_use_huge_page, hugetlb_used, SANITY_BOOL_EXPR(true));
       if (ptr != nullptr) {
         chunk = new (ptr) AChunk();
-        chunk->is_hugetlb_ = hugetlb_used;
+        set_huge_page_flag(chunk, hugetlb_used);
       } else {
         IGNORE_RETURN update_hold(-hold_size, high_prio);
       }
@@ -146,7 +146,8 @@ const char *const use_large_pages_confs[] =
 {
   "true",
   "false",
-  "only"
+  "only",
+  "transparent"
 };
 
 class ObLargePageHelper
@@ -156,6 +157,8 @@ public:
   static const int NO_LARGE_PAGE = 0;
   static const int PREFER_LARGE_PAGE = 1;
   static const int ONLY_LARGE_PAGE = 2;
+  // madvise transparent huge pages on the chunks of memstore, kv cache and sql work area only
+  static const int TRANSPARENT_LARGE_PAGE = 3;
 public:
   static void set_param(const char *param);
   static int get_type();
@@ -175,9 +178,14 @@ public:
 public:
   AChunkMgr();
 
+  // @huge_page_hint only matters for TRANSPARENT_LARGE_PAGE, other types use huge pages for
+  // every chunk as before
   AChunk *alloc_chunk(
       const uint64_t size = ACHUNK_SIZE,
-      bool high_prio = false);
+      bool high_prio = false,
+      const bool huge_page_hint = false);
+  // advise or unadvise transparent huge pages for a chunk reused by another owner
+  void readvise_huge_page(AChunk *chunk, const bool huge_page_hint);
   void free_chunk(AChunk *chunk);
   AChunk *alloc_co_chunk(const uint64_t size = ACHUNK_SIZE);
   void free_co_chunk(AChunk *chunk);
@@ -215,6 +223,8 @@ private:
   // wrap for mmap
   void *low_alloc(const uint64_t size, const bool can_use_huge_page, bool &huge_page_used, const bool alloc_shadow);
   void low_free(const void *ptr, const uint64_t size);
+  static bool advise_huge_page(void *ptr, const uint64_t size, const bool enable);
+  static void set_huge_page_flag(AChunk *chunk, const bool huge_page_used);
 
 protected:
   AChunkList free_list_;
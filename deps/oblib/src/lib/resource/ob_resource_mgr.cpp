@@ -29,7 +29,7 @@ namespace lib
 ObTenantMemoryMgr::ObTenantMemoryMgr()
   : cache_washer_(NULL), tenant_id_(common::OB_INVALID_ID),
     limit_(INT64_MAX), sum_hold_(0), rpc_hold_(0), cache_hold_(0),
-    cache_item_count_(0)
+    cache_item_count_(0), huge_page_advised_hold_(0)
 {
   for (uint64_t i = 0; i < common::ObCtxIds::MAX_CTX_ID; i++) {
     ATOMIC_STORE(&(hold_bytes_[i]), 0);
@@ -40,7 +40,7 @@ ObTenantMemoryMgr::ObTenantMemoryMgr()
 ObTenantMemoryMgr::ObTenantMemoryMgr(const uint64_t tenant_id)
   : cache_washer_(NULL), tenant_id_(tenant_id),
     limit_(INT64_MAX), sum_hold_(0), rpc_hold_(0), cache_hold_(0),
-    cache_item_count_(0)
+    cache_item_count_(0), huge_page_advised_hold_(0)
 {
   for (uint64_t i = 0; i < common::ObCtxIds::MAX_CTX_ID; i++) {
     ATOMIC_STORE(&(hold_bytes_[i]), 0);
@@ -99,6 +99,10 @@ AChunk *ObTenantMemoryMgr::alloc_chunk(const int64_t size, const ObMemAttr &attr
           chunk = ptr2chunk(washed_blocks);
           const int64_t chunk_hold = static_cast<int64_t>(chunk->hold());
           update_cache_hold(-chunk_hold);
+          // the memblock is reused by @attr from now on
+          IGNORE_RETURN ATOMIC_AAF(&huge_page_advised_hold_, -huge_page_advised_hold_of(chunk));
+          CHUNK_MGR.readvise_huge_page(chunk, is_huge_page_candidate(attr));
+          IGNORE_RETURN ATOMIC_AAF(&huge_page_advised_hold_, huge_page_advised_hold_of(chunk));
           if (!update_ctx_hold(attr.ctx_id_, chunk_hold)) {
             // reach ctx limit
             // The ctx_id here can be given freely, because ctx_id is meaningless when the label is OB_KVSTORE_CACHE_MB
@@ -324,19 +328,48 @@ AChunk *ObTenantMemoryMgr::ptr2chunk(void *ptr)
   return chunk;
 }
 
+// memstore, kv cache and sql work area hold large and long-lived memory which is
+// accessed randomly, they benefit most from fewer tlb misses.
+bool ObTenantMemoryMgr::is_huge_page_candidate(const ObMemAttr &attr)
+{
+  return ObCtxIds::MEMSTORE_CTX_ID == attr.ctx_id_
+      || ObCtxIds::WORK_AREA == attr.ctx_id_
+      || ObNewModIds::OB_KVSTORE_CACHE_MB == attr.label_;
+}
+
+// charged and uncharged with the mapped size, which doesn't change with wash
+int64_t ObTenantMemoryMgr::huge_page_advised_hold_of(const AChunk *chunk)
+{
+  return chunk->is_huge_page() ? static_cast<int64_t>(CHUNK_MGR.hold(chunk->alloc_bytes_)) : 0;
+}
+
+void ObTenantMemoryMgr::unadvise_huge_page(AChunk *chunk)
+{
+  if (chunk->is_thp_) {
+    IGNORE_RETURN ATOMIC_AAF(&huge_page_advised_hold_, -huge_page_advised_hold_of(chunk));
+    CHUNK_MGR.readvise_huge_page(chunk, false);
+    IGNORE_RETURN ATOMIC_AAF(&huge_page_advised_hold_, huge_page_advised_hold_of(chunk));
+  }
+}
+
 AChunk *ObTenantMemoryMgr::alloc_chunk_(const int64_t size, const ObMemAttr &attr)
 {
   AChunk *chunk = nullptr;
   if (OB_UNLIKELY(attr.ctx_id_ == ObCtxIds::CO_STACK)) {
     chunk = CHUNK_MGR.alloc_co_chunk(static_cast<uint64_t>(size));
   } else {
-    chunk = CHUNK_MGR.alloc_chunk(static_cast<uint64_t>(size), OB_HIGH_ALLOC == attr.prio_);
+    chunk = CHUNK_MGR.alloc_chunk(static_cast<uint64_t>(size), OB_HIGH_ALLOC == attr.prio_,
+                                  is_huge_page_candidate(attr));
+  }
+  if (OB_NOT_NULL(chunk)) {
+    IGNORE_RETURN ATOMIC_AAF(&huge_page_advised_hold_, huge_page_advised_hold_of(chunk));
   }
   return chunk;
 }
 
 void ObTenantMemoryMgr::free_chunk_(AChunk *chunk, const ObMemAttr &attr)
 {
+  IGNORE_RETURN ATOMIC_AAF(&huge_page_advised_hold_, -huge_page_advised_hold_of(chunk));
   if (OB_UNLIKELY(attr.ctx_id_ == ObCtxIds::CO_STACK)) {
     CHUNK_MGR.free_co_chunk(chunk);
   } else {
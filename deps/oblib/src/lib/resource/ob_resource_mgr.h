@@ -41,6 +41,9 @@ public:
 
   AChunk *alloc_chunk(const int64_t size, const ObMemAttr &attr);
   void free_chunk(AChunk *chunk, const ObMemAttr &attr);
+  // stop advising @chunk to use transparent huge pages before part of it is washed,
+  // otherwise khugepaged may collapse the washed range into huge pages again
+  void unadvise_huge_page(AChunk *chunk);
 
   // used by cache module
   void *alloc_cache_mb(const int64_t size);
@@ -53,6 +56,7 @@ public:
   int64_t get_cache_hold() const { return cache_hold_; }
   int64_t get_cache_item_count() const { return cache_item_count_; }
   int64_t get_rpc_hold() const { return rpc_hold_; }
+  int64_t get_huge_page_advised_hold() const { return ATOMIC_LOAD(&huge_page_advised_hold_); }
 
   void update_rpc_hold(const int64_t size) { ATOMIC_AAF(&rpc_hold_, size); }
   const volatile int64_t *get_ctx_hold_bytes() const { return hold_bytes_; }
@@ -71,6 +75,8 @@ private:
   AChunk *ptr2chunk(void *ptr);
   AChunk *alloc_chunk_(const int64_t size, const ObMemAttr &attr);
   void free_chunk_(AChunk *chunk, const ObMemAttr &attr);
+  static bool is_huge_page_candidate(const ObMemAttr &attr);
+  static int64_t huge_page_advised_hold_of(const AChunk *chunk);
   ObICacheWasher *cache_washer_;
   uint64_t tenant_id_;
   int64_t limit_;
@@ -78,6 +84,10 @@ private:
   int64_t rpc_hold_;
   int64_t cache_hold_;
   int64_t cache_item_count_;
+  // mapped size of hugetlb chunks and of chunks advised to use transparent huge pages, washed
+  // pages included. The kernel may still back advised chunks by normal pages, so this is an
+  // upper bound of the memory actually backed by huge pages.
+  int64_t huge_page_advised_hold_;
   volatile int64_t hold_bytes_[common::ObCtxIds::MAX_CTX_ID];
   volatile int64_t limit_bytes_[common::ObCtxIds::MAX_CTX_ID];
 };
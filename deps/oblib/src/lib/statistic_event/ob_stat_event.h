@@ -142,6 +142,9 @@ STAT_EVENT_ADD_DEF(SQL_PS_PREPARE_TIME, "ps prepare time", ObStatClassIds::SQL,
 STAT_EVENT_ADD_DEF(SQL_PS_EXECUTE_COUNT, "ps execute count", ObStatClassIds::SQL, "ps execute count", 40022, true, true)
 STAT_EVENT_ADD_DEF(SQL_PS_CLOSE_COUNT, "ps close count", ObStatClassIds::SQL, "ps close count", 40023, true, true)
 STAT_EVENT_ADD_DEF(SQL_PS_CLOSE_TIME, "ps close time", ObStatClassIds::SQL, "ps close time", 40024, true, true)
+STAT_EVENT_ADD_DEF(SQL_BATCHED_MULTI_STMT_COUNT, "batched multi statement count", ObStatClassIds::SQL, "batched multi statement count", 40025, true, true)
+STAT_EVENT_ADD_DEF(SQL_BATCHED_MULTI_STMT_ROLLBACK_COUNT, "batched multi statement rollback count", ObStatClassIds::SQL, "batched multi statement rollback count", 40026, true, true)
+STAT_EVENT_ADD_DEF(SQL_BATCHED_MULTI_STMT_SKIP_COUNT, "batched multi statement skip count", ObStatClassIds::SQL, "batched multi statement skip count", 40027, true, true)
 
 STAT_EVENT_ADD_DEF(SQL_OPEN_CURSORS_CURRENT, "opened cursors current", ObStatClassIds::SQL, "opened cursors current", 40030, true, true)
 STAT_EVENT_ADD_DEF(SQL_OPEN_CURSORS_CUMULATIVE, "opened cursors cumulative", ObStatClassIds::SQL, "opened cursors cumulative", 40031, true, true)
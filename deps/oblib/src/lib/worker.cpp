@@ -56,7 +56,8 @@ Worker::Worker()
       rpc_tenant_id_(0),
       tidx_(-1),
       large_token_expired_(0),
-      disable_wait_(false)
+      disable_wait_(false),
+      block_compensation_(false)
 {
   worker_node_.get_data() = this;
   lq_worker_node_.get_data() = this;
@@ -48,7 +48,7 @@ public:
   // Return:
   //   1. true    wait successfully
   //   2. false   wait fail, should cancel this invocation
-  bool sched_wait();
+  virtual bool sched_wait();
 
   // This function is opposite to `omt_sched_wait'. It notify
   // Multi-Tenancy that this worker has got enough resource and want to
@@ -58,7 +58,7 @@ public:
   // Return:
   //   1. true   the worker has right to go ahead
   //   2. false  the worker hasn't right to go ahead
-  bool sched_run(int64_t waittime=0);
+  virtual bool sched_run(int64_t waittime=0);
 
   ObIAllocator &get_sql_arena_allocator() ;
   ObIAllocator &get_allocator() ;
@@ -134,6 +134,11 @@ public:
   void set_disable_wait_flag(bool f);
   bool get_disable_wait_flag() const;
 
+  // whether the tenant runs another worker while this one blocks, callers on hot
+  // paths check it before calling sched_wait/sched_run
+  void set_block_compensation(bool f) { block_compensation_ = f; }
+  bool has_block_compensation() const { return block_compensation_; }
+
   common::ObDLinkNode<Worker*> worker_node_;
   common::ObDLinkNode<Worker*> lq_worker_node_;
   common::ObDLinkNode<Worker*> lq_waiting_worker_node_;
@@ -192,6 +197,8 @@ private:
   // Used to prevent the thread holding the lock from being suspended by check_wait
   bool disable_wait_;
 
+  bool block_compensation_;
+
   DISALLOW_COPY_AND_ASSIGN(Worker);
 }; // end of class Worker
 
@@ -347,7 +347,15 @@ int ObMySQLUtil::int_cell_str(
   } else if (OB_UNLIKELY((len - pos) < (OB_LTOA10_CHAR_LEN + 9))) {
     ret = OB_SIZE_OVERFLOW;
   } else {
-    if (TEXT == type) {
+    if (TEXT == type && !zerofill) {
+      // at most 20 digits and the sign, so the length always takes one byte and the
+      // digits are formatted in place right after it
+      const int64_t length = is_unsigned
+          ? ObFastFormatInt::format_unsigned(static_cast<uint64_t>(val), buf + pos + 1)
+          : ObFastFormatInt::format_signed(val, buf + pos + 1);
+      ret = ObMySQLUtil::store_length(buf, pos + 1, length, pos);
+      pos += length;
+    } else if (TEXT == type) {
 //      char tmp_buff[OB_LTOA10_CHAR_LEN];
 //      int64_t len_raw = ltoa10(static_cast<int64_t>(val), tmp_buff, is_unsigned ? false : true) - tmp_buff;
       uint64_t length = 0;
@@ -365,7 +373,6 @@ int ObMySQLUtil::int_cell_str(
       } else if (zero_cnt > 0 && OB_UNLIKELY(pos + bytes_to_store_len + zero_cnt > len)) {
         ret = OB_SIZE_OVERFLOW;
       } else {
-        MEMCPY(buf + pos + bytes_to_store_len, ffi.ptr(), ffi.length());
         if (zero_cnt > 0) {
           /*zero_cnt > 0 indicates that zerofill is true */
           MEMSET(buf + pos + bytes_to_store_len, '0', zero_cnt);
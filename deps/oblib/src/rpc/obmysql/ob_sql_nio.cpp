@@ -580,7 +580,9 @@ private:
 class ObSqlNioImpl
 {
 public:
-  ObSqlNioImpl(ObISqlSockHandler& handler): handler_(handler), epfd_(-1), lfd_(-1) {}
+  ObSqlNioImpl(ObISqlSockHandler& handler)
+    : handler_(handler), epfd_(-1), lfd_(-1),
+      epoll_wait_cnt_(0), epoll_event_cnt_(0), epoll_max_batch_(0) {}
   ~ObSqlNioImpl() {}
   int init(int port) {
     int ret = OB_SUCCESS;
@@ -650,6 +652,11 @@ private:
     const int maxevents = 512;
     struct epoll_event events[maxevents];
     int cnt = epoll_wait(epfd_, events, maxevents, 1000);
+    if (cnt > 0) {
+      epoll_wait_cnt_++;
+      epoll_event_cnt_ += cnt;
+      epoll_max_batch_ = std::max(epoll_max_batch_, static_cast<int64_t>(cnt));
+    }
     for(int i = 0; i < cnt; i++) {
       ObSqlSock* s = (ObSqlSock*)events[i].data.ptr;
       if (OB_UNLIKELY(NULL == s)) {
@@ -826,6 +833,11 @@ private:
   void print_session_info() {
     static const int64_t max_process_time = 1000L * 1000L * 20L; // 20s
     if (TC_REACH_TIME_INTERVAL(15*1000*1000L)) {
+      LOG_INFO("[sql nio epoll stat]", K_(epoll_wait_cnt), K_(epoll_event_cnt), K_(epoll_max_batch),
+               "avg_batch", epoll_wait_cnt_ > 0 ? epoll_event_cnt_ / epoll_wait_cnt_ : 0);
+      epoll_wait_cnt_ = 0;
+      epoll_event_cnt_ = 0;
+      epoll_max_batch_ = 0;
       ObDLink* head = all_list_.head();
       ObLink* cur = head->next_;
       while (cur != head) {
@@ -852,6 +864,10 @@ private:
   ObSpScLinkQueue write_req_queue_;
   ObDList pending_destroy_list_;
   ObDList all_list_;
+  // epoll stats of this io thread since last print
+  int64_t epoll_wait_cnt_;
+  int64_t epoll_event_cnt_;
+  int64_t epoll_max_batch_;
 };
 
 int ObSqlNio::start(int port, ObISqlSockHandler* handler, int n_thread)
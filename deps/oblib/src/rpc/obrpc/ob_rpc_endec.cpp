@@ -86,12 +86,24 @@ int rpc_decode_ob_packet(ObRpcMemPool& pool, char* buf, int64_t sz, ObRpcPacket*
   return ret;
 }
 
+// Responses built by ObRpcProcessorBase reserve the net header and the rpc header right
+// before the content, see the buffer format in ObRpcProcessorBase::part_response. The header
+// is encoded in place there so that a large result is not copied once more.
 int rpc_encode_ob_packet(ObRpcMemPool& pool, ObRpcPacket* pkt, char*& buf, int64_t& sz)
 {
   int ret = common::OB_SUCCESS;
   int64_t pos = 0;
   int64_t encode_size = pkt->get_encoded_size();
-  if (NULL == (buf = (char*)pool.alloc(encode_size))) {
+  const int64_t header_size = pkt->get_header_size();
+  char* header_room = reinterpret_cast<char*>(pkt + 1) + OB_NET_HEADER_LENGTH;
+  if (pkt->get_clen() > 0 && pkt->get_cdata() == header_room + header_size) {
+    if (OB_FAIL(pkt->encode_header(header_room, header_size, pos))) {
+      LOG_WARN("encode header in place fail", K(ret), K(header_size));
+    } else {
+      buf = header_room;
+      sz = encode_size;
+    }
+  } else if (NULL == (buf = (char*)pool.alloc(encode_size))) {
     ret = common::OB_ALLOCATE_MEMORY_FAILED;
     LOG_WARN("alloc encode buffer fail", K(encode_size));
   } else if (OB_FAIL(pkt->encode_header(buf, encode_size, pos))) {
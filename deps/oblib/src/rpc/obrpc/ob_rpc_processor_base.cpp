@@ -502,10 +502,20 @@ int ObRpcProcessorBase::part_response(const int retcode, bool is_last)
 }
 
 int ObRpcProcessorBase::flush(int64_t wait_timeout)
+{
+  int ret = OB_SUCCESS;
+  if (OB_FAIL(send_stream_part())) {
+    // warned inside
+  } else if (OB_FAIL(wait_stream_next(wait_timeout))) {
+    // warned inside
+  }
+  return ret;
+}
+
+int ObRpcProcessorBase::send_stream_part()
 {
   int ret = OB_SUCCESS;
   is_stream_ = true;
-  rpc::ObRequest *req = NULL;
   UNIS_VERSION_GUARD(unis_version_);
 
   if (nullptr == sc_) {
@@ -527,7 +537,20 @@ int ObRpcProcessorBase::flush(int64_t wait_timeout)
     RPC_OBRPC_LOG(WARN, "prepare stream session fail", K(ret));
   } else if (OB_FAIL(part_response(common::OB_SUCCESS, false))) {
     RPC_OBRPC_LOG(WARN, "response part result to peer fail", K(ret));
-  } else if (FALSE_IT({NG_TRACE(transmit);})) {
+  } else {
+    NG_TRACE(transmit);
+  }
+  return ret;
+}
+
+int ObRpcProcessorBase::wait_stream_next(int64_t wait_timeout)
+{
+  int ret = OB_SUCCESS;
+  rpc::ObRequest *req = NULL;
+  if (OB_ISNULL(sc_) || !is_stream_ || is_stream_end_) {
+    ret = OB_ERR_UNEXPECTED;
+    RPC_OBRPC_LOG(WARN, "stream part not sent before waiting next packet",
+        K(ret), KP(sc_), K(is_stream_), K(is_stream_end_));
   } else if (OB_FAIL(sc_->wait(req, wait_timeout))) {
     NG_TRACE(receive);
     req_ = NULL; //wait fail, invalid req_
@@ -110,6 +110,10 @@ protected:
   virtual int serialize();
   virtual int response(const int retcode) { return part_response(retcode, true); }
   virtual int flush(int64_t wait_timeout = DEFAULT_WAIT_NEXT_PACKET_TIMEOUT);
+  // flush() is split into two halves so that a stream processor can do useful work,
+  // e.g. prefetch the next part result, while the peer is receiving the current one.
+  virtual int send_stream_part();
+  virtual int wait_stream_next(int64_t wait_timeout = DEFAULT_WAIT_NEXT_PACKET_TIMEOUT);
 
   void set_preserve_recv_data() { preserve_recv_data_ = true; }
   void set_result_compress_type(common::ObCompressorType t) { result_compress_type_ = t; }
@@ -619,7 +619,11 @@ int ObVirtualRpcProtocolProcessor::decode_raw_net_rpc_packet(common::ObTimeGuard
           ret = OB_ERR_UNEXPECTED;
           LOG_ERROR("invalid recv_len ", K(recv_len), K(full_demanded_len), K(ret));
         } else {
-          uint32_t alloc_size = static_cast<uint32_t>(sizeof (ObRpcPacket)) + plen;
+          // The packet refers to the content in the input buffer instead of copying it out.
+          // Both are allocated from ms->pool, and easy never overwrites data already read
+          // into a message (more room is allocated from the pool instead), so the content
+          // lives as long as the packet does.
+          uint32_t alloc_size = static_cast<uint32_t>(sizeof (ObRpcPacket));
           timeguard.click();
           char *buf = easy_alloc(ms->pool, alloc_size);
           if (OB_UNLIKELY(NULL == buf)) {
@@ -630,8 +634,7 @@ int ObVirtualRpcProtocolProcessor::decode_raw_net_rpc_packet(common::ObTimeGuard
             timeguard.click();
             pkt = new (buf) ObRpcPacket();
             pkt->set_chid(chid);
-            char *pbuf = buf + sizeof(ObRpcPacket);
-            MEMCPY(pbuf, net_header_data + OB_NET_HEADER_LENGTH, plen);
+            char *pbuf = net_header_data + OB_NET_HEADER_LENGTH;
             timeguard.click();
             if (OB_FAIL(pkt->decode(pbuf, plen))) {
               // decode packet header fail
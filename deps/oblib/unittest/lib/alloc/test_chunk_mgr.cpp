@@ -82,3 +82,33 @@ TEST_F(TestChunkMgr, FreeListManyChunk)
   EXPECT_EQ(500*2, free_list_.get_pushes());
   EXPECT_EQ(500, free_list_.get_pops());
 }
+
+TEST_F(TestChunkMgr, TransparentHugePage)
+{
+  const int orig_type = ObLargePageHelper::large_page_type_;
+  ObLargePageHelper::set_param("transparent");
+  ASSERT_EQ(ObLargePageHelper::TRANSPARENT_LARGE_PAGE, ObLargePageHelper::get_type());
+  {
+    AChunk *chunk = alloc_chunk(OB_MALLOC_BIG_BLOCK_SIZE);
+    ASSERT_NE(nullptr, chunk);
+    EXPECT_FALSE(chunk->is_huge_page());
+    free_chunk(chunk);
+  }
+  bool thp_supported = false;
+  {
+    // reuse the cached chunk, which is advised now
+    AChunk *chunk = alloc_chunk(OB_MALLOC_BIG_BLOCK_SIZE, false, true);
+    ASSERT_NE(nullptr, chunk);
+    EXPECT_FALSE(chunk->is_hugetlb_);
+    thp_supported = chunk->is_thp_;
+    free_chunk(chunk);
+  }
+  {
+    AChunk *chunk = alloc_chunk(2 * INTACT_ACHUNK_SIZE, false, true);
+    ASSERT_NE(nullptr, chunk);
+    EXPECT_FALSE(chunk->is_hugetlb_);
+    EXPECT_EQ(thp_supported, chunk->is_thp_);
+    free_chunk(chunk);
+  }
+  ObLargePageHelper::large_page_type_ = orig_type;
+}
@@ -19,6 +19,7 @@
 #include "lib/utility/ob_test_util.h"
 #include "lib/coro/testing.h"
 #include <gtest/gtest.h>
+#include <thread>
 
 using namespace oceanbase::lib;
 using namespace oceanbase::common;
@@ -159,6 +160,207 @@ TEST_F(TestObjectMgr, TestName)
   Malloc(96);
 }
 
+TEST_F(TestObjectMgr, TestThreadCache)
+{
+  ObjectMgr::set_thread_cache_enabled(true);
+  void *ptr = ob_malloc(100, "CacheTest1");
+  ASSERT_TRUE(NULL != ptr);
+  AObject *obj = reinterpret_cast<AObject*>((char*)ptr - AOBJECT_HEADER_SIZE);
+  const uint32_t cells = ObjectThreadCache::cells_of(100);
+  ASSERT_EQ(cells, obj->nobjs_);
+  ASSERT_EQ(ObjectThreadCache::capacity_of(cells), obj->alloc_bytes_);
+  ob_free(ptr);
+  ASSERT_EQ(cells * AOBJECT_CELL_BYTES, ObjectThreadCache::get_thread_hold());
+  // reused by any size of the same cells
+  void *ptr2 = ob_malloc(ObjectThreadCache::capacity_of(cells), "CacheTest2");
+  ASSERT_EQ(ptr, ptr2);
+  ASSERT_EQ(0, ObjectThreadCache::get_thread_hold());
+  ASSERT_STREQ("CacheTest2", obj->label_);
+  ob_free(ptr2);
+
+  // large objects are not cached
+  ptr = ob_malloc(ObjectThreadCache::MAX_OBJECT_SIZE + 1, "CacheTest1");
+  ob_free(ptr);
+  ASSERT_EQ(cells * AOBJECT_CELL_BYTES, ObjectThreadCache::get_thread_hold());
+
+  // flushed by the next free once disabled
+  ObjectMgr::set_thread_cache_enabled(false);
+  ptr = ob_malloc(100, "CacheTest1");
+  ASSERT_EQ(100, reinterpret_cast<AObject*>((char*)ptr - AOBJECT_HEADER_SIZE)->alloc_bytes_);
+  ob_free(ptr);
+  ASSERT_EQ(0, ObjectThreadCache::get_thread_hold());
+
+  // bounded hold
+  ObjectMgr::set_thread_cache_enabled(true);
+  std::vector<void*> ptrs;
+  for (int64_t i = 0; i < 4096; ++i) {
+    ptrs.push_back(ob_malloc(16 + (i % 64) * 16, "CacheTest1"));
+  }
+  for (void *p : ptrs) {
+    ob_free(p);
+  }
+  ASSERT_LE(ObjectThreadCache::get_thread_hold(), ObjectThreadCache::MAX_HOLD);
+  ObjectThreadCache::get_instance().flush();
+  ASSERT_EQ(0, ObjectThreadCache::get_thread_hold());
+  ObjectMgr::set_thread_cache_enabled(false);
+}
+
+TEST_F(TestObjectMgr, TestThreadCacheDrain)
+{
+  ObjectMgr::set_thread_cache_enabled(true);
+  ObjectThreadCache *cache = NULL;
+  bool cached = false;
+  bool drained = false;
+  std::thread th([&]() {
+    void *ptr = ob_malloc(100, "CacheTest2");
+    ob_free(ptr);
+    cache = &ObjectThreadCache::get_instance();
+    ATOMIC_STORE(&cached, true);
+    // idle with the cached object until drained by others
+    while (!ATOMIC_LOAD(&drained)) {
+      ::usleep(1000);
+    }
+    ASSERT_EQ(0, ObjectThreadCache::get_thread_hold());
+    ptr = ob_malloc(100, "CacheTest2");
+    ob_free(ptr);
+    ASSERT_GT(ObjectThreadCache::get_thread_hold(), 0);
+  });
+  while (!ATOMIC_LOAD(&cached)) {
+    ::usleep(1000);
+  }
+  ASSERT_GT(cache->get_hold(), 0);
+  // cached objects of other ObjectMgrs are kept
+  auto *other = ObMallocAllocator::get_instance()->get_tenant_ctx_allocator(
+      OB_SERVER_TENANT_ID, ObCtxIds::GLIBC);
+  ObjectThreadCache::flush_all(static_cast<ObjectMgr*>(&other->get_block_mgr()));
+  ASSERT_GT(cache->get_hold(), 0);
+  // sync wash drains the caches of all threads
+  auto *ta = ObMallocAllocator::get_instance()->get_tenant_ctx_allocator(
+      OB_SERVER_TENANT_ID, ObCtxIds::DEFAULT_CTX_ID);
+  ta->sync_wash(0);
+  ASSERT_EQ(0, cache->get_hold());
+  ATOMIC_STORE(&drained, true);
+  th.join();
+  ObjectMgr::set_thread_cache_enabled(false);
+}
+
+TEST_F(TestObjectMgr, TestThreadCacheIdleFlush)
+{
+  ObjectMgr::set_thread_cache_enabled(true);
+  ObjectThreadCache *cache = NULL;
+  bool cached = false;
+  bool done = false;
+  std::thread th([&]() {
+    void *ptr = ob_malloc(100, "CacheTest2");
+    ob_free(ptr);
+    cache = &ObjectThreadCache::get_instance();
+    ATOMIC_STORE(&cached, true);
+    while (!ATOMIC_LOAD(&done)) {
+      ::usleep(1000);
+    }
+  });
+  while (!ATOMIC_LOAD(&cached)) {
+    ::usleep(1000);
+  }
+  ASSERT_GT(cache->get_hold(), 0);
+  // recently flushed caches are kept
+  ObjectThreadCache::flush_idle();
+  ASSERT_GT(cache->get_hold(), 0);
+  ::usleep(ObjectThreadCache::FLUSH_INTERVAL + 100 * 1000);
+  ObjectThreadCache::flush_idle();
+  ASSERT_EQ(0, cache->get_hold());
+  ATOMIC_STORE(&done, true);
+  th.join();
+  ObjectMgr::set_thread_cache_enabled(false);
+}
+
+// frees an object from a thread local destructor that runs after the cache's one
+struct LateFree
+{
+  LateFree() : ptr_(NULL) {}
+  ~LateFree()
+  {
+    if (NULL != ptr_) {
+      ob_free(ptr_);
+    }
+  }
+  void *ptr_;
+};
+
+TEST_F(TestObjectMgr, TestThreadCacheDestroyed)
+{
+  ObjectMgr::set_thread_cache_enabled(true);
+  auto *ta = ObMallocAllocator::get_instance()->get_tenant_ctx_allocator(
+      OB_SERVER_TENANT_ID, ObCtxIds::DEFAULT_CTX_ID);
+  ObjectMgr &mgr = static_cast<ObjectMgr&>(ta->get_block_mgr());
+  mgr.flush_thread_caches();
+  const int64_t used = mgr.get_stat().used_;
+  std::thread th([&]() {
+    // constructed before the cache, so destroyed after it
+    static thread_local LateFree late_free;
+    void *ptr = ob_malloc(100, "CacheTest4");
+    ob_free(ptr);
+    ASSERT_GT(ObjectThreadCache::get_thread_hold(), 0);
+    late_free.ptr_ = ob_malloc(100, "CacheTest4");
+  });
+  th.join();
+  // freed to its object set instead of the destroyed cache
+  mgr.flush_thread_caches();
+  ASSERT_EQ(used, mgr.get_stat().used_);
+  ObjectMgr::set_thread_cache_enabled(false);
+}
+
+TEST_F(TestObjectMgr, TestThreadCacheOwner)
+{
+  ObjectSet set;
+  ASSERT_TRUE(NULL == ObjectMgr::get_owner(&set));
+  auto *ta = ObMallocAllocator::get_instance()->get_tenant_ctx_allocator(
+      OB_SERVER_TENANT_ID, ObCtxIds::DEFAULT_CTX_ID);
+  void *ptr = ob_malloc(100, "CacheTest3");
+  auto *obj = reinterpret_cast<AObject*>((char*)ptr - AOBJECT_HEADER_SIZE);
+  ASSERT_EQ(&ta->get_block_mgr(), ObjectMgr::get_owner(obj->block()->obj_set_));
+  ob_free(ptr);
+}
+
+// alloc/free pairs of small objects like short OLTP requests, with and without thread cache,
+// a benchmark run by --gtest_also_run_disabled_tests
+TEST_F(TestObjectMgr, DISABLED_TestThreadCachePerf)
+{
+  const int64_t batch_cnt = 1L << 12;
+  const int64_t batch_size = 16;
+  for (int64_t thread_cnt = 1; thread_cnt <= 128; thread_cnt *= 2) {
+    int64_t cost_us[2] = {0, 0};
+    for (int enabled = 0; enabled < 2; ++enabled) {
+      ObjectMgr::set_thread_cache_enabled(enabled);
+      std::vector<std::thread> threads;
+      const int64_t start_ts = ObTimeUtility::current_time();
+      for (int64_t t = 0; t < thread_cnt; ++t) {
+        threads.push_back(std::thread([&]() {
+          void *p[batch_size];
+          for (int64_t i = 0; i < batch_cnt; ++i) {
+            for (int64_t j = 0; j < batch_size; ++j) {
+              p[j] = ob_malloc(16 + j * 32, "CachePerf");
+            }
+            for (int64_t j = batch_size - 1; j >= 0; --j) {
+              ob_free(p[j]);
+            }
+          }
+          ObjectThreadCache::get_instance().flush();
+        }));
+      }
+      for (auto &th : threads) {
+        th.join();
+      }
+      cost_us[enabled] = ObTimeUtility::current_time() - start_ts;
+    }
+    const int64_t pairs = thread_cnt * batch_cnt * batch_size;
+    cout << "threads=" << thread_cnt
+         << " no_cache_ns_per_pair=" << cost_us[0] * 1000 / pairs
+         << " cache_ns_per_pair=" << cost_us[1] * 1000 / pairs << endl;
+  }
+  ObjectMgr::set_thread_cache_enabled(false);
+}
+
 struct Record
 {
   int32_t size_;
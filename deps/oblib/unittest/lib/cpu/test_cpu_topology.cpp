@@ -0,0 +1,70 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#include <pthread.h>
+#include "lib/cpu/ob_cpu_topology.h"
+#include "lib/ob_errno.h"
+
+using namespace oceanbase::common;
+
+TEST(TestNumaTopology, parse_cpu_list)
+{
+  cpu_set_t cpu_set;
+  ASSERT_EQ(OB_SUCCESS, ObNumaTopology::parse_cpu_list("0-3,8,10-11\n", cpu_set));
+  ASSERT_EQ(7, CPU_COUNT(&cpu_set));
+  ASSERT_TRUE(CPU_ISSET(0, &cpu_set));
+  ASSERT_TRUE(CPU_ISSET(3, &cpu_set));
+  ASSERT_FALSE(CPU_ISSET(4, &cpu_set));
+  ASSERT_TRUE(CPU_ISSET(8, &cpu_set));
+  ASSERT_TRUE(CPU_ISSET(11, &cpu_set));
+
+  ASSERT_EQ(OB_SUCCESS, ObNumaTopology::parse_cpu_list("5", cpu_set));
+  ASSERT_EQ(1, CPU_COUNT(&cpu_set));
+  // memory only node
+  ASSERT_EQ(OB_SUCCESS, ObNumaTopology::parse_cpu_list("\n", cpu_set));
+  ASSERT_EQ(0, CPU_COUNT(&cpu_set));
+
+  ASSERT_EQ(OB_INVALID_ARGUMENT, ObNumaTopology::parse_cpu_list(NULL, cpu_set));
+  ASSERT_EQ(OB_INVALID_ARGUMENT, ObNumaTopology::parse_cpu_list("3-1", cpu_set));
+  ASSERT_EQ(OB_INVALID_ARGUMENT, ObNumaTopology::parse_cpu_list("0-", cpu_set));
+  ASSERT_EQ(OB_INVALID_ARGUMENT, ObNumaTopology::parse_cpu_list("0;1", cpu_set));
+}
+
+TEST(TestNumaTopology, bind)
+{
+  const ObNumaTopology &topology = ObNumaTopology::get_instance();
+  cpu_set_t origin_cpus;
+  cpu_set_t cpus;
+  ASSERT_EQ(0, pthread_getaffinity_np(pthread_self(), sizeof(origin_cpus), &origin_cpus));
+  ASSERT_GE(topology.get_node_cnt(), 1);
+  ASSERT_EQ(0, topology.get_node_cpu_cnt(-1));
+  ASSERT_EQ(0, topology.get_node_cpu_cnt(topology.get_node_cnt()));
+  ASSERT_EQ(OB_INVALID_ARGUMENT, topology.bind_self_to_node(topology.get_node_cnt()));
+  for (int64_t node = 0; node < topology.get_node_cnt(); ++node) {
+    if (topology.get_node_cpu_cnt(node) > 0) {
+      ASSERT_EQ(OB_SUCCESS, topology.bind_self_to_node(node));
+      ASSERT_EQ(0, pthread_getaffinity_np(pthread_self(), sizeof(cpus), &cpus));
+      ASSERT_EQ(topology.get_node_cpu_cnt(node), CPU_COUNT(&cpus));
+    }
+  }
+  // the affinity of the process is restored, not all cpus of the nodes
+  ASSERT_EQ(OB_SUCCESS, topology.bind_self_to_node(ObNumaTopology::INVALID_NODE));
+  ASSERT_EQ(0, pthread_getaffinity_np(pthread_self(), sizeof(cpus), &cpus));
+  ASSERT_TRUE(CPU_EQUAL(&origin_cpus, &cpus));
+}
+
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
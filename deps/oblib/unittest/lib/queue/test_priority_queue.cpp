@@ -15,6 +15,7 @@
 #include "lib/queue/ob_priority_queue.h"
 #include "lib/thread/thread_pool.h"
 #include <iostream>
+#include <thread>
 
 using namespace oceanbase::lib;
 using namespace oceanbase::common;
@@ -31,7 +32,7 @@ public:
     ~QData() {}
     int64_t val_;
   };
-  typedef ObPriorityQueue2<1, 2> Queue;
+  typedef ObPriorityQueue2<1, 2, 0, 16> Queue;
   TestQueue(): push_seq_(0), pop_seq_(0) {
     limit_ = atoll(getenv("limit")?: "100000");
   }
@@ -126,6 +127,57 @@ TEST(TestPriorityQueue, WithCoro)
   tq.do_stress();
 }
 
+TEST(TestPriorityQueue, Sharded)
+{
+  typedef TestQueue::QData QData;
+  typedef ObShardedPriorityQueue2<1, 2, 1, 16> Queue;
+  Queue queue;
+  QData data[8];
+  ObLink *p = NULL;
+  ASSERT_EQ(OB_NOT_INIT, queue.push(&data[0], 0));
+  ASSERT_EQ(OB_INVALID_ARGUMENT, queue.init(0, ObMemAttr(500, "TestQueue")));
+  ASSERT_EQ(OB_SUCCESS, queue.init(4, ObMemAttr(500, "TestQueue")));
+  ASSERT_EQ(OB_INIT_TWICE, queue.init(4, ObMemAttr(500, "TestQueue")));
+  queue.set_limit(6);
+
+  // push from cpus of different shards, pop returns the highest priority first
+  const int64_t cpu_cnt = max(1L, sysconf(_SC_NPROCESSORS_ONLN));
+  for (int64_t i = 0; i < 4; i++) {
+    data[i].val_ = 3 - i;
+    int push_ret = OB_ERROR;
+    std::thread pusher([&, i]() {
+      cpu_set_t cpu_set;
+      CPU_ZERO(&cpu_set);
+      CPU_SET((i * Queue::CPU_PER_SHARD) % cpu_cnt, &cpu_set);
+      IGNORE_RETURN pthread_setaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set);
+      push_ret = queue.push(&data[i], static_cast<int>(3 - i));
+    });
+    pusher.join();
+    ASSERT_EQ(OB_SUCCESS, push_ret);
+  }
+  ASSERT_EQ(4, queue.size());
+  ASSERT_EQ(1, queue.queue_size(0));
+  ASSERT_EQ(OB_ENTRY_NOT_EXIST, queue.pop_high_high(p, 0));
+  ASSERT_EQ(OB_ENTRY_NOT_EXIST, queue.pop_high(p, 0));
+  for (int64_t i = 0; i < 4; i++) {
+    ASSERT_EQ(OB_SUCCESS, queue.pop(p, 0));
+    ASSERT_EQ(i, static_cast<QData*>(p)->val_);
+  }
+  ASSERT_EQ(0, queue.size());
+  ASSERT_EQ(OB_ENTRY_NOT_EXIST, queue.pop(p, 0));
+
+  // the limit is on the whole queue, not on a single shard
+  for (int64_t i = 0; i < 8; i++) {
+    ASSERT_EQ(i < 7 ? OB_SUCCESS : OB_SIZE_OVERFLOW, queue.push(&data[i], 3));
+  }
+  ASSERT_EQ(7, queue.size());
+  for (int64_t i = 0; i < 7; i++) {
+    ASSERT_EQ(OB_SUCCESS, queue.pop(p, 0));
+  }
+  ASSERT_EQ(0, queue.size());
+  queue.destroy();
+}
+
 int main(int argc, char *argv[])
 {
   oceanbase::common::ObLogger::get_logger().set_log_level("debug");
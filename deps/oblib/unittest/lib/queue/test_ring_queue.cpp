@@ -0,0 +1,301 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#include "lib/queue/ob_ring_queue.h"
+#include "lib/time/ob_time_utility.h"
+#include "lib/oblog/ob_log.h"
+#include <iostream>
+#include <thread>
+#include <vector>
+
+using namespace oceanbase::common;
+using namespace std;
+
+struct QData: public ObLink
+{
+  QData(): val_(0) {}
+  int64_t val_;
+};
+
+TEST(TestRingQueue, spsc)
+{
+  ObSpScRingQueue<QData, 8> queue;
+  QData data[16];
+  QData *p = NULL;
+  ASSERT_EQ(OB_INVALID_ARGUMENT, queue.push(NULL));
+  ASSERT_EQ(OB_EAGAIN, queue.pop(p));
+  ASSERT_TRUE(NULL == queue.top());
+  for (int64_t i = 0; i < 8; i++) {
+    ASSERT_EQ(OB_SUCCESS, queue.push(&data[i]));
+  }
+  ASSERT_EQ(OB_SIZE_OVERFLOW, queue.push(&data[8]));
+  ASSERT_EQ(8, queue.size());
+  ASSERT_EQ(&data[0], queue.top());
+  QData *ps[16] = {};
+  int64_t cnt = 0;
+  ASSERT_EQ(OB_SUCCESS, queue.pop_batch(ps, 3, cnt));
+  ASSERT_EQ(3, cnt);
+  ASSERT_EQ(&data[2], ps[2]);
+  QData *pushs[5] = {&data[8], &data[9], &data[10], &data[11], &data[12]};
+  ASSERT_EQ(OB_SUCCESS, queue.push_batch(pushs, 5, cnt));
+  ASSERT_EQ(3, cnt);
+  ASSERT_EQ(OB_SUCCESS, queue.pop_batch(ps, 16, cnt));
+  ASSERT_EQ(8, cnt);
+  for (int64_t i = 0; i < cnt; i++) {
+    ASSERT_EQ(&data[i + 3], ps[i]);
+  }
+  ASSERT_TRUE(queue.is_empty());
+}
+
+TEST(TestRingQueue, mpmc)
+{
+  ObMpMcRingQueue<QData, 8> queue;
+  QData data[16];
+  QData *p = NULL;
+  ASSERT_EQ(OB_EAGAIN, queue.pop(p));
+  ASSERT_TRUE(NULL == p);
+  QData *pushs[10] = {};
+  for (int64_t i = 0; i < 10; i++) {
+    pushs[i] = &data[i];
+  }
+  int64_t cnt = 0;
+  ASSERT_EQ(OB_SUCCESS, queue.push_batch(pushs, 10, cnt));
+  ASSERT_EQ(8, cnt);
+  ASSERT_EQ(OB_SIZE_OVERFLOW, queue.push(&data[8]));
+  ASSERT_EQ(OB_SUCCESS, queue.pop(p));
+  ASSERT_EQ(&data[0], p);
+  ASSERT_EQ(OB_SUCCESS, queue.push(&data[8]));
+  QData *ps[16] = {};
+  ASSERT_EQ(OB_SUCCESS, queue.pop_batch(ps, 16, cnt));
+  ASSERT_EQ(8, cnt);
+  for (int64_t i = 0; i < cnt; i++) {
+    ASSERT_EQ(&data[i + 1], ps[i]);
+  }
+  ASSERT_EQ(0, queue.size());
+}
+
+TEST(TestRingQueue, mpmc_concurrent)
+{
+  const int64_t thread_cnt = 4;
+  const int64_t cnt_per_thread = 1L << 16;
+  ObMpMcRingQueue<QData, 64> queue;
+  vector<QData> data(thread_cnt * cnt_per_thread);
+  int64_t pop_sum = 0;
+  int64_t pop_cnt = 0;
+  vector<thread> threads;
+  for (int64_t t = 0; t < thread_cnt; t++) {
+    threads.push_back(thread([&, t]() {
+      for (int64_t i = 0; i < cnt_per_thread; i++) {
+        QData *p = &data[t * cnt_per_thread + i];
+        p->val_ = t * cnt_per_thread + i;
+        while (OB_SUCCESS != queue.push(p)) {
+          PAUSE();
+        }
+      }
+    }));
+    threads.push_back(thread([&]() {
+      QData *ps[8];
+      int64_t cnt = 0;
+      while (ATOMIC_LOAD(&pop_cnt) < thread_cnt * cnt_per_thread) {
+        if (OB_SUCCESS == queue.pop_batch(ps, 8, cnt)) {
+          for (int64_t i = 0; i < cnt; i++) {
+            IGNORE_RETURN ATOMIC_AAF(&pop_sum, ps[i]->val_);
+          }
+          IGNORE_RETURN ATOMIC_AAF(&pop_cnt, cnt);
+        }
+      }
+    }));
+  }
+  for (auto &th : threads) {
+    th.join();
+  }
+  const int64_t total = thread_cnt * cnt_per_thread;
+  ASSERT_EQ(total, pop_cnt);
+  ASSERT_EQ(total * (total - 1) / 2, pop_sum);
+  ASSERT_EQ(0, queue.size());
+}
+
+TEST(TestRingQueue, blocking)
+{
+  ObBlockingRingQueue<QData, 8> queue;
+  QData data;
+  QData *p = NULL;
+  ASSERT_EQ(OB_NOT_INIT, queue.push(&data));
+  ASSERT_EQ(OB_SUCCESS, queue.init());
+  ASSERT_EQ(OB_EAGAIN, queue.pop(p, 0));
+  int64_t start_ts = ObTimeUtility::current_time();
+  ASSERT_EQ(OB_EAGAIN, queue.pop(p, 10 * 1000));
+  ASSERT_GE(ObTimeUtility::current_time() - start_ts, 10 * 1000);
+
+  thread pusher([&]() {
+    ::usleep(10 * 1000);
+    ASSERT_EQ(OB_SUCCESS, queue.push(&data));
+  });
+  start_ts = ObTimeUtility::current_time();
+  ASSERT_EQ(OB_SUCCESS, queue.pop(p, 10 * 1000 * 1000));
+  ASSERT_EQ(&data, p);
+  ASSERT_LT(ObTimeUtility::current_time() - start_ts, 5 * 1000 * 1000);
+  pusher.join();
+}
+
+TEST(TestRingQueue, link_ring_spill)
+{
+  ObLinkRingQueue<4> queue;
+  QData data[16];
+  ObLink *p = NULL;
+  ASSERT_EQ(OB_EAGAIN, queue.pop(p));
+  for (int64_t i = 0; i < 10; i++) {
+    ASSERT_EQ(OB_SUCCESS, queue.push(&data[i]));
+  }
+  ASSERT_EQ(10, queue.size());
+  ASSERT_EQ(OB_SUCCESS, queue.pop(p));
+  ASSERT_EQ(&data[0], p);
+  // the ring has room, but pushes go after the spilled ones
+  ASSERT_EQ(OB_SUCCESS, queue.push(&data[10]));
+  for (int64_t i = 1; i <= 10; i++) {
+    ASSERT_EQ(OB_SUCCESS, queue.pop(p));
+    ASSERT_EQ(&data[i], p);
+  }
+  ASSERT_EQ(OB_EAGAIN, queue.pop(p));
+  ASSERT_EQ(0, queue.size());
+}
+
+TEST(TestRingQueue, spsc_link_ring_spill)
+{
+  ObSpScLinkRingQueue<4> queue;
+  QData data[16];
+  ASSERT_TRUE(queue.empty());
+  ASSERT_TRUE(NULL == queue.pop());
+  for (int64_t i = 0; i < 10; i++) {
+    queue.push(&data[i]);
+  }
+  ASSERT_EQ(&data[0], queue.top());
+  ASSERT_EQ(&data[0], queue.pop());
+  // the ring has room, but pushes go after the spilled ones
+  queue.push(&data[10]);
+  for (int64_t i = 1; i <= 10; i++) {
+    ASSERT_EQ(&data[i], queue.top());
+    ASSERT_EQ(&data[i], queue.pop());
+  }
+  ASSERT_TRUE(queue.empty());
+  // the ring is used again once the spill queue is drained
+  queue.push(&data[11]);
+  ASSERT_EQ(&data[11], queue.pop());
+  ASSERT_TRUE(NULL == queue.top());
+}
+
+TEST(TestRingQueue, spsc_link_ring_concurrent)
+{
+  ObSpScLinkRingQueue<8> queue;
+  const int64_t cnt = 1L << 16;
+  std::vector<QData> data(cnt);
+  thread producer([&]() {
+    for (int64_t i = 0; i < cnt; i++) {
+      data[i].val_ = i;
+      queue.push(&data[i]);
+    }
+  });
+  for (int64_t i = 0; i < cnt; i++) {
+    ObLink *p = NULL;
+    while (NULL == (p = queue.pop())) {
+      PAUSE();
+    }
+    ASSERT_EQ(i, static_cast<QData*>(p)->val_);
+  }
+  producer.join();
+  ASSERT_TRUE(queue.empty());
+}
+
+struct LinkQueueWrapper
+{
+  int push(ObLink *p) { return q_.push(p); }
+  int pop(ObLink *&p) { return q_.pop(p); }
+  ObLinkQueue q_;
+};
+
+struct LinkRingQueueWrapper
+{
+  int push(ObLink *p) { return q_.push(p); }
+  int pop(ObLink *&p) { return q_.pop(p); }
+  ObLinkRingQueue<1024> q_;
+};
+
+template <typename Queue>
+int64_t run_perf(const int64_t producer_cnt, const int64_t consumer_cnt, const int64_t cnt_per_producer)
+{
+  Queue *queue = new Queue();
+  const int64_t total = producer_cnt * cnt_per_producer;
+  vector<QData> data(total);
+  int64_t pop_cnt = 0;
+  vector<thread> threads;
+  const int64_t start_ts = ObTimeUtility::current_time();
+  for (int64_t t = 0; t < producer_cnt; t++) {
+    threads.push_back(thread([&, t]() {
+      for (int64_t i = 0; i < cnt_per_producer; i++) {
+        while (OB_SUCCESS != queue->push(&data[t * cnt_per_producer + i])) {
+          PAUSE();
+        }
+      }
+    }));
+  }
+  for (int64_t t = 0; t < consumer_cnt; t++) {
+    threads.push_back(thread([&]() {
+      ObLink *p = NULL;
+      int64_t cnt = 0;
+      while (ATOMIC_LOAD(&pop_cnt) < total) {
+        if (OB_SUCCESS == queue->pop(p)) {
+          static_cast<QData*>(p)->val_++;
+          if (++cnt >= 64) {
+            IGNORE_RETURN ATOMIC_AAF(&pop_cnt, cnt);
+            cnt = 0;
+          }
+        } else if (cnt > 0) {
+          IGNORE_RETURN ATOMIC_AAF(&pop_cnt, cnt);
+          cnt = 0;
+        }
+      }
+    }));
+  }
+  for (auto &th : threads) {
+    th.join();
+  }
+  const int64_t cost_us = ObTimeUtility::current_time() - start_ts;
+  delete queue;
+  return cost_us * 1000 / total;
+}
+
+// benchmark, run by --gtest_also_run_disabled_tests
+TEST(TestRingQueue, DISABLED_perf)
+{
+  const int64_t cnt_per_producer = 1L << 16;
+  const int64_t thread_cnts[] = {1, 2, 4, 8, 16};
+  for (int64_t i = 0; i < ARRAYSIZEOF(thread_cnts); i++) {
+    for (int64_t j = 0; j < ARRAYSIZEOF(thread_cnts); j++) {
+      const int64_t producer_cnt = thread_cnts[i];
+      const int64_t consumer_cnt = thread_cnts[j];
+      cout << "producers=" << producer_cnt
+           << " consumers=" << consumer_cnt
+           << " link_queue_ns_per_op="
+           << run_perf<LinkQueueWrapper>(producer_cnt, consumer_cnt, cnt_per_producer)
+           << " link_ring_queue_ns_per_op="
+           << run_perf<LinkRingQueueWrapper>(producer_cnt, consumer_cnt, cnt_per_producer) << endl;
+    }
+  }
+}
+
+int main(int argc, char *argv[])
+{
+  oceanbase::common::ObLogger::get_logger().set_log_level("INFO");
+  testing::InitGoogleTest(&argc,argv);
+  return RUN_ALL_TESTS();
+}
@@ -258,6 +258,79 @@ TEST(TestTenantMemoryMgr, sync_wash)
   ASSERT_EQ(0, memory_mgr.get_sum_hold());
 }
 
+TEST(TestTenantMemoryMgr, huge_page_advised_hold)
+{
+  const int orig_type = ObLargePageHelper::large_page_type_;
+  ObLargePageHelper::set_param("transparent");
+  oceanbase::lib::set_memory_limit(2L * 1024L * 1024L * 1024L);
+  const int64_t aligned_size = CHUNK_MGR.aligned(ACHUNK_SIZE);
+  FakeCacheWasher washer(1, ACHUNK_SIZE);
+  ObTenantMemoryMgr memory_mgr(1);
+  bool reach_ctx_limit = false;
+  ObMemAttr attr;
+  attr.tenant_id_ = 1;
+  attr.ctx_id_ = ObCtxIds::MEMSTORE_CTX_ID;
+
+  // a washed chunk is uncharged by what it was charged
+  AChunk *chunk = memory_mgr.alloc_chunk(ACHUNK_SIZE, attr);
+  ASSERT_TRUE(NULL != chunk);
+  const bool thp_supported = chunk->is_thp_;
+  const int64_t huge_page_size = thp_supported ? aligned_size : 0;
+  ASSERT_EQ(huge_page_size, memory_mgr.get_huge_page_advised_hold());
+  const int64_t washed_size = 2 * ABLOCK_SIZE;
+  chunk->washed_blks_ = 1;
+  chunk->washed_size_ = washed_size;
+  memory_mgr.update_hold(-washed_size, attr.ctx_id_, attr.label_, reach_ctx_limit);
+  CHUNK_MGR.update_hold(-washed_size, false);
+  ASSERT_EQ(huge_page_size, memory_mgr.get_huge_page_advised_hold());
+  memory_mgr.free_chunk(chunk, attr);
+  ASSERT_EQ(0, memory_mgr.get_huge_page_advised_hold());
+
+  // a chunk to wash stops using huge pages and is uncharged at once
+  chunk = memory_mgr.alloc_chunk(ACHUNK_SIZE, attr);
+  ASSERT_TRUE(NULL != chunk);
+  ASSERT_EQ(huge_page_size, memory_mgr.get_huge_page_advised_hold());
+  memory_mgr.unadvise_huge_page(chunk);
+  ASSERT_FALSE(chunk->is_thp_);
+  ASSERT_EQ(0, memory_mgr.get_huge_page_advised_hold());
+  memory_mgr.free_chunk(chunk, attr);
+  ASSERT_EQ(0, memory_mgr.get_huge_page_advised_hold());
+
+  // a chunk of others is not advised
+  attr.ctx_id_ = ObCtxIds::DEFAULT_CTX_ID;
+  chunk = memory_mgr.alloc_chunk(ACHUNK_SIZE, attr);
+  ASSERT_TRUE(NULL != chunk);
+  ASSERT_FALSE(chunk->is_huge_page());
+  ASSERT_EQ(0, memory_mgr.get_huge_page_advised_hold());
+  memory_mgr.free_chunk(chunk, attr);
+
+  // nor a cache memblock reused by others
+  memory_mgr.set_limit(2 * aligned_size);
+  ASSERT_EQ(OB_SUCCESS, washer.alloc_mb(memory_mgr));
+  ASSERT_EQ(OB_SUCCESS, washer.alloc_mb(memory_mgr));
+  ASSERT_EQ(2 * huge_page_size, memory_mgr.get_huge_page_advised_hold());
+  memory_mgr.set_cache_washer(washer);
+  chunk = memory_mgr.alloc_chunk(ACHUNK_SIZE, attr);
+  ASSERT_TRUE(NULL != chunk);
+  ASSERT_FALSE(chunk->is_huge_page());
+  ASSERT_EQ(huge_page_size, memory_mgr.get_huge_page_advised_hold());
+  memory_mgr.free_chunk(chunk, attr);
+  washer.free_mbs(memory_mgr);
+  ASSERT_EQ(0, memory_mgr.get_huge_page_advised_hold());
+  ASSERT_EQ(0, memory_mgr.get_sum_hold());
+
+  // and a cached chunk is advised again by the hint of its next owner
+  chunk = CHUNK_MGR.alloc_chunk(ACHUNK_SIZE, false, true);
+  ASSERT_TRUE(NULL != chunk);
+  ASSERT_EQ(thp_supported, chunk->is_thp_);
+  CHUNK_MGR.free_chunk(chunk);
+  chunk = CHUNK_MGR.alloc_chunk(ACHUNK_SIZE, false, false);
+  ASSERT_TRUE(NULL != chunk);
+  ASSERT_FALSE(chunk->is_thp_);
+  CHUNK_MGR.free_chunk(chunk);
+  ObLargePageHelper::large_page_type_ = orig_type;
+}
+
 TEST(TestTenantMemoryMgr, DISABLED_large_sync_wash)
 {
   int ret = OB_SUCCESS;
@@ -201,6 +201,73 @@ TEST_F(TestObMySQLUtil, TestPrependZero)
   LOG_INFO("buf", K(ObString(buf)));
 }
 
+// checks the length encoded string of an int cell written at pos 3 of the buffer
+#define CHECK_INT_TEXT(val, is_unsigned, zerofill, zflength, expected) { \
+    memset(buf, 'x', sizeof(buf)); \
+    pos = 3; \
+    const int64_t expected_len = strlen(expected); \
+    ASSERT_EQ(OB_SUCCESS, ObMySQLUtil::int_cell_str(buf, sizeof(buf), val, \
+        is_unsigned ? ObUInt64Type : ObIntType, is_unsigned, TEXT, pos, zerofill, zflength)); \
+    ASSERT_EQ(3 + 1 + expected_len, pos); \
+    EXPECT_EQ('x', buf[2]); \
+    EXPECT_EQ(expected_len, static_cast<uint8_t>(buf[3])); \
+    EXPECT_EQ(0, memcmp(buf + 4, expected, expected_len)); \
+    EXPECT_EQ('x', buf[pos]); \
+}
+
+TEST_F(TestObMySQLUtil, int_cell_str_text)
+{
+  char buf[128];
+  int64_t pos = 0;
+  // digits are formatted in place after the one byte length
+  CHECK_INT_TEXT(0, false, false, 0, "0");
+  CHECK_INT_TEXT(-1, false, false, 0, "-1");
+  CHECK_INT_TEXT(9, false, false, 0, "9");
+  CHECK_INT_TEXT(10, false, false, 0, "10");
+  CHECK_INT_TEXT(INT64_MAX, false, false, 0, "9223372036854775807");
+  CHECK_INT_TEXT(INT64_MIN, false, false, 0, "-9223372036854775808");
+  CHECK_INT_TEXT(-1, true, false, 0, "18446744073709551615");
+  CHECK_INT_TEXT(INT64_MIN, true, false, 0, "9223372036854775808");
+  CHECK_INT_TEXT(0, true, false, 0, "0");
+
+  // zerofill pads to zflength, and never truncates
+  CHECK_INT_TEXT(42, true, true, 5, "00042");
+  CHECK_INT_TEXT(12345, true, true, 5, "12345");
+  CHECK_INT_TEXT(123456, true, true, 5, "123456");
+  CHECK_INT_TEXT(0, true, true, 1, "0");
+  CHECK_INT_TEXT(-1, true, true, 20, "18446744073709551615");
+  CHECK_INT_TEXT(1, true, true, 21, "000000000000000000001");
+
+  // a zerofill length over 250 takes 3 bytes to store
+  char big_buf[512];
+  memset(big_buf, 'x', sizeof(big_buf));
+  pos = 0;
+  ASSERT_EQ(OB_SUCCESS, ObMySQLUtil::int_cell_str(big_buf, sizeof(big_buf), 7, ObUInt64Type, true,
+      TEXT, pos, true, 300));
+  ASSERT_EQ(3 + 300, pos);
+  EXPECT_EQ(252, static_cast<uint8_t>(big_buf[0]));
+  EXPECT_EQ(300, static_cast<uint8_t>(big_buf[1]) | (static_cast<uint8_t>(big_buf[2]) << 8));
+  EXPECT_EQ('0', big_buf[3]);
+  EXPECT_EQ('7', big_buf[302]);
+  EXPECT_EQ('x', big_buf[303]);
+
+  // the buffer must hold the longest int whatever the value, pos is kept on failure
+  const int64_t min_len = OB_LTOA10_CHAR_LEN + 9;
+  pos = 3;
+  ASSERT_EQ(OB_SIZE_OVERFLOW, ObMySQLUtil::int_cell_str(buf, 3 + min_len - 1, 1, ObIntType, false,
+      TEXT, pos, false, 0));
+  ASSERT_EQ(3, pos);
+  ASSERT_EQ(OB_SUCCESS, ObMySQLUtil::int_cell_str(buf, 3 + min_len, INT64_MIN, ObIntType, false,
+      TEXT, pos, false, 0));
+  ASSERT_EQ(3 + 1 + 20, pos);
+  pos = 3;
+  ASSERT_EQ(OB_SIZE_OVERFLOW, ObMySQLUtil::int_cell_str(buf, 3 + 10, 1, ObIntType, false,
+      TEXT, pos, true, 10));
+  ASSERT_EQ(3, pos);
+  ASSERT_EQ(OB_INVALID_ARGUMENT, ObMySQLUtil::int_cell_str(NULL, sizeof(buf), 1, ObIntType, false,
+      TEXT, pos, false, 0));
+}
+
 TEST_F(TestObMySQLUtil, serialize_test)
 {
   const char *tmp_file = "test_mysql_util.tmp";
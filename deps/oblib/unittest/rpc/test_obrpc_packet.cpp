@@ -12,6 +12,7 @@
 
 #include <gtest/gtest.h>
 #include "rpc/obrpc/ob_rpc_packet.h"
+#include "rpc/obrpc/ob_rpc_endec.h"
 
 using namespace oceanbase::rpc;
 using namespace oceanbase::obrpc;
@@ -37,6 +38,46 @@ TEST_F(TestObrpcPacket, NameIndex)
   EXPECT_STREQ("OB_BOOTSTRAP", set.name_of_idx(set.idx_of_pcode(OB_BOOTSTRAP)));
 }
 
+TEST_F(TestObrpcPacket, EncodeInPlace)
+{
+  ObRpcMemPool pool;
+  const int64_t content_size = 1024;
+  const int64_t header_room = oceanbase::common::OB_NET_HEADER_LENGTH + ObRpcPacket::get_header_size();
+  char *pkt_buf = static_cast<char*>(pool.alloc(sizeof(ObRpcPacket) + header_room + content_size));
+  ASSERT_TRUE(NULL != pkt_buf);
+  char *content = pkt_buf + sizeof(ObRpcPacket) + header_room;
+  memset(content, 'x', content_size);
+  ObRpcPacket *pkt = new (pkt_buf) ObRpcPacket();
+  pkt->set_pcode(OB_RENEW_LEASE);
+  pkt->set_content(content, content_size);
+  pkt->calc_checksum();
+
+  // header is encoded into the room reserved before the content
+  char *buf = NULL;
+  int64_t sz = 0;
+  ASSERT_EQ(oceanbase::common::OB_SUCCESS, rpc_encode_ob_packet(pool, pkt, buf, sz));
+  EXPECT_EQ(content - ObRpcPacket::get_header_size(), buf);
+  EXPECT_EQ(pkt->get_encoded_size(), sz);
+  ObRpcPacket *dpkt = NULL;
+  ASSERT_EQ(oceanbase::common::OB_SUCCESS, rpc_decode_ob_packet(pool, buf, sz, dpkt));
+  EXPECT_EQ(OB_RENEW_LEASE, dpkt->get_pcode());
+  EXPECT_EQ(content_size, dpkt->get_clen());
+  EXPECT_EQ(content, dpkt->get_cdata());
+  EXPECT_EQ(oceanbase::common::OB_SUCCESS, dpkt->verify_checksum());
+
+  // content elsewhere is copied
+  ObRpcPacket other_pkt;
+  other_pkt.set_pcode(OB_BOOTSTRAP);
+  other_pkt.set_content(content, content_size);
+  other_pkt.calc_checksum();
+  ASSERT_EQ(oceanbase::common::OB_SUCCESS, rpc_encode_ob_packet(pool, &other_pkt, buf, sz));
+  EXPECT_NE(content - ObRpcPacket::get_header_size(), buf);
+  ASSERT_EQ(oceanbase::common::OB_SUCCESS, rpc_decode_ob_packet(pool, buf, sz, dpkt));
+  EXPECT_EQ(OB_BOOTSTRAP, dpkt->get_pcode());
+  EXPECT_EQ(0, memcmp(content, dpkt->get_cdata(), content_size));
+  EXPECT_EQ(oceanbase::common::OB_SUCCESS, dpkt->verify_checksum());
+}
+
 int main(int argc, char *argv[])
 {
   ::testing::InitGoogleTest(&argc, argv);
@@ -0,0 +1,153 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <poll.h>
+#include <thread>
+#include "rpc/obmysql/ob_sql_nio.h"
+#include "rpc/obmysql/ob_i_sql_sock_handler.h"
+#include "lib/time/ob_time_utility.h"
+
+using namespace oceanbase::common;
+using namespace oceanbase::obmysql;
+
+static const int64_t REQ_SZ = 8;
+static const int64_t SLOW_REQ_US = 1000 * 1000;
+
+// answers request "<id>......." with "r<id>", request 0 fast and the others slowly,
+// the response is written in pieces as a result set larger than the packet buffer is
+class MockSqlSockHandler: public ObISqlSockHandler
+{
+public:
+  explicit MockSqlSockHandler(ObSqlNio &nio): nio_(nio), use_async_write_(false) {}
+  virtual ~MockSqlSockHandler() {}
+  virtual int on_readable(void* sess) override
+  {
+    // requests are handled out of the io thread as the tenant workers do
+    std::thread(&MockSqlSockHandler::handle, this, sess).detach();
+    return OB_SUCCESS;
+  }
+  virtual void on_close(void* sess, int err) override { UNUSED(sess); UNUSED(err); }
+  virtual void on_flushed(void* sess) override { nio_.revert_sock(sess); }
+  virtual int on_connect(void* sess, int fd) override { UNUSED(sess); UNUSED(fd); return OB_SUCCESS; }
+  void set_use_async_write(bool v) { use_async_write_ = v; }
+private:
+  void handle(void* sess)
+  {
+    static const char *ids = "0123456789";
+    const char *buf = NULL;
+    int64_t sz = 0;
+    if (OB_SUCCESS != nio_.peek_data(sess, REQ_SZ, buf, sz)) {
+      nio_.destroy_sock(sess);
+    } else if (sz < REQ_SZ) {
+      nio_.revert_sock(sess);
+    } else {
+      const int64_t id = buf[0] - '0';
+      IGNORE_RETURN nio_.consume_data(sess, REQ_SZ);
+      if (id > 0) {
+        ::usleep(SLOW_REQ_US);
+      }
+      IGNORE_RETURN nio_.write_data(sess, "r", 1);
+      if (use_async_write_) {
+        nio_.async_write_data(sess, ids + id, 1);
+      } else {
+        // the last piece written in place too, as a compressed response may end
+        IGNORE_RETURN nio_.write_data(sess, ids + id, 1);
+        nio_.revert_sock(sess);
+      }
+    }
+  }
+private:
+  ObSqlNio &nio_;
+  bool use_async_write_;
+};
+
+class TestSqlNio: public ::testing::Test
+{
+public:
+  TestSqlNio(): handler_(nio_), port_(0), fd_(-1) {}
+  virtual void SetUp()
+  {
+    // the listen fd outlives the nio, every case listens on its own port
+    static int port_seq = 0;
+    port_ = 30000 + static_cast<int>(getpid() % 10000) + port_seq++;
+    ASSERT_EQ(OB_SUCCESS, nio_.start(port_, &handler_, 1));
+    struct sockaddr_in addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(static_cast<uint16_t>(port_));
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    ASSERT_LE(0, fd_ = socket(AF_INET, SOCK_STREAM, 0));
+    ASSERT_EQ(0, connect(fd_, (struct sockaddr*)&addr, sizeof(addr)));
+  }
+  virtual void TearDown()
+  {
+    // the mock handler keeps no session, stop the io thread before the sock is closed
+    nio_.stop();
+    nio_.wait();
+    close(fd_);
+  }
+  // receive @sz bytes, return how long it takes
+  int64_t recv_all(char *buf, const int64_t sz, const int64_t timeout_us)
+  {
+    const int64_t start_ts = ObTimeUtility::current_time();
+    int64_t pos = 0;
+    while (pos < sz && ObTimeUtility::current_time() - start_ts < timeout_us) {
+      struct pollfd pfd = {fd_, POLLIN, 0};
+      if (poll(&pfd, 1, 10) > 0) {
+        const ssize_t rbytes = recv(fd_, buf + pos, sz - pos, 0);
+        if (rbytes > 0) {
+          pos += rbytes;
+        }
+      }
+    }
+    return pos < sz ? INT64_MAX : ObTimeUtility::current_time() - start_ts;
+  }
+  void test_pipelined()
+  {
+    // the second request is sent before the first one is answered
+    const char *reqs = "0.......1.......";
+    char resp[4] = {0};
+    ASSERT_EQ(2 * REQ_SZ, send(fd_, reqs, 2 * REQ_SZ, 0));
+    // the first response is not held back until the slow second request is done
+    ASSERT_LT(recv_all(resp, 2, 10 * SLOW_REQ_US), SLOW_REQ_US / 2);
+    ASSERT_EQ(0, memcmp(resp, "r0", 2));
+    ASSERT_LT(recv_all(resp, 2, 10 * SLOW_REQ_US), 10 * SLOW_REQ_US);
+    ASSERT_EQ(0, memcmp(resp, "r1", 2));
+  }
+protected:
+  ObSqlNio nio_;
+  MockSqlSockHandler handler_;
+  int port_;
+  int fd_;
+};
+
+TEST_F(TestSqlNio, pipelined_response_not_held)
+{
+  handler_.set_use_async_write(false);
+  test_pipelined();
+}
+
+TEST_F(TestSqlNio, pipelined_response_not_held_async)
+{
+  handler_.set_use_async_write(true);
+  test_pipelined();
+}
+
+int main(int argc, char *argv[])
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
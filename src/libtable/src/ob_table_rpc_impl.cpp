@@ -14,6 +14,8 @@
 #include "ob_table_rpc_impl.h"
 #include "share/table/ob_table_rpc_proxy.h"               // ObTableRpcProxy
 #include "share/ob_tenant_mgr.h"
+#include "lib/wait_event/ob_wait_event.h"
+#include "rpc/obrpc/ob_rpc_packet.h"
 using namespace oceanbase::table;
 using namespace oceanbase::common;
 using namespace oceanbase::share;
@@ -25,13 +27,19 @@ ObTableRpcImpl::ObTableRpcImpl()
      default_entity_factory_(ObModIds::TEST),
      entity_factory_(&default_entity_factory_),
      arena_(ObModIds::TABLE_CLIENT),
-     rpc_proxy_(NULL)
+     rpc_proxy_(NULL),
+     batch_cbs_(),
+     batch_cond_(),
+     batch_seq_(0),
+     batch_response_count_(0)
 {
   table_name_buf_[0] = '\0';
 }
 
 ObTableRpcImpl::~ObTableRpcImpl()
-{}
+{
+  free_batch_cbs();
+}
 
 int ObTableRpcImpl::init(ObTableServiceClient &client, const ObString &table_name)
 {
@@ -43,6 +51,8 @@ int ObTableRpcImpl::init(ObTableServiceClient &client, const ObString &table_nam
     LOG_WARN("failed to get table id", K(ret), K(table_name));
   } else if (OB_FAIL(ob_write_string(buff, table_name, table_name_))) {
     LOG_WARN("failed to store table name", K(ret), K(table_name));
+  } else if (OB_FAIL(batch_cond_.init(ObWaitEventIds::ASYNC_RPC_PROXY_COND_WAIT))) {
+    LOG_WARN("failed to init batch cond", K(ret));
   } else {
     client_ = &client;
     rpc_proxy_ = &client.get_table_rpc_proxy();
@@ -102,12 +112,47 @@ int ObTableRpcImpl::execute(const ObTableOperation &table_operation, const ObTab
               timeout(request_options.server_timeout())
               .to(leader_loc.get_server())
               .execute(request, result);
+        if (need_renew_location(ret)) {
+          // the cached leader is stale, renew it and resend once
+          ObAddr leader;
+          if (OB_FAIL(renew_leader(tablet_id, leader))) {
+            LOG_WARN("failed to renew leader", K(ret), K(tablet_id));
+          } else {
+            ret = rpc_proxy_->
+                  timeout(request_options.server_timeout())
+                  .to(leader)
+                  .execute(request, result);
+          }
+        }
       }
     }
   }
   return ret;
 }
 
+bool ObTableRpcImpl::need_renew_location(int err)
+{
+  return OB_NOT_MASTER == err
+      || OB_TABLET_NOT_EXIST == err
+      || OB_LS_NOT_EXIST == err
+      || OB_PARTITION_NOT_EXIST == err;
+}
+
+int ObTableRpcImpl::renew_leader(const ObTabletID &tablet_id, ObAddr &leader)
+{
+  int ret = OB_SUCCESS;
+  ObTabletLocation tablet_loc;
+  ObTabletReplicaLocation leader_loc;
+  if (OB_FAIL(client_->renew_tablet_location(table_name_, table_id_, tablet_id, tablet_loc))) {
+    LOG_WARN("failed to renew tablet location", K(ret), K_(table_name), K(tablet_id));
+  } else if (OB_FAIL(tablet_loc.get_leader(leader_loc))) {
+    LOG_WARN("failed to find leader location", K(ret), K(tablet_loc));
+  } else {
+    leader = leader_loc.get_server();
+  }
+  return ret;
+}
+
 int ObTableRpcImpl::get_rowkeys(const ObTableBatchOperation &batch_operation, ObIArray<ObRowkey> &rowkeys)
 {
   int ret = OB_SUCCESS;
@@ -311,99 +356,371 @@ int ObTableRpcImpl::batch_execute(const ObTableBatchOperation &batch_operation,
               timeout(request_options.server_timeout())
               .to(server)
               .batch_execute(request, batch_result);
+        if (need_renew_location(ret)) {
+          // the cached leader is stale, renew it and resend once
+          ObAddr leader;
+          if (OB_FAIL(renew_leader(request.tablet_id_, leader))) {
+            LOG_WARN("failed to renew leader", K(ret), "tablet_id", request.tablet_id_);
+          } else {
+            ret = rpc_proxy_->
+                  timeout(request_options.server_timeout())
+                  .to(leader)
+                  .batch_execute(request, batch_result);
+          }
+        }
         NG_TRACE(tag1);
+      } else if (OB_FAIL(multi_tablets_batch_execute(batch_operation, request_options, servers,
+                                                     tablets_per_server, tablet_ids, rowkeys_per_tablet,
+                                                     request, result))) {
+        LOG_WARN("failed to execute multi tablets batch", K(ret), "server_num", N);
       } else {
-        // multi tablets
-        ObSEArray<ObTableBatchOperationResult*, 3> servers_results(ObModIds::TABLE_CLIENT, OB_MALLOC_NORMAL_BLOCK_SIZE);
-        // table operation index -> (server index, server operation index)
-        BatchResultIdxMap result_idx_map;
-        static const int64_t MAP_BUCKET_SIZE = 512;
-        if (OB_FAIL(result_idx_map.create(MAP_BUCKET_SIZE, ObModIds::TABLE_CLIENT, ObModIds::TABLE_CLIENT))) {
-          LOG_WARN("failed to init map", K(ret));
-        } else {
-          result.reset();
+        NG_TRACE(tag2);
+      }
+    }
+  }
+  // FORCE_PRINT_TRACE(THE_TRACE, "[BATCH EXECUTE]");
+  return ret;
+}
+
+int ObTableRpcImpl::build_tablet_batch(const ObTableBatchOperation &batch_operation,
+                                       const sql::RowkeyArray &rowkey_array,
+                                       ObTableBatchOperation &tablet_batch)
+{
+  int ret = OB_SUCCESS;
+  tablet_batch.reset();
+  const int64_t rowkey_count = rowkey_array.count();
+  for (int64_t k = 0; OB_SUCCESS == ret && k < rowkey_count; ++k)
+  {
+    const int64_t rowkey_idx = rowkey_array.at(k);
+    if (rowkey_idx < 0 || rowkey_idx >= batch_operation.count()) {
+      ret = OB_INDEX_OUT_OF_RANGE;
+      LOG_WARN("invalid rowkey index", K(ret), K(rowkey_idx), "total", batch_operation.count());
+    } else if (OB_FAIL(tablet_batch.add(batch_operation.at(rowkey_idx)))) {
+      LOG_WARN("failed to push back", K(ret));
+    }
+  } // end for
+  return ret;
+}
+
+// Post the request of every tablet without waiting for the previous one, then wait for
+// all of them. Requests answered by a stale leader are resent once after renewing the
+// location of their tablet.
+int ObTableRpcImpl::multi_tablets_batch_execute(const ObTableBatchOperation &batch_operation,
+                                                const ObTableRequestOptions &request_options,
+                                                const ObIArray<ObAddr> &servers,
+                                                const ObIArray<IdxArray> &tablets_per_server,
+                                                const ObIArray<ObTabletID> &tablet_ids,
+                                                const ObIArray<sql::RowkeyArray> &rowkeys_per_tablet,
+                                                ObTableBatchOperationRequest &request,
+                                                ObITableBatchOperationResult &result)
+{
+  int ret = OB_SUCCESS;
+  ObSEArray<ObTableBatchOperationResult*, 3> servers_results(ObModIds::TABLE_CLIENT, OB_MALLOC_NORMAL_BLOCK_SIZE);
+  // table operation index -> (tablet request index, operation index in that request)
+  BatchResultIdxMap result_idx_map;
+  static const int64_t MAP_BUCKET_SIZE = 512;
+  ObSEArray<BatchExecuteCB*, 4> cbs;
+  int64_t posted_count = 0;
+  if (OB_FAIL(result_idx_map.create(MAP_BUCKET_SIZE, ObModIds::TABLE_CLIENT, ObModIds::TABLE_CLIENT))) {
+    LOG_WARN("failed to init map", K(ret));
+  } else {
+    result.reset();
+    begin_batch();
+  }
+  const int64_t N = servers.count();
+  LOG_DEBUG("begin multi batch operation", "server_num", N);
+  for (int64_t i = 0; OB_SUCCESS == ret && i < N; ++i)  // for each server
+  {
+    const ObAddr &server = servers.at(i);
+    const IdxArray &tablets_idx_array = tablets_per_server.at(i);
+    const int64_t tablet_num_of_server = tablets_idx_array.count();
+    for (int64_t j = 0; OB_SUCCESS == ret && j < tablet_num_of_server; ++j)  // for each tablet of the server
+    {
+      const int64_t tablet_idx = tablets_idx_array.at(j);
+      const int64_t request_idx = servers_results.count();
+      BatchExecuteCB *cb = NULL;
+      bool posted = false;
+      ObTableBatchOperationResult *server_batch_result = NULL;
+      if (tablet_idx < 0 || tablet_idx >= tablet_ids.count()) {
+        ret = OB_INDEX_OUT_OF_RANGE;
+        LOG_WARN("invalid tablet index", K(ret), K(tablet_idx), "tablet_num", tablet_ids.count());
+      } else if (NULL == (server_batch_result = OB_NEW(ObTableBatchOperationResult, ObModIds::TABLE_CLIENT))) {
+        ret = OB_ALLOCATE_MEMORY_FAILED;
+        LOG_WARN("no memory", K(ret));
+      } else if (OB_FAIL(servers_results.push_back(server_batch_result))) {
+        LOG_WARN("failed to push back", K(ret));
+        ob_delete(server_batch_result);
+      } else if (OB_FAIL(alloc_batch_cb(cb))) {
+        LOG_WARN("failed to alloc batch callback", K(ret), K(request_idx));
+      } else if (OB_FAIL(cbs.push_back(cb))) {
+        LOG_WARN("failed to push back", K(ret));
+      } else if (OB_FAIL(build_tablet_batch(batch_operation, rowkeys_per_tablet.at(tablet_idx),
+                                            request.batch_operation_))) {
+        LOG_WARN("failed to build tablet batch", K(ret), K(tablet_idx));
+      } else {
+        server_batch_result->set_entity_factory(entity_factory_);
+        server_batch_result->set_allocator(&arena_);  // have to deep copy values from the rpc memory
+        const sql::RowkeyArray &rowkey_array = rowkeys_per_tablet.at(tablet_idx);
+        for (int64_t k = 0; OB_SUCCESS == ret && k < rowkey_array.count(); ++k) {
+          if (OB_FAIL(result_idx_map.set_refactored(rowkey_array.at(k), std::make_pair(request_idx, k), 0))) {
+            LOG_WARN("failed to record result idx", K(ret));
+          }
         }
-        LOG_DEBUG("begin multi batch operation", "server_num", N);
-        for (int64_t i = 0; OB_SUCCESS == ret && i < N; ++i)  // for each server
-        {
-          const ObAddr &server = servers.at(i);
-          const IdxArray &tablets_idx_array = tablets_per_server.at(i);
-          const int64_t tablet_num_of_server = tablets_idx_array.count();
-          for (int64_t j = 0; OB_SUCCESS == ret && j < tablet_num_of_server; ++j)  // for each tablet of the server
-          {
-            const int64_t tablet_idx = tablets_idx_array.at(j);
-            if (tablet_idx < 0 || tablet_idx >= tablet_ids.count()) {
-              ret = OB_INDEX_OUT_OF_RANGE;
-              LOG_WARN("invalid tablet index", K(ret), K(tablet_idx), "tablet_num", tablet_ids.count());
-            } else {
-              // send batch for each tablet of each server
-              request.tablet_id_ = tablet_ids.at(tablet_idx);
-              request.batch_operation_.reset();
-              ObTableBatchOperationResult *server_batch_result = OB_NEW(ObTableBatchOperationResult, ObModIds::TABLE_CLIENT);
-              if (NULL == server_batch_result) {
-                ret = OB_ALLOCATE_MEMORY_FAILED;
-                LOG_WARN("no memory", K(ret));
-              } else if (OB_FAIL(servers_results.push_back(server_batch_result))) {
-                LOG_WARN("failed to push back", K(ret));
-              } else {
-                server_batch_result->set_entity_factory(entity_factory_);
-                server_batch_result->set_allocator(&arena_);  // have to deep copy values from the rpc memory
-                // build batch operation for the tablet
-                const sql::RowkeyArray &rowkey_array = rowkeys_per_tablet.at(tablet_idx);
-                const int64_t rowkey_count = rowkey_array.count();
-                for (int64_t k = 0; OB_SUCCESS == ret && k < rowkey_count; ++k)
-                {
-                  int64_t rowkey_idx = rowkey_array.at(k);
-                  if (rowkey_idx < 0 || rowkey_idx >= batch_operation.count()) {
-                    ret = OB_INDEX_OUT_OF_RANGE;
-                    LOG_WARN("invalid rowkey index", K(ret), K(rowkey_idx), "total", rowkey_array.count());
-                  } else if (OB_FAIL(request.batch_operation_.add(batch_operation.at(rowkey_idx)))) {
-                    LOG_WARN("failed to push back", K(ret));
-                  } else if (OB_FAIL(result_idx_map.set_refactored(rowkey_idx, std::make_pair(servers_results.count()-1, k), 0))) {
-                    LOG_WARN("failed to record result idx", K(ret));
-                  } else {
-                  }
-                } // end for each operation of this tablet
-
-                if (OB_SUCC(ret)) {
-                  LOG_DEBUG("multi batch operation", K(i), K(j), K(server), K(tablet_idx), K(rowkey_array));
-                  // send batch for each tablet of each server
-                  ret = rpc_proxy_->
-                        timeout(request_options.server_timeout())
-                        .to(server)
-                        .batch_execute(request, *server_batch_result);
-                }
-              }
-            }
-          }  // end for each tablet
-        } // end for each server
-
-        // reorder results
         if (OB_SUCC(ret)) {
-          LOG_WARN("finish multi batch operation", "results_num", servers_results.count());
-          if (OB_FAIL(reorder_servers_results(servers_results, result_idx_map, batch_operation.count(), result))) {
-            LOG_WARN("failed to reorder results", K(ret));
-            LOG_WARN("fail tableapi test", K(batch_operation.count()), K(result.count()), K(tablet_ids.count()), K(rowkeys_per_tablet), K(tablets_per_server));
-            LOG_WARN("fail tableapi ttest", K(tablets_locs.count()));
+          LOG_DEBUG("multi batch operation", K(i), K(j), K(server), K(tablet_idx), K(rowkey_array));
+          request.tablet_id_ = tablet_ids.at(tablet_idx);
+          cb->set_tablet_idx(tablet_idx);
+          if (OB_FAIL(rpc_proxy_->
+                      timeout(request_options.server_timeout())
+                      .to(server)
+                      .async_batch_execute(request, cb))) {
+            LOG_WARN("failed to post batch request", K(ret), K(server), K(tablet_idx));
+          } else {
+            posted = true;
+            ++posted_count;
           }
         }
-        // free server_result
-        const int64_t results_count = servers_results.count();
-        for (int64_t i = 0; OB_SUCCESS == ret && i < results_count; ++i)
-        {
-          ObTableBatchOperationResult *server_result = servers_results.at(i);
-          if (NULL != server_result) {
-            ob_delete(server_result);
-          }
-        } // end for
-        NG_TRACE(tag2);
       }
+      if (NULL != cb && !posted) {
+        // nobody will answer it
+        release_batch_cb(*cb);
+      }
+    }  // end for each tablet
+  } // end for each server
+
+  // callbacks may not be touched again until their request is answered, requests still in
+  // flight at the deadline are left to the rpc timeout and their callbacks are not reused
+  // before that
+  int wait_ret = wait_batch_responses(posted_count, request_options.server_timeout());
+  if (OB_SUCC(ret) && OB_SUCCESS != wait_ret) {
+    ret = wait_ret;
+    LOG_WARN("failed to wait batch responses", K(ret), K(posted_count));
+  }
+
+  const int64_t request_count = servers_results.count();
+  for (int64_t i = 0; OB_SUCCESS == ret && i < request_count; ++i)
+  {
+    const BatchExecuteCB *cb = cbs.at(i);
+    ObTableBatchOperationResult *server_result = servers_results.at(i);
+    const int rcode = cb->get_ret_code();
+    if (OB_SUCCESS == rcode) {
+      if (OB_FAIL(cb->get_result(*server_result))) {
+        LOG_WARN("failed to decode tablet batch result", K(ret), "tablet_idx", cb->get_tablet_idx());
+      }
+    } else if (need_renew_location(rcode)) {
+      const int64_t tablet_idx = cb->get_tablet_idx();
+      ObAddr leader;
+      if (OB_FAIL(renew_leader(tablet_ids.at(tablet_idx), leader))) {
+        LOG_WARN("failed to renew leader", K(ret), "tablet_id", tablet_ids.at(tablet_idx));
+      } else if (OB_FAIL(build_tablet_batch(batch_operation, rowkeys_per_tablet.at(tablet_idx),
+                                            request.batch_operation_))) {
+        LOG_WARN("failed to build tablet batch", K(ret), K(tablet_idx));
+      } else {
+        request.tablet_id_ = tablet_ids.at(tablet_idx);
+        ret = rpc_proxy_->
+              timeout(request_options.server_timeout())
+              .to(leader)
+              .batch_execute(request, *server_result);
+      }
+    } else {
+      ret = rcode;
+      LOG_WARN("failed to execute tablet batch", K(ret), "tablet_idx", cb->get_tablet_idx());
+    }
+  } // end for
+
+  // reorder results
+  if (OB_SUCC(ret)) {
+    LOG_DEBUG("finish multi batch operation", "results_num", servers_results.count());
+    if (OB_FAIL(reorder_servers_results(servers_results, result_idx_map, batch_operation.count(), result))) {
+      LOG_WARN("failed to reorder results", K(ret), K(batch_operation.count()), K(result.count()),
+               K(tablet_ids.count()), K(rowkeys_per_tablet), K(tablets_per_server));
     }
   }
-  // FORCE_PRINT_TRACE(THE_TRACE, "[BATCH EXECUTE]");
+  // free server_result
+  for (int64_t i = 0; i < servers_results.count(); ++i)
+  {
+    ObTableBatchOperationResult *server_result = servers_results.at(i);
+    if (NULL != server_result) {
+      ob_delete(server_result);
+    }
+  } // end for
   return ret;
 }
 
+int ObTableRpcImpl::alloc_batch_cb(BatchExecuteCB *&cb)
+{
+  int ret = OB_SUCCESS;
+  ObThreadCondGuard guard(batch_cond_);
+  cb = NULL;
+  for (int64_t i = 0; NULL == cb && i < batch_cbs_.count(); ++i) {
+    if (!batch_cbs_.at(i)->is_in_flight()) {
+      cb = batch_cbs_.at(i);
+    }
+  }
+  if (NULL != cb) {
+    cb->reuse();
+  } else if (NULL == (cb = OB_NEW(BatchExecuteCB, ObModIds::TABLE_CLIENT, *this))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("no memory", K(ret));
+  } else if (OB_FAIL(batch_cbs_.push_back(cb))) {
+    LOG_WARN("failed to push back", K(ret));
+    ob_delete(cb);
+    cb = NULL;
+  }
+  if (OB_SUCC(ret)) {
+    cb->set_in_flight(batch_seq_);
+  }
+  return ret;
+}
+
+void ObTableRpcImpl::release_batch_cb(BatchExecuteCB &cb)
+{
+  ObThreadCondGuard guard(batch_cond_);
+  cb.set_answered();
+}
+
+void ObTableRpcImpl::free_batch_cbs()
+{
+  // the rpc layer always answers a posted request, at the latest by its timeout
+  ObThreadCondGuard guard(batch_cond_);
+  for (int64_t i = 0; i < batch_cbs_.count(); ++i) {
+    BatchExecuteCB *cb = batch_cbs_.at(i);
+    while (cb->is_in_flight()) {
+      (void)batch_cond_.wait_us(BATCH_WAIT_INTERVAL_US);
+    }
+    ob_delete(cb);
+  }
+  batch_cbs_.reset();
+}
+
+void ObTableRpcImpl::begin_batch()
+{
+  ObThreadCondGuard guard(batch_cond_);
+  ++batch_seq_;
+  batch_response_count_ = 0;
+}
+
+void ObTableRpcImpl::receive_batch_response(BatchExecuteCB &cb)
+{
+  ObThreadCondGuard guard(batch_cond_);
+  // a late answer of a batch that already timed out must not be counted for the current one
+  if (cb.get_batch_seq() == batch_seq_) {
+    ++batch_response_count_;
+  }
+  cb.set_answered();
+  int tmp_ret = batch_cond_.broadcast();
+  if (OB_SUCCESS != tmp_ret) {
+    LOG_WARN("condition broadcast failed", K(tmp_ret));
+  }
+}
+
+int ObTableRpcImpl::wait_batch_responses(int64_t posted_count, int64_t timeout_us)
+{
+  int ret = OB_SUCCESS;
+  const int64_t abs_timeout_us = ObTimeUtility::current_time() + timeout_us;
+  ObThreadCondGuard guard(batch_cond_);
+  while (OB_SUCC(ret) && batch_response_count_ < posted_count) {
+    const int64_t left_us = abs_timeout_us - ObTimeUtility::current_time();
+    if (left_us <= 0) {
+      ret = OB_TIMEOUT;
+      LOG_WARN("wait batch responses timeout", K(ret), K(posted_count), K_(batch_response_count), K(timeout_us));
+    } else {
+      (void)batch_cond_.wait_us(left_us < BATCH_WAIT_INTERVAL_US ? left_us : BATCH_WAIT_INTERVAL_US);
+    }
+  }
+  return ret;
+}
+
+void ObTableRpcImpl::BatchExecuteCB::reuse()
+{
+  payload_.reset();
+  unis_version_ = 0;
+  arena_.reuse();
+  reset_rcode();
+  tablet_idx_ = -1;
+  ret_code_ = OB_SUCCESS;
+}
+
+rpc::frame::ObReqTransport::AsyncCB *ObTableRpcImpl::BatchExecuteCB::clone(
+    const rpc::frame::SPAlloc &alloc) const
+{
+  UNUSED(alloc);
+  return const_cast<rpc::frame::ObReqTransport::AsyncCB *>(
+      static_cast<const rpc::frame::ObReqTransport::AsyncCB * const>(this));
+}
+
+int ObTableRpcImpl::BatchExecuteCB::decode(void *pkt)
+{
+  int ret = OB_SUCCESS;
+  if (OB_ISNULL(pkt)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("pkt should not be NULL", K(ret));
+  } else {
+    obrpc::ObRpcPacket *rpkt = reinterpret_cast<obrpc::ObRpcPacket*>(pkt);
+    const char *buf = rpkt->get_cdata();
+    const int64_t len = rpkt->get_clen();
+    int64_t pos = 0;
+    unis_version_ = rpkt->get_unis_version();
+    UNIS_VERSION_GUARD(unis_version_);
+    if (OB_FAIL(rpkt->verify_checksum())) {
+      LOG_ERROR("verify checksum fail", K(*rpkt), K(ret));
+    } else if (OB_FAIL(rcode_.deserialize(buf, len, pos))) {
+      LOG_WARN("decode result code fail", K(*rpkt), K(ret));
+    } else if (OB_SUCCESS != rcode_.rcode_) {
+      // nothing to keep
+    } else if (OB_FAIL(ob_write_string(arena_, ObString(len - pos, buf + pos), payload_))) {
+      LOG_WARN("failed to copy response payload", K(ret), K(len), K(pos));
+    }
+  }
+  return ret;
+}
+
+int ObTableRpcImpl::BatchExecuteCB::get_result(ObTableBatchOperationResult &result) const
+{
+  int ret = OB_SUCCESS;
+  int64_t pos = 0;
+  UNIS_VERSION_GUARD(unis_version_);
+  if (OB_FAIL(result.deserialize(payload_.ptr(), payload_.length(), pos))) {
+    LOG_WARN("failed to deserialize batch result", K(ret), "len", payload_.length());
+  }
+  return ret;
+}
+
+int ObTableRpcImpl::BatchExecuteCB::process()
+{
+  // rcode_ is reset by the rpc layer after process(), keep a copy for the caller
+  ret_code_ = rcode_.rcode_;
+  owner_.receive_batch_response(*this);
+  return OB_SUCCESS;
+}
+
+void ObTableRpcImpl::BatchExecuteCB::on_timeout()
+{
+  LOG_WARN("batch execute timeout", "dst", dst_, "rcode", rcode_.rcode_);
+  ret_code_ = OB_TIMEOUT;
+  owner_.receive_batch_response(*this);
+}
+
+void ObTableRpcImpl::BatchExecuteCB::on_invalid()
+{
+  ret_code_ = OB_RPC_PACKET_INVALID;
+  owner_.receive_batch_response(*this);
+}
+
+int ObTableRpcImpl::BatchExecuteCB::on_error(int err)
+{
+  if (EASY_CLUSTER_ID_MISMATCH == err) {
+    ret_code_ = rcode_.rcode_;
+  } else if (EASY_OK == err || EASY_TIMEOUT == err) {
+    ret_code_ = OB_TIMEOUT;
+  } else {
+    ret_code_ = OB_RPC_CONNECT_ERROR;
+  }
+  LOG_WARN("batch execute failed", "dst", dst_, K(err), K_(ret_code));
+  owner_.receive_batch_response(*this);
+  return OB_SUCCESS;
+}
+
 ObTableRpcImpl::QueryMultiResult::~QueryMultiResult()
 {
   reset();
@@ -474,6 +791,11 @@ int ObTableRpcImpl::execute_query(const ObTableQuery &query, const ObTableReques
     } else {
       ObTableQueryRequest request;
       request.query_ = query;  // @todo FIXME
+      if (query.get_max_result_size() <= 0 && request_options.query_result_size() > 0) {
+        // the server scans the next packet while this one is in flight,
+        // a bounded packet size keeps the pipeline busy for large scans
+        (void)request.query_.set_max_result_size(request_options.query_result_size());
+      }
       request.table_name_ = table_name_;
       request.table_id_ = table_id_;
       request.tablet_id_ = tablet_id;
@@ -559,6 +881,9 @@ int ObTableRpcImpl::query_start(const ObTableQuery& query, const ObTableRequestO
     } else {
       ObTableQuerySyncRequest request;
       request.query_ = query;
+      if (query.get_max_result_size() <= 0 && request_options.query_result_size() > 0) {
+        (void)request.query_.set_max_result_size(request_options.query_result_size());
+      }
       request.table_name_ = table_name_;
       request.table_id_ = table_id_; 
       request.tablet_id_ = tablet_id;
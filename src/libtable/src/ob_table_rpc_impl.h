@@ -16,6 +16,7 @@
 #include "ob_table_service_client.h"
 #include "share/table/ob_table_rpc_struct.h"
 #include "share/table/ob_table_rpc_proxy.h"               // ObTableRpcProxy
+#include "lib/lock/ob_thread_cond.h"
 namespace oceanbase
 {
 namespace table
@@ -96,6 +97,56 @@ private:
     DISALLOW_COPY_AND_ASSIGN(QuerySyncMultiResult);
   };
 
+  typedef obrpc::ObTableRpcProxy::AsyncCB<obrpc::OB_TABLE_API_BATCH_EXECUTE> BatchExecuteAsyncCB;
+  // callback of one in-flight per-tablet batch request. The io thread only keeps a copy of
+  // the response payload; it is decoded by the caller because entity factories are not
+  // thread-safe.
+  class BatchExecuteCB: public BatchExecuteAsyncCB
+  {
+  public:
+    explicit BatchExecuteCB(ObTableRpcImpl &owner)
+        :owner_(owner),
+         tablet_idx_(-1),
+         arena_(common::ObModIds::TABLE_CLIENT),
+         payload_(),
+         unis_version_(0),
+         ret_code_(common::OB_SUCCESS),
+         batch_seq_(0),
+         in_flight_(false)
+    {}
+    virtual ~BatchExecuteCB() = default;
+    void reuse();
+    virtual void set_args(const Request &args) override { UNUSED(args); }
+    virtual rpc::frame::ObReqTransport::AsyncCB *clone(const rpc::frame::SPAlloc &alloc) const override;
+    virtual int decode(void *pkt) override;
+    virtual int process() override;
+    virtual void on_timeout() override;
+    virtual void on_invalid() override;
+    // map the transport error to an error code, exactly once
+    virtual int on_error(int err) override;
+
+    int get_ret_code() const { return ret_code_; }
+    int get_result(ObTableBatchOperationResult &result) const;
+    void set_tablet_idx(int64_t tablet_idx) { tablet_idx_ = tablet_idx; }
+    int64_t get_tablet_idx() const { return tablet_idx_; }
+    // protected by the batch_cond_ of the owner
+    void set_in_flight(int64_t batch_seq) { batch_seq_ = batch_seq; in_flight_ = true; }
+    void set_answered() { in_flight_ = false; }
+    bool is_in_flight() const { return in_flight_; }
+    int64_t get_batch_seq() const { return batch_seq_; }
+  private:
+    ObTableRpcImpl &owner_;
+    int64_t tablet_idx_;
+    common::ObArenaAllocator arena_;
+    common::ObString payload_;
+    uint64_t unis_version_;
+    int ret_code_;
+    int64_t batch_seq_;
+    bool in_flight_;
+    // disallow copy
+    DISALLOW_COPY_AND_ASSIGN(BatchExecuteCB);
+  };
+
 private:
   ObTableRpcImpl();
   virtual ~ObTableRpcImpl();
@@ -107,6 +158,27 @@ private:
                               const BatchResultIdxMap &result_idx_map,
                               int64_t results_count,
                               ObITableBatchOperationResult &result);
+  int build_tablet_batch(const ObTableBatchOperation &batch_operation,
+                         const sql::RowkeyArray &rowkey_array,
+                         ObTableBatchOperation &tablet_batch);
+  int multi_tablets_batch_execute(const ObTableBatchOperation &batch_operation,
+                                  const ObTableRequestOptions &request_options,
+                                  const ObIArray<common::ObAddr> &servers,
+                                  const ObIArray<IdxArray> &tablets_per_server,
+                                  const ObIArray<ObTabletID> &tablet_ids,
+                                  const ObIArray<sql::RowkeyArray> &rowkeys_per_tablet,
+                                  ObTableBatchOperationRequest &request,
+                                  ObITableBatchOperationResult &result);
+  int alloc_batch_cb(BatchExecuteCB *&cb);
+  void release_batch_cb(BatchExecuteCB &cb);
+  void free_batch_cbs();
+  void begin_batch();
+  void receive_batch_response(BatchExecuteCB &cb);
+  int wait_batch_responses(int64_t posted_count, int64_t timeout_us);
+  int renew_leader(const ObTabletID &tablet_id, common::ObAddr &leader);
+  // the routing cache is stale if the server answered with one of these errors,
+  // and the request was not executed so it is safe to resend it to the new leader
+  static bool need_renew_location(int err);
 private:
   bool inited_;
   ObTableServiceClient *client_;
@@ -119,6 +191,13 @@ private:
   obrpc::ObTableRpcProxy *rpc_proxy_;
   QueryMultiResult query_multi_result_;
   QuerySyncMultiResult query_sync_multi_result_;
+  static const int64_t BATCH_WAIT_INTERVAL_US = 100 * 1000;  // 100ms
+  // callbacks of the per-tablet requests of a multi-tablet batch, reused across calls once
+  // answered
+  common::ObSEArray<BatchExecuteCB*, 4> batch_cbs_;
+  common::ObThreadCond batch_cond_;
+  int64_t batch_seq_;
+  int64_t batch_response_count_;
   // disallow copy
   DISALLOW_COPY_AND_ASSIGN(ObTableRpcImpl);
 };
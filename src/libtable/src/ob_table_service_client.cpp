@@ -353,6 +353,8 @@ public:
   int get_tablet_location(const ObString &table_name, const ObString &index_name,
                           const common::ObNewRange &index_prefix, ObTabletLocation &tablet_location,
                           uint64_t &table_id, ObTabletID &tablet_id);
+  int renew_tablet_location(const ObString &table_name, uint64_t table_id, ObTabletID tablet_id,
+                            ObTabletLocation &tablet_location);
   // schema service
   int get_rowkey_columns(const ObString &table_name, common::ObStrings &rowkey_columns);
   int get_table_id(const ObString &table_name, uint64_t &table_id);
@@ -971,6 +973,24 @@ int ObTableServiceClientImpl::get_tablet_location(const ObString &table_name, co
   return ret;
 }
 
+int ObTableServiceClientImpl::renew_tablet_location(const ObString &table_name, uint64_t table_id,
+                                                    ObTabletID tablet_id, ObTabletLocation &tablet_location)
+{
+  int ret = OB_SUCCESS;
+  const bool force_renew = true;
+  if (!inited_) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("not init", K(ret));
+  } else if (OB_FAIL(client_env_->get_location_getter().get_tablet_location(tenant_name_, tenant_id_, database_name_, table_name,
+                                                                              table_id, tablet_id, force_renew,
+                                                                              tablet_location))) {
+    LOG_WARN("failed to renew location", K(ret), K(table_name), K(table_id), K(tablet_id));
+  } else {
+    LOG_INFO("[LOCATION] renew tablet location", K(table_name), K(tablet_id), K(tablet_location));
+  }
+  return ret;
+}
+
 } // end namespace table
 } // end namespace oceanbase
 
@@ -1080,6 +1100,12 @@ int ObTableServiceClient::get_tablet_location(const ObString &table_name, const
   return impl_.get_tablet_location(table_name, index_name, index_prefix, tablet_location, table_id, tablet_id);
 }
 
+int ObTableServiceClient::renew_tablet_location(const ObString &table_name, uint64_t table_id,
+                                                ObTabletID tablet_id, ObTabletLocation &tablet_location)
+{
+  return impl_.renew_tablet_location(table_name, table_id, tablet_id, tablet_location);
+}
+
 int ObTableServiceClient::get_rowkey_columns(const ObString &table_name, common::ObStrings &rowkey_columns)
 {
   return impl_.get_rowkey_columns(table_name, rowkey_columns);
@@ -96,6 +96,9 @@ public:
                           const common::ObNewRange &index_prefix,
                           share::ObTabletLocation &tablet_location,
                           uint64_t &table_id, ObTabletID &tablet_id);
+  // bypass the location cache and refresh the entry of the tablet, e.g. after OB_NOT_MASTER
+  int renew_tablet_location(const ObString &table_name, uint64_t table_id, ObTabletID tablet_id,
+                            share::ObTabletLocation &tablet_location);
   // schema service
   int get_rowkey_columns(const ObString &table_name, common::ObStrings &rowkey_columns);
   int get_table_id(const ObString &table_name, uint64_t &table_id);
@@ -24,6 +24,7 @@
 #include "lib/lock/ob_spin_lock.h"
 #include "lib/lock/ob_spin_rwlock.h"
 #include "lib/queue/ob_link_queue.h"
+#include "lib/queue/ob_ring_queue.h"
 #include "lib/thread/ob_thread_lease.h"
 #include "lib/utility/ob_print_utils.h"
 #include "share/ob_define.h"
@@ -346,6 +347,7 @@ private:
 class ObReplayServiceReplayTask : public ObReplayServiceTask
 {
 public:
+  static const int64_t REPLAY_TASK_RING_SIZE = 64;
   typedef common::ObLink Link;
   typedef common::SpinRWLock RWLock;
   typedef common::SpinRLockGuard RLockGuard;
@@ -391,7 +393,9 @@ private:
     return queue_.pop();
   }
 private:
-  common::ObSpScLinkQueue queue_;   //place ObLogReplayTask
+  // place ObLogReplayTask, pushed by the submit task and popped by the replay worker, each
+  // of them held by one thread at a time. The ring covers the usual backlog of a queue.
+  common::ObSpScLinkRingQueue<REPLAY_TASK_RING_SIZE> queue_;
   int64_t idx_; //热点行优化
 };
 
@@ -131,11 +131,17 @@ int ObQueryDriver::response_query_result(ObResultSet &result,
   bool is_packed = result.get_physical_plan() ? result.get_physical_plan()->is_packed() : false;
   MYSQL_PROTOCOL_TYPE protocol_type = is_ps_protocol ? BINARY : TEXT;
   const common::ColumnsFieldIArray *fields = NULL;
+  // session states used to encode every row are fetched once for the whole result set
+  const ObDataTypeCastParams dtc_params = ObBasicSessionInfo::create_dtc_params(&session_);
+  ObCharsetType result_charset = CHARSET_INVALID;
+  ObArenaAllocator *convert_allocator = NULL;
   if (OB_SUCC(ret)) {
     fields = result.get_field_columns();
     if (OB_ISNULL(fields)) {
       ret = OB_INVALID_ARGUMENT;
       LOG_WARN("fields is null", K(ret), KP(fields));
+    } else if (OB_FAIL(result.get_session().get_character_set_results(result_charset))) {
+      LOG_WARN("fail to get result charset", K(ret));
     }
   }
   while (OB_SUCC(ret) && row_num < limit_count && !OB_FAIL(result.get_next_row(result_row)) ) {
@@ -170,7 +176,17 @@ int ObQueryDriver::response_query_result(ObResultSet &result,
       if (OB_SUCC(ret) && !is_packed) {
         if (ob_is_string_type(value.get_type())
                   && CS_TYPE_INVALID != value.get_collation_type()) {
-          OZ(convert_string_value_charset(value, result));
+          if (ObCharset::charset_type_by_coll(value.get_collation_type()) == result_charset) {
+            // already in the charset of results, skip the conversion
+          } else if (OB_ISNULL(convert_allocator)
+                     && OB_FAIL(result.get_exec_context().get_convert_charset_allocator(convert_allocator))) {
+            LOG_WARN("fail to get convert charset allocator", K(ret));
+          } else if (OB_ISNULL(convert_allocator)) {
+            ret = OB_ERR_UNEXPECTED;
+            LOG_WARN("convert charset allocator is null", K(ret), K(value));
+          } else {
+            OZ(convert_string_value_charset(value, result_charset, *convert_allocator));
+          }
         } else if (value.is_clob_locator()
                   && OB_FAIL(convert_lob_value_charset(value, result))) {
           LOG_WARN("convert lob value charset failed", K(ret));
@@ -183,7 +199,6 @@ int ObQueryDriver::response_query_result(ObResultSet &result,
       }
     }
     if (OB_SUCC(ret)) {
-      const ObDataTypeCastParams dtc_params = ObBasicSessionInfo::create_dtc_params(&session_);
       ObSMRow sm(protocol_type, *row, dtc_params,
                          result.get_field_columns(),
                          ctx_.schema_guard_,
@@ -444,6 +444,7 @@ int ObMPQuery::try_batched_multi_stmt_optimization(sql::ObSQLSessionInfo &sessio
   bool force_sync_resp = true;
   bool enable_batch_opt = session.is_enable_batched_multi_statement();
   bool use_plan_cache = session.get_local_ob_enable_plan_cache();
+  bool is_homogeneous = false;
   optimization_done = false;
   if (queries.count() <= 1 || parse_stat.parse_fail_) {
     /*do nothing*/
@@ -451,6 +452,13 @@ int ObMPQuery::try_batched_multi_stmt_optimization(sql::ObSQLSessionInfo &sessio
     // 未打开batch开关
   } else if (!use_plan_cache) {
     // 不打开plan_cache开关，则优化不支持
+  } else if (!is_ins_multi_val_opt
+             && OB_FAIL(ObParser::check_is_homogeneous_dml(queries, is_homogeneous))) {
+    // queries reconstructed from multi-values insert are homogeneous already
+    LOG_WARN("failed to check homogeneous multi_stmt", K(ret));
+  } else if (!is_ins_multi_val_opt && !is_homogeneous) {
+    // 语句类型不一致时batch一定会回滚，直接跳过，避免额外的一次硬解析
+    EVENT_INC(SQL_BATCHED_MULTI_STMT_SKIP_COUNT);
   } else if (OB_FAIL(process_single_stmt(ObMultiStmtItem(false, 0, sql_, &queries, is_ins_multi_val_opt),
                                          session,
                                          has_more,
@@ -459,15 +467,17 @@ int ObMPQuery::try_batched_multi_stmt_optimization(sql::ObSQLSessionInfo &sessio
                                          need_disconnect))) {
     if (OB_BATCHED_MULTI_STMT_ROLLBACK == ret) {
       ret = OB_SUCCESS;
+      EVENT_INC(SQL_BATCHED_MULTI_STMT_ROLLBACK_COUNT);
       LOG_TRACE("batched multi_stmt needs rollback", K(ret));
     } else {
       LOG_WARN("failed to process single stmt", K(ret));
     }
   } else {
     optimization_done = true;
+    EVENT_INC(SQL_BATCHED_MULTI_STMT_COUNT);
   }
   LOG_TRACE("succeed to try batched multi-stmt optimization", K(optimization_done),
-            K(ret), K(queries.count()), K(enable_batch_opt));
+            K(ret), K(queries.count()), K(enable_batch_opt), K(is_homogeneous));
   return ret;
 }
 
@@ -1532,12 +1532,14 @@ int ObMPStmtExecute::try_batch_multi_stmt_optimization(ObSQLSessionInfo &session
     // 调用do_single接口
     if (OB_BATCHED_MULTI_STMT_ROLLBACK == ret) {
       LOG_TRACE("batched multi_stmt needs rollback", K(ret));
+      EVENT_INC(SQL_BATCHED_MULTI_STMT_ROLLBACK_COUNT);
       ret = OB_SUCCESS;
     } else {
       LOG_WARN("failed to process single stmt", K(ret));
     }
   } else {
     optimization_done = true;
+    EVENT_INC(SQL_BATCHED_MULTI_STMT_COUNT);
   }
   LOG_TRACE("after try batched multi-stmt optimization", K(ret), K(stmt_type_), K(use_plan_cache),
       K(optimization_done), K(enable_batch_opt), K(is_ab_returning), K(arraybinding_size_));
@@ -16,6 +16,8 @@
 
 #include "lib/oblog/ob_log.h"
 #include "lib/alloc/ob_malloc_allocator.h"
+#include "lib/alloc/alloc_func.h"
+#include "lib/cpu/ob_cpu_topology.h"
 #include "lib/ob_running_mode.h"
 #include "lib/file/file_directory_utils.h"
 #include "share/ob_tenant_mgr.h"
@@ -1909,8 +1911,12 @@ void ObMultiTenant::set_group_sug_token()
       //set suggestion token for each tenant, all tenant use the fixed token.
       if (!(*it)->has_stopped()) { // skip stopped tenant
         ObTenantConfigGuard tenant_config(TENANT_CONF((*it)->id()));
+        // with block compensation, workers beyond one per cpu are only added for blocked ones
+        const bool block_compensation = tenant_config.is_valid()
+            && tenant_config->_enable_worker_block_compensation;
+        (*it)->set_block_compensation(block_compensation);
         (*it)->set_sug_token(std::max(1L, static_cast<int64_t>((*it)->unit_min_cpu() *
-          (tenant_config.is_valid() ? tenant_config->cpu_quota_concurrency : 4))));
+          (block_compensation ? 1 : (tenant_config.is_valid() ? tenant_config->cpu_quota_concurrency : 4)))));
       }
     }
     if (OB_FAIL(unlock_tenant_list())) {
@@ -1938,6 +1944,10 @@ void ObMultiTenant::run1()
     }
     ob_usleep(TIME_SLICE_PERIOD);
 
+    if (REACH_TIME_INTERVAL(1000000L)) {  // every 1s
+      place_tenants_on_numa_nodes();
+    }
+
     if (REACH_TIME_INTERVAL(30000000L)) {  // every 30s
       SpinRLockGuard guard(lock_);
       for (TenantList::iterator it = tenants_.begin(); it != tenants_.end(); it++) {
@@ -1946,11 +1956,89 @@ void ObMultiTenant::run1()
           LOG_INFO("dump tenant info", "tenant", **it);
         }
       }
+      dump_numa_node_info();
     }
   }
   LOG_INFO("OMT quit");
 }
 
+void ObMultiTenant::place_tenants_on_numa_nodes()
+{
+  const ObNumaTopology &topology = ObNumaTopology::get_instance();
+  const int64_t node_cnt = topology.get_node_cnt();
+  const bool enabled = GCONF._enable_numa_aware_placement && node_cnt > 1;
+  double placed_cpu[ObNumaTopology::MAX_NODE_CNT] = {0};
+  SpinRLockGuard guard(lock_);
+  // keep the tenants which still fit in their nodes, so that their memory stays local
+  for (TenantList::iterator it = tenants_.begin(); it != tenants_.end(); it++) {
+    ObTenant *tenant = *it;
+    if (OB_ISNULL(tenant) || tenant->has_stopped()) {
+      // skip
+    } else {
+      const int64_t node = tenant->get_numa_node();
+      if (ObNumaTopology::INVALID_NODE == node) {
+        // do nothing
+      } else if (!enabled || is_virtual_tenant_id(tenant->id()) || node >= node_cnt
+                 || tenant->unit_max_cpu() > topology.get_node_cpu_cnt(node)) {
+        tenant->set_numa_node(ObNumaTopology::INVALID_NODE);
+        LOG_INFO("unplace tenant from numa node", K(enabled), K(node), "tenant_id", tenant->id(),
+                 "max_cpu", tenant->unit_max_cpu(), "node_cpu_cnt", topology.get_node_cpu_cnt(node));
+      } else {
+        placed_cpu[node] += tenant->unit_min_cpu();
+      }
+    }
+  }
+  for (TenantList::iterator it = tenants_.begin(); enabled && it != tenants_.end(); it++) {
+    ObTenant *tenant = *it;
+    if (OB_ISNULL(tenant) || tenant->has_stopped() || is_virtual_tenant_id(tenant->id())
+        || ObNumaTopology::INVALID_NODE != tenant->get_numa_node()) {
+      // skip
+    } else {
+      int64_t best_node = ObNumaTopology::INVALID_NODE;
+      for (int64_t node = 0; node < node_cnt; ++node) {
+        if (tenant->unit_max_cpu() <= topology.get_node_cpu_cnt(node)
+            && (ObNumaTopology::INVALID_NODE == best_node || placed_cpu[node] < placed_cpu[best_node])) {
+          best_node = node;
+        }
+      }
+      if (ObNumaTopology::INVALID_NODE != best_node) {
+        placed_cpu[best_node] += tenant->unit_min_cpu();
+        tenant->set_numa_node(best_node);
+        LOG_INFO("place tenant on numa node", "tenant_id", tenant->id(), "node", best_node,
+                 "min_cpu", tenant->unit_min_cpu(), "max_cpu", tenant->unit_max_cpu(),
+                 "node_placed_cpu", placed_cpu[best_node]);
+      }
+    }
+  }
+}
+
+void ObMultiTenant::dump_numa_node_info()
+{
+  const ObNumaTopology &topology = ObNumaTopology::get_instance();
+  const int64_t node_cnt = topology.get_node_cnt();
+  double placed_cpu[ObNumaTopology::MAX_NODE_CNT] = {0};
+  int64_t placed_hold[ObNumaTopology::MAX_NODE_CNT] = {0};
+  int64_t tenant_cnt[ObNumaTopology::MAX_NODE_CNT] = {0};
+  if (GCONF._enable_numa_aware_placement && node_cnt > 1) {
+    // lock_ is held by the caller
+    for (TenantList::iterator it = tenants_.begin(); it != tenants_.end(); it++) {
+      ObTenant *tenant = *it;
+      const int64_t node = OB_ISNULL(tenant) ? ObNumaTopology::INVALID_NODE : tenant->get_numa_node();
+      if (node >= 0 && node < node_cnt) {
+        placed_cpu[node] += tenant->unit_min_cpu();
+        placed_hold[node] += lib::get_tenant_memory_hold(tenant->id());
+        ++tenant_cnt[node];
+      }
+    }
+    for (int64_t node = 0; node < node_cnt; ++node) {
+      ObTaskController::get().allow_next_syslog();
+      LOG_INFO("dump numa node info", K(node), "cpu_cnt", topology.get_node_cpu_cnt(node),
+               "tenant_cnt", tenant_cnt[node], "placed_min_cpu", placed_cpu[node],
+               "placed_memory_hold", placed_hold[node]);
+    }
+  }
+}
+
 uint32_t ObMultiTenant::get_tenant_lock_bucket_idx(const uint64_t tenant_id)
 {
   uint64_t hash_tenant_id = tenant_id * 13;
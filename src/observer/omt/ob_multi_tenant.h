@@ -183,6 +183,10 @@ protected:
   int remove_tenant(const uint64_t tenant_id, bool &lock_succ);
   uint32_t get_tenant_lock_bucket_idx(const uint64_t tenant_id);
   int update_tenant_unit_no_lock(const share::ObUnitInfoGetter::ObTenantConfig &unit);
+  // keep each tenant on the NUMA node with the least min_cpu placed on it, tenants
+  // whose max_cpu doesn't fit in one node are spread over all nodes.
+  void place_tenants_on_numa_nodes();
+  void dump_numa_node_info();
 
 protected:
       static const int DEL_TRY_TIMES = 30;
@@ -46,6 +46,7 @@
 #include "rpc/obrpc/ob_rpc_stat.h"
 #include "rpc/obrpc/ob_rpc_packet.h"
 #include "lib/container/ob_array.h"
+#include "lib/cpu/ob_cpu_topology.h"
 #include "share/rc/ob_tenant_module_init_ctx.h"
 
 using namespace oceanbase::lib;
@@ -239,7 +240,12 @@ void ObPxPool::run1()
 
   ObLink *task = nullptr;
   int64_t idle_time = 0;
+  int64_t bound_numa_node = ObNumaTopology::INVALID_NODE;
+  ObTenant *tenant = static_cast<ObTenant*>(MTL_CTX());
   while (!Thread::current().has_set_stop()) {
+    if (OB_NOT_NULL(tenant)) {
+      tenant->follow_numa_node(bound_numa_node);
+    }
 	  if (!is_inited_) {
       ob_usleep(10 * 1000L);
     } else {
@@ -564,6 +570,7 @@ ObTenant::ObTenant(const int64_t id,
       times_of_workers_(times_of_workers),
       unit_max_cpu_(0),
       unit_min_cpu_(0),
+      numa_node_(-1),
       slice_(0),
       slice_remain_(0),
       slice_remain_lock_(),
@@ -608,6 +615,8 @@ ObTenant::ObTenant(const int64_t id,
       token_usage_check_ts_(0),
       dynamic_modify_token_(false),
       dynamic_modify_group_token_(true),
+      block_compensation_(false),
+      blocked_workers_(0),
       ctx_(nullptr),
       px_pool_is_running_(false),
       st_metrics_(),
@@ -638,8 +647,14 @@ int ObTenant::init(const ObTenantMeta &meta)
   int ret = OB_SUCCESS;
   int tmp_ret = OB_SUCCESS;
 
+  // the shard count is fixed once the tenant is created, later changes of unit cpu do not reshard
+  const int64_t req_queue_shard_cnt = min(decltype(req_queue_)::MAX_SHARD_CNT,
+      max(1L, static_cast<int64_t>(meta.unit_.config_.max_cpu()) / decltype(req_queue_)::CPU_PER_SHARD));
+
   if (OB_FAIL(ObTenantBase::init(&cgroup_ctrl_))) {
     LOG_WARN("fail to init tenant base", K(ret));
+  } else if (OB_FAIL(req_queue_.init(req_queue_shard_cnt, ObMemAttr(id_, "TntReqQueue")))) {
+    LOG_WARN("init req queue failed", K(ret), K(req_queue_shard_cnt));
   } else if (FALSE_IT(req_queue_.set_limit(common::ObServerConfig::get_instance().tenant_task_queue_size))) {
   } else if (worker_pool_.init(1, 1)) {
     // useless now, but maybe useful later
@@ -938,6 +953,7 @@ void ObTenant::destroy()
   ObTenantSwitchGuard guard(this);
   ObTenantBase::destroy();
 
+  req_queue_.destroy();
   if (nullptr != multi_level_queue_) {
     common::ob_delete(multi_level_queue_);
     multi_level_queue_ = nullptr;
@@ -976,6 +992,19 @@ void ObTenant::set_unit_min_cpu(double cpu)
   }
 }
 
+void ObTenant::follow_numa_node(int64_t &bound_node) const
+{
+  int tmp_ret = OB_SUCCESS;
+  const int64_t node = get_numa_node();
+  if (OB_UNLIKELY(node != bound_node)) {
+    if (OB_SUCCESS != (tmp_ret = ObNumaTopology::get_instance().bind_self_to_node(node))) {
+      LOG_WARN("bind thread to numa node failed", K(tmp_ret), K_(id), K(node), K(bound_node));
+    }
+    // don't retry on failure, the thread just keeps running where it is
+    bound_node = node;
+  }
+}
+
 void ObTenant::set_token(const int64_t token)
 {
   if (token >= 0) {
@@ -1367,6 +1396,14 @@ void ObTenant::calibrate_token_count()
       last_pop_normal_cnt_ = pop_normal_cnt_;
       IGNORE_RETURN workers_lock_.unlock();
     }
+  } else if (ATOMIC_LOAD(&block_compensation_)) {
+    // one more worker for each worker blocked in sync rpc or io waits, surplus workers
+    // go inactive by themselves in check_worker_count(w) once the blocked ones resume
+    const int64_t blocked_workers = ATOMIC_LOAD(&blocked_workers_);
+    const int64_t token = min(sug_token_cnt_ + max(0L, blocked_workers), worker_count_bound());
+    if (token != token_cnt_) {
+      set_token(max(token, sug_token_cnt_));
+    }
   }
 }
 
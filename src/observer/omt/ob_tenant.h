@@ -80,7 +80,7 @@ private:
   uint64_t tenant_id_;
   uint64_t group_id_;
   share::ObCgroupCtrl *cgroup_ctrl_;
-	common::ObPriorityQueue2<0, 1> queue_;
+	common::ObPriorityQueue2<0, 1, 0, 256> queue_;
   bool is_inited_;
   int64_t concurrency_;
 };
@@ -306,7 +306,8 @@ public:
 
 protected:
   WList workers_;
-  common::ObPriorityQueue2<0, 1> req_queue_;
+  // requests of a resource group are far fewer than those of the tenant
+  common::ObPriorityQueue2<0, 1, 0, 256> req_queue_;
 
 private:
   bool inited_;                              // Mark whether the container has threads and queues allocated
@@ -443,6 +444,11 @@ public:
   double unit_max_cpu() const;
   void set_unit_min_cpu(double cpu);
   double unit_min_cpu() const;
+  // NUMA node the tenant is placed on by ObMultiTenant, -1 means not placed
+  void set_numa_node(const int64_t node) { ATOMIC_STORE(&numa_node_, node); }
+  int64_t get_numa_node() const { return ATOMIC_LOAD(&numa_node_); }
+  // rebind the calling thread when the tenant moved away from @bound_node
+  void follow_numa_node(int64_t &bound_node) const;
   void set_token(const int64_t token);
   void set_sug_token(const int64_t token);
   int64_t token_cnt() const;
@@ -483,9 +489,11 @@ public:
 
   TO_STRING_KV(K_(id),
                K_(tenant_meta),
-               K_(unit_min_cpu), K_(unit_max_cpu), K_(slice),
+               K_(unit_min_cpu), K_(unit_max_cpu), K_(numa_node), K_(slice),
                K_(slice_remain), K_(token_cnt), K_(sug_token_cnt),
                K_(ass_token_cnt),
+               K_(blocked_workers),
+               K_(block_compensation),
                K_(lq_tokens),
                K_(used_lq_tokens),
                K_(stopped), K_(idle_us),
@@ -536,6 +544,12 @@ public:
 
   void disable_user_sched();
   bool user_sched_enabled() const;
+  // workers blocked in sync rpc or io waits, see ObThWorker::sched_wait
+  void inc_blocked_worker() { ATOMIC_INC(&blocked_workers_); }
+  void dec_blocked_worker() { ATOMIC_DEC(&blocked_workers_); }
+  int64_t get_blocked_worker_cnt() const { return ATOMIC_LOAD(&blocked_workers_); }
+  void set_block_compensation(const bool enable) { ATOMIC_STORE(&block_compensation_, enable); }
+  bool has_block_compensation() const { return ATOMIC_LOAD(&block_compensation_); }
   double get_token_usage() const;
   int64_t get_worker_time() const;
   // sql throttle
@@ -595,6 +609,7 @@ protected:
   // max/min cpu read from unit
   double unit_max_cpu_;
   double unit_min_cpu_;
+  int64_t numa_node_;
 
   // tenant slice, it is calculated by quota. The slice is the average
   // number of token a tenant can get in every 10ms.
@@ -622,8 +637,10 @@ protected:
   bool wait_mtl_finished_;
 
   /// tenant task queue,
-  // 'hp' for high priority and 'np' for normal priority
-  common::ObPriorityQueue2<1, QQ_MAX_PRIO - 1, RQ_MAX_PRIO - QQ_MAX_PRIO> req_queue_;
+  // 'hp' for high priority and 'np' for normal priority,
+  // sharded by cpu and stolen by idle workers on multi-core units
+  // a ring per priority of each shard, which is shared by CPU_PER_SHARD cpus
+  common::ObShardedPriorityQueue2<1, QQ_MAX_PRIO - 1, RQ_MAX_PRIO - QQ_MAX_PRIO, 512> req_queue_;
   common::ObLinkQueue large_req_queue_;
 
   //Create a request queue for each level of nested requests
@@ -677,6 +694,9 @@ public:
   int64_t token_usage_check_ts_;
   bool dynamic_modify_token_;
   bool dynamic_modify_group_token_;
+  // add a token for each blocked worker on top of sug_token_cnt_
+  bool block_compensation_;
+  int64_t blocked_workers_ CACHE_ALIGNED;
 
   share::ObTenantSpace *ctx_;
 
@@ -21,11 +21,13 @@
 #include "lib/allocator/ob_page_manager.h"
 #include "lib/rc/context.h"
 #include "lib/thread/ob_thread_name.h"
+#include "lib/cpu/ob_cpu_topology.h"
 #include "ob_tenant.h"
 #include "ob_worker_processor.h"
 #include "share/config/ob_server_config.h"
 #include "observer/ob_server.h"
 #include "storage/memtable/ob_lock_wait_mgr.h"
+#include "storage/compaction/ob_tenant_tablet_scheduler.h"
 #include "sql/session/ob_sql_session_info.h"
 
 using namespace oceanbase;
@@ -52,7 +54,8 @@ ObThWorker::ObThWorker()
       query_start_time_(0), last_check_time_(0),
       can_retry_(true), need_retry_(false),
       active_(false), waiting_active_(false),
-      active_inactive_ts_(0L), lq_token_(false), has_add_to_cgroup_(false)
+      active_inactive_ts_(0L), lq_token_(false), has_add_to_cgroup_(false),
+      sched_wait_depth_(0), blocked_(false)
 {
 }
 
@@ -357,6 +360,7 @@ void ObThWorker::worker(int64_t &tenant_id, int64_t &req_recv_timestamp, int32_t
   int64_t wait_end_time = 0;
   int64_t req_start_time = 0;
   int64_t req_end_time = 0;
+  int64_t bound_numa_node = ObNumaTopology::INVALID_NODE;
   th_created();
 
   // Avoid adding and deleting entities from the root node for every request, the parameters are meaningless
@@ -380,6 +384,7 @@ void ObThWorker::worker(int64_t &tenant_id, int64_t &req_recv_timestamp, int32_t
           GCTX.cgroup_ctrl_->add_thread_to_cgroup(get_tid(), tenant_->id(), get_group_id());
           has_add_to_cgroup_ = true;
         }
+        tenant_->follow_numa_node(bound_numa_node);
         if (OB_LIKELY(pm != nullptr)) {
           if (pm->get_used() != 0) {
             LOG_ERROR("page manager's used should be 0, unexpected!!!", KP(pm));
@@ -440,10 +445,20 @@ void ObThWorker::worker(int64_t &tenant_id, int64_t &req_recv_timestamp, int32_t
                   query_enqueue_time_ = req->get_enqueue_timestamp();
                   last_check_time_ = wait_end_time;
                   set_rpc_stat_srv(&(tenant_->rpc_stat_info_->rpc_stat_srv_));
+                  // group and nesting workers have their own token counts, only compensate tenant workers
+                  set_block_compensation(nullptr == group_ && 0 == get_worker_level()
+                                         && tenant_->has_block_compensation());
                   req_start_time = ObTimeUtility::current_time();
                   process_request(*req);
+                  set_block_compensation(false);
                   req_end_time = ObTimeUtility::current_time();
                   tenant_->add_worker_time(req_end_time - req_start_time);
+                  if (!is_virtual_tenant_id(tenant_->id()) && 0 == get_worker_level()) {
+                    storage::ObTenantTabletScheduler *tablet_scheduler = MTL(storage::ObTenantTabletScheduler *);
+                    if (OB_NOT_NULL(tablet_scheduler)) {
+                      tablet_scheduler->get_compaction_governor().record_request_rt(req_end_time - query_enqueue_time_);
+                    }
+                  }
                   query_enqueue_time_ = INT64_MAX;
                   query_start_time_ = INT64_MAX;
                 } else {
@@ -536,3 +551,24 @@ int ObThWorker::check_status()
   }
   return ret;
 }
+
+// by self thread
+bool ObThWorker::sched_wait()
+{
+  if (has_block_compensation() && 0 == sched_wait_depth_++) {
+    blocked_ = true;
+    tenant_->inc_blocked_worker();
+  }
+  return true;
+}
+
+// by self thread
+bool ObThWorker::sched_run(int64_t waittime)
+{
+  // sched_run may be called without a preceding sched_wait
+  if (sched_wait_depth_ > 0 && 0 == --sched_wait_depth_ && blocked_) {
+    blocked_ = false;
+    tenant_->dec_blocked_worker();
+  }
+  return Worker::sched_run(waittime);
+}
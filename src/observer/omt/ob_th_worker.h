@@ -69,6 +69,10 @@ public:
   Status check_rate_limiter();
   virtual ObThWorker::Status check_wait();
   virtual int check_status() override;
+  // count this worker as blocked in its tenant during sync rpc and io waits,
+  // so that the tenant can run another worker in its place
+  virtual bool sched_wait() override;
+  virtual bool sched_run(int64_t waittime=0) override;
   virtual int check_large_query_quota();
 
   // retry relating
@@ -142,6 +146,9 @@ private:
   int64_t active_inactive_ts_;
   bool lq_token_;
   bool has_add_to_cgroup_;
+  // depth of nested sched_wait, only the outermost one is counted by tenant
+  int64_t sched_wait_depth_;
+  bool blocked_;
 
 private:
   DISALLOW_COPY_AND_ASSIGN(ObThWorker);
@@ -161,6 +168,8 @@ inline void ObThWorker::reset()
   need_retry_ = false;
   active_ = false;
   has_add_to_cgroup_ = false;
+  sched_wait_depth_ = 0;
+  blocked_ = false;
   unset_tidx();
 }
 
@@ -1159,3 +1159,42 @@ int ObHTableFilterOperator::parse_filter_string(common::ObArenaAllocator* alloca
   }
   return ret;
 }
+
+int ObHTableFilterOperator::get_row_key_prefix(ObString &prefix, bool &has_prefix) const
+{
+  int ret = OB_SUCCESS;
+  prefix.reset();
+  has_prefix = false;
+  if (NULL != hfilter_) {
+    ret = extract_row_key_prefix(hfilter_, prefix, has_prefix);
+  }
+  return ret;
+}
+
+int ObHTableFilterOperator::extract_row_key_prefix(const hfilter::Filter *filter,
+                                                   ObString &prefix,
+                                                   bool &has_prefix)
+{
+  int ret = OB_SUCCESS;
+  const hfilter::RowFilter *row_filter = dynamic_cast<const hfilter::RowFilter*>(filter);
+  const hfilter::FilterListAND *and_filter = dynamic_cast<const hfilter::FilterListAND*>(filter);
+  if (NULL != row_filter) {
+    ObString cur_prefix;
+    bool cur_has_prefix = false;
+    if (OB_FAIL(row_filter->get_row_key_prefix(cur_prefix, cur_has_prefix))) {
+      LOG_WARN("failed to get row key prefix", K(ret));
+    } else if (cur_has_prefix && (!has_prefix || cur_prefix.length() > prefix.length())) {
+      prefix = cur_prefix;
+      has_prefix = true;
+    }
+  } else if (NULL != and_filter) {
+    // every sub filter must pass, so the longest prefix among them bounds the scan
+    const ObIArray<hfilter::Filter*> &filters = and_filter->get_filters();
+    for (int64_t i = 0; OB_SUCC(ret) && i < filters.count(); ++i) {
+      if (OB_FAIL(extract_row_key_prefix(filters.at(i), prefix, has_prefix))) {
+        LOG_WARN("failed to extract row key prefix", K(ret), K(i));
+      }
+    }
+  }
+  return ret;
+}
@@ -236,6 +236,10 @@ public:
   void set_ttl(int32_t ttl_value) { row_iterator_.set_ttl(ttl_value); }
   // parse the filter string
   int parse_filter_string(common::ObArenaAllocator* allocator);
+  // the row key prefix every matching row must start with, derived from the parsed filter
+  int get_row_key_prefix(ObString &prefix, bool &has_prefix) const;
+private:
+  static int extract_row_key_prefix(const table::hfilter::Filter *filter, ObString &prefix, bool &has_prefix);
 private:
   const ObTableQuery &query_;
   ObHTableRowIterator row_iterator_;
@@ -208,6 +208,23 @@ bool RowFilter::filter_row()
   return filter_out_row_;
 }
 
+int RowFilter::get_row_key_prefix(ObString &prefix, bool &has_prefix) const
+{
+  int ret = OB_SUCCESS;
+  has_prefix = false;
+  if (OB_ISNULL(comparator_)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("comparator is null", K(ret));
+  } else if (CompareOperator::EQUAL != cmp_op_) {
+    // only equality bounds the row key
+  } else if (NULL != dynamic_cast<BinaryComparator*>(comparator_)
+             || NULL != dynamic_cast<BinaryPrefixComparator*>(comparator_)) {
+    prefix = comparator_->get_comparator_value();
+    has_prefix = !prefix.empty();
+  }
+  return ret;
+}
+
 ////////////////////////////////////////////////////////////////
 QualifierFilter::~QualifierFilter()
 {}
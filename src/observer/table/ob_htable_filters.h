@@ -112,6 +112,7 @@ public:
   {}
   virtual ~Comparable() {}
   virtual int compare_to(const ObString &b) = 0;
+  const ObString &get_comparator_value() const { return comparator_value_; }
   VIRTUAL_TO_STRING_KV("comprable", "Comprable");
 protected:
   ObString comparator_value_;
@@ -210,6 +211,9 @@ public:
   virtual bool filter_row_key(const ObHTableCell &first_row_cell) override;
   virtual int filter_cell(const ObHTableCell &cell, ReturnCode &ret_code) override;
   virtual bool filter_row() override;
+  /// If every row passing this filter starts with a known byte string (EQUAL with a
+  /// binary or binary-prefix comparator), return it so the scan range can be narrowed.
+  int get_row_key_prefix(ObString &prefix, bool &has_prefix) const;
   TO_STRING_KV("filter", "RowFilter",
                "cmp_op", compare_operator_to_string(cmp_op_),
                "comparator", comparator_);
@@ -269,6 +273,7 @@ public:
 
   int add_filter(Filter *filter);
   Operator get_operator() const { return op_; }
+  const ObIArray<Filter*> &get_filters() const { return filters_; }
   virtual void reset() override;
 
   TO_STRING_KV("filter", "FilterList",
@@ -13,6 +13,7 @@
 #define USING_LOG_PREFIX SERVER
 #include "ob_htable_utils.h"
 #include <endian.h>  // be64toh
+#include <algorithm>
 using namespace oceanbase::common;
 using namespace oceanbase::table;
 
@@ -310,3 +311,169 @@ int ObHTableUtils::int64_to_java_bytes(int64_t val, char bytes[8])
   memcpy(bytes, &big_endian_64bits, sizeof(int64_t));
   return OB_SUCCESS;
 }
+
+int ObHTableUtils::restrict_key_ranges_by_prefix(common::ObIAllocator &allocator,
+                                                 const int64_t rowkey_cnt,
+                                                 const common::ObString &row_key_prefix,
+                                                 common::ObIArray<common::ObNewRange> &key_ranges)
+{
+  int ret = OB_SUCCESS;
+  const int64_t prefix_len = row_key_prefix.length();
+  ObObj *start_objs = NULL;
+  ObObj *end_objs = NULL;
+  char *end_buf = NULL;
+  int64_t end_len = prefix_len;
+  if (OB_UNLIKELY(rowkey_cnt <= 0 || prefix_len <= 0)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid argument", K(ret), K(rowkey_cnt), K(row_key_prefix));
+  } else if (OB_ISNULL(start_objs = static_cast<ObObj*>(allocator.alloc(sizeof(ObObj) * rowkey_cnt)))
+             || OB_ISNULL(end_objs = static_cast<ObObj*>(allocator.alloc(sizeof(ObObj) * rowkey_cnt)))
+             || OB_ISNULL(end_buf = static_cast<char*>(allocator.alloc(prefix_len)))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("no memory", K(ret), K(rowkey_cnt), K(prefix_len));
+  } else {
+    // the smallest key greater than every key with this prefix: drop trailing 0xFF bytes
+    // and increment the last remaining one; a prefix of all 0xFF has no upper bound
+    MEMCPY(end_buf, row_key_prefix.ptr(), prefix_len);
+    while (end_len > 0 && static_cast<uint8_t>(end_buf[end_len - 1]) == UINT8_MAX) {
+      --end_len;
+    }
+    if (end_len > 0) {
+      end_buf[end_len - 1] = static_cast<char>(static_cast<uint8_t>(end_buf[end_len - 1]) + 1);
+    }
+    start_objs[0].set_varbinary(row_key_prefix);
+    end_objs[0].set_varbinary(ObString(end_len, end_buf));
+    for (int64_t i = 1; i < rowkey_cnt; ++i) {
+      start_objs[i] = ObObj::make_min_obj();
+      end_objs[i] = ObObj::make_min_obj();
+    }
+    const ObRowkey prefix_start(start_objs, rowkey_cnt);
+    const ObRowkey prefix_end(end_objs, rowkey_cnt);
+    ObSEArray<ObNewRange, 4> restricted_ranges;
+    const int64_t N = key_ranges.count();
+    for (int64_t i = 0; OB_SUCC(ret) && i < N; ++i) {
+      ObNewRange range = key_ranges.at(i);
+      if (range.start_key_.compare(prefix_start) < 0) {
+        range.start_key_ = prefix_start;
+        range.border_flag_.set_inclusive_start();
+      }
+      if (end_len > 0 && range.end_key_.compare(prefix_end) >= 0) {
+        range.end_key_ = prefix_end;
+        range.border_flag_.unset_inclusive_end();
+      }
+      if (range.empty()) {
+        // no row of this range can pass the filter
+      } else if (OB_FAIL(restricted_ranges.push_back(range))) {
+        LOG_WARN("fail to push back key range", K(ret), K(range));
+      }
+    } // end for
+    if (OB_SUCC(ret) && N > 0 && restricted_ranges.empty()) {
+      // every range is disjoint from the prefix, nothing needs to be read
+      ObNewRange false_range = key_ranges.at(0);
+      false_range.set_false_range();
+      if (OB_FAIL(restricted_ranges.push_back(false_range))) {
+        LOG_WARN("fail to push back false range", K(ret));
+      }
+    }
+    if (OB_SUCC(ret) && OB_FAIL(key_ranges.assign(restricted_ranges))) {
+      LOG_WARN("fail to assign key ranges", K(ret));
+    }
+  }
+  return ret;
+}
+
+bool ObHTableUtils::is_single_row_range(const ObNewRange &range)
+{
+  bool bret = false;
+  const ObRowkey &start = range.start_key_;
+  const ObRowkey &end = range.end_key_;
+  if (start.get_obj_cnt() == end.get_obj_cnt()
+      && start.get_obj_cnt() > ObHTableConstants::COL_IDX_T
+      && range.border_flag_.inclusive_start()
+      && range.border_flag_.inclusive_end()) {
+    const ObObj *start_objs = start.get_obj_ptr();
+    const ObObj *end_objs = end.get_obj_ptr();
+    const ObObj &start_k = start_objs[ObHTableConstants::COL_IDX_K];
+    bret = !start_k.is_min_value() && !start_k.is_max_value()
+        && start_k == end_objs[ObHTableConstants::COL_IDX_K];
+    for (int64_t i = ObHTableConstants::COL_IDX_Q; bret && i < start.get_obj_cnt(); ++i) {
+      bret = start_objs[i].is_min_value() && end_objs[i].is_max_value();
+    }
+  }
+  return bret;
+}
+
+int ObHTableUtils::split_key_ranges_by_qualifiers(ObIAllocator &allocator,
+                                                  const int64_t rowkey_cnt,
+                                                  const ObIArray<ObString> &qualifiers,
+                                                  const int64_t min_stamp,
+                                                  const int64_t max_stamp,
+                                                  ObIArray<ObNewRange> &key_ranges)
+{
+  int ret = OB_SUCCESS;
+  // T is the negated timestamp, so [min_stamp, max_stamp) is (-max_stamp, -min_stamp] on T
+  const bool has_time_range = min_stamp >= 0 && max_stamp > min_stamp;
+  ObSEArray<ObString, 16> sorted_qualifiers;
+  ObSEArray<ObNewRange, 16> split_ranges;
+  if (OB_UNLIKELY(rowkey_cnt <= ObHTableConstants::COL_IDX_T)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid argument", K(ret), K(rowkey_cnt));
+  } else if (qualifiers.empty()) {
+    // every qualifier is read, a range can not skip the cells out of the time range
+  } else if (OB_FAIL(sorted_qualifiers.assign(qualifiers))) {
+    LOG_WARN("fail to assign qualifiers", K(ret));
+  } else {
+    std::sort(&sorted_qualifiers.at(0), &sorted_qualifiers.at(0) + sorted_qualifiers.count(),
+              [](const ObString &l, const ObString &r) { return l.compare(r) < 0; });
+    const int64_t N = key_ranges.count();
+    for (int64_t i = 0; OB_SUCC(ret) && i < N; ++i) {
+      const ObNewRange &range = key_ranges.at(i);
+      if (!is_single_row_range(range)) {
+        if (OB_FAIL(split_ranges.push_back(range))) {
+          LOG_WARN("fail to push back key range", K(ret), K(range));
+        }
+      } else {
+        const ObObj &k_obj = range.start_key_.get_obj_ptr()[ObHTableConstants::COL_IDX_K];
+        for (int64_t j = 0; OB_SUCC(ret) && j < sorted_qualifiers.count(); ++j) {
+          const ObString &qualifier = sorted_qualifiers.at(j);
+          ObObj *start_objs = NULL;
+          ObObj *end_objs = NULL;
+          if (j > 0 && 0 == qualifier.compare(sorted_qualifiers.at(j - 1))) {
+            // duplicated qualifier
+          } else if (OB_ISNULL(start_objs = static_cast<ObObj*>(allocator.alloc(sizeof(ObObj) * rowkey_cnt)))
+                     || OB_ISNULL(end_objs = static_cast<ObObj*>(allocator.alloc(sizeof(ObObj) * rowkey_cnt)))) {
+            ret = OB_ALLOCATE_MEMORY_FAILED;
+            LOG_WARN("no memory", K(ret), K(rowkey_cnt));
+          } else {
+            ObNewRange qualifier_range = range;
+            start_objs[ObHTableConstants::COL_IDX_K] = k_obj;
+            end_objs[ObHTableConstants::COL_IDX_K] = k_obj;
+            start_objs[ObHTableConstants::COL_IDX_Q].set_varbinary(qualifier);
+            end_objs[ObHTableConstants::COL_IDX_Q].set_varbinary(qualifier);
+            if (has_time_range) {
+              start_objs[ObHTableConstants::COL_IDX_T].set_int(-max_stamp);
+              end_objs[ObHTableConstants::COL_IDX_T].set_int(-min_stamp);
+              qualifier_range.border_flag_.unset_inclusive_start();
+            } else {
+              start_objs[ObHTableConstants::COL_IDX_T] = ObObj::make_min_obj();
+              end_objs[ObHTableConstants::COL_IDX_T] = ObObj::make_max_obj();
+            }
+            for (int64_t k = ObHTableConstants::COL_IDX_T + 1; k < rowkey_cnt; ++k) {
+              start_objs[k] = ObObj::make_min_obj();
+              end_objs[k] = ObObj::make_max_obj();
+            }
+            qualifier_range.start_key_.assign(start_objs, rowkey_cnt);
+            qualifier_range.end_key_.assign(end_objs, rowkey_cnt);
+            if (OB_FAIL(split_ranges.push_back(qualifier_range))) {
+              LOG_WARN("fail to push back key range", K(ret), K(qualifier_range));
+            }
+          }
+        } // end for
+      }
+    } // end for
+    if (OB_SUCC(ret) && OB_FAIL(key_ranges.assign(split_ranges))) {
+      LOG_WARN("fail to assign key ranges", K(ret));
+    }
+  }
+  return ret;
+}
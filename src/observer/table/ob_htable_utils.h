@@ -302,7 +302,22 @@ public:
   static int64_t current_time_millis() { return common::ObTimeUtility::current_time() / 1000; }
   static int java_bytes_to_int64(const ObString &bytes, int64_t &val);
   static int int64_to_java_bytes(int64_t val, char bytes[8]);
+  /// Intersect key_ranges with the rows whose K starts with row_key_prefix. Ranges disjoint
+  /// from the prefix are dropped; if none is left a single false range is returned.
+  static int restrict_key_ranges_by_prefix(common::ObIAllocator &allocator,
+                                           const int64_t rowkey_cnt,
+                                           const common::ObString &row_key_prefix,
+                                           common::ObIArray<common::ObNewRange> &key_ranges);
+  /// Replace every range covering exactly one K with one range per qualifier, bounded on T
+  /// by the time range [min_stamp, max_stamp). Ranges over several K are kept as they are.
+  static int split_key_ranges_by_qualifiers(common::ObIAllocator &allocator,
+                                            const int64_t rowkey_cnt,
+                                            const common::ObIArray<common::ObString> &qualifiers,
+                                            const int64_t min_stamp,
+                                            const int64_t max_stamp,
+                                            common::ObIArray<common::ObNewRange> &key_ranges);
 private:
+  static bool is_single_row_range(const common::ObNewRange &range);
   ObHTableUtils() = delete;
   ~ObHTableUtils() = delete;
 };
@@ -196,7 +196,8 @@ int ObTableApiRowIterator::fill_multi_get_param(
     ObTableServiceCtx &ctx,
     const ObTableBatchOperation &batch_operation,
     storage::ObTableScanParam &scan_param,
-    share::schema::ObTableParam &table_param)
+    share::schema::ObTableParam &table_param,
+    const common::ObIArray<int64_t> *key_order)
 {
   int ret = OB_SUCCESS;
   scan_param.key_ranges_.reset();
@@ -204,10 +205,14 @@ int ObTableApiRowIterator::fill_multi_get_param(
   if (N <= 0) {
     ret = OB_INVALID_ARGUMENT;
     LOG_WARN("Invalid argument, ", K(ret), K(N));
+  } else if (OB_NOT_NULL(key_order) && OB_UNLIKELY(key_order->count() != N)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("key order does not match batch operation", K(ret), K(N), K(key_order->count()));
   }
 
   for (int64_t i = 0; OB_SUCC(ret) && i < N; ++i) {
-    ObRowkey rowkey = const_cast<ObITableEntity &>(batch_operation.at(i).entity()).get_rowkey();
+    const int64_t op_idx = OB_ISNULL(key_order) ? i : key_order->at(i);
+    ObRowkey rowkey = const_cast<ObITableEntity &>(batch_operation.at(op_idx).entity()).get_rowkey();
     if (OB_FAIL(fill_range(rowkey, scan_param.key_ranges_))) {
       LOG_WARN("Fail to fill range, ", K(ret), K(i));
     }
@@ -1469,7 +1474,8 @@ ObTableApiMultiGetRowIterator::~ObTableApiMultiGetRowIterator()
 {
 }
 
-int ObTableApiMultiGetRowIterator::open(const ObTableBatchOperation &batch_operation)
+int ObTableApiMultiGetRowIterator::open(const ObTableBatchOperation &batch_operation,
+                                        const common::ObIArray<int64_t> *key_order)
 {
   int ret = OB_SUCCESS;
   const bool ignore_missing_column = true;
@@ -1478,7 +1484,7 @@ int ObTableApiMultiGetRowIterator::open(const ObTableBatchOperation &batch_opera
     LOG_WARN("The table api multi get row iterator has not been inited, ", K(ret));
   } else if (OB_FAIL(cons_all_columns(batch_operation.at(0).entity(), ignore_missing_column))) {
     LOG_WARN("Fail to construct all columns, ", K(ret));
-  } else if (OB_FAIL(fill_multi_get_param(*ctx_, batch_operation, scan_param_, table_param_))) {
+  } else if (OB_FAIL(fill_multi_get_param(*ctx_, batch_operation, scan_param_, table_param_, key_order))) {
     LOG_WARN("Fail to fill get param, ", K(ret));
   } else if (OB_FAIL(access_service_->table_scan(scan_param_, scan_iter_))) {
     if (OB_TRY_LOCK_ROW_CONFLICT != ret) {
@@ -48,11 +48,13 @@ protected:
       ObRowkey &rowkey,
       storage::ObTableScanParam &scan_param,
       share::schema::ObTableParam &table_param);
+  // @param key_order: if not null, the keys are filled in this order of operation index
   int fill_multi_get_param(
       ObTableServiceCtx &ctx,
       const ObTableBatchOperation &batch_operation,
       storage::ObTableScanParam &scan_param,
-      share::schema::ObTableParam &table_param);
+      share::schema::ObTableParam &table_param,
+      const common::ObIArray<int64_t> *key_order = NULL);
   int fill_generate_columns(common::ObNewRow &row);
   virtual bool is_read() const { return false; }
 private:
@@ -251,7 +253,8 @@ class ObTableApiMultiGetRowIterator : public ObTableApiGetRowIterator
 public:
   ObTableApiMultiGetRowIterator();
   virtual ~ObTableApiMultiGetRowIterator();
-  int open(const ObTableBatchOperation &table_operation);
+  int open(const ObTableBatchOperation &table_operation,
+           const common::ObIArray<int64_t> *key_order = NULL);
 };
 
 
@@ -118,6 +118,65 @@ int ObTableQueryP::get_tablet_ids(uint64_t table_id, ObIArray<ObTabletID> &table
   return ret;
 }
 
+// Same protocol as the plain flush() loop, but the next result is scanned right after the
+// current one has been put on the wire, so that storage scan overlaps with the network
+// transfer and the client consuming the current packet, instead of starting only after
+// the client asks for more.
+int ObTableQueryP::pipelined_stream_query(ObTableQueryResultIterator &result_iterator,
+                                          const int64_t timeout_ts,
+                                          int32_t &result_count)
+{
+  int ret = OB_SUCCESS;
+  ObTableQueryResult *one_result = nullptr;
+  ++result_count;
+  if (ObTimeUtility::current_time() > timeout_ts) {
+    ret = OB_TRANS_TIMEOUT;
+    LOG_WARN("exceed operatiton timeout", K(ret));
+  } else if (OB_FAIL(result_iterator.get_next_result(one_result))) {
+    if (OB_ITER_END != ret) {
+      LOG_WARN("fail to get next result", K(ret));
+    }
+  }
+  while (OB_SUCC(ret) && result_iterator.has_more_result()) {
+    int prefetch_ret = OB_SUCCESS;
+    if (OB_FAIL(this->send_stream_part())) {
+      if (OB_ITER_END != ret) {
+        LOG_WARN("failed to send result packet", K(ret));
+      } else {
+        LOG_TRACE("user abort the stream rpc", K(ret));
+      }
+    } else {
+      // the packet has been serialized, result_ can be refilled before the client asks for it
+      result_row_count_ += result_.get_row_count();
+      result_.reset_except_property();
+      ++result_count;
+      if (ObTimeUtility::current_time() > timeout_ts) {
+        prefetch_ret = OB_TRANS_TIMEOUT;
+        LOG_WARN("exceed operatiton timeout", K(prefetch_ret));
+      } else if (OB_SUCCESS != (prefetch_ret = result_iterator.get_next_result(one_result))) {
+        if (OB_ITER_END != prefetch_ret) {
+          LOG_WARN("fail to prefetch next result", K(prefetch_ret));
+        }
+      }
+      // always wait for the next packet, the error (if any) is responded to it
+      if (OB_FAIL(this->wait_stream_next())) {
+        if (OB_ITER_END != ret) {
+          LOG_WARN("failed to wait next stream packet", K(ret));
+        } else {
+          LOG_TRACE("user abort the stream rpc", K(ret));
+        }
+      } else {
+        ret = prefetch_ret;
+      }
+    }
+  }
+  if (OB_SUCC(ret)) {
+    // no more result, the last result_ will be send automatically
+    result_row_count_ += result_.get_row_count();
+  }
+  return ret;
+}
+
 int ObTableQueryP::try_process()
 {
   int ret = OB_SUCCESS;
@@ -169,32 +228,36 @@ int ObTableQueryP::try_process()
     }
     // one_result references to result_
     ObTableQueryResult *one_result = nullptr;
-    while (OB_SUCC(ret)) {
-      ++result_count;
-      // the last result_ does not need flush, it will be send automatically
-      if (ObTimeUtility::current_time() > timeout_ts) {
-        ret = OB_TRANS_TIMEOUT;
-        LOG_WARN("exceed operatiton timeout", K(ret));
-      } else if (OB_FAIL(result_iterator->get_next_result(one_result))) {
-        if (OB_ITER_END != ret) {
-          LOG_WARN("fail to get next result", K(ret));
-        }
-      } else if (result_iterator->has_more_result()) {
-        if (OB_FAIL(this->flush())) {
+    if (GCONF._enable_tableapi_stream_prefetch) {
+      ret = pipelined_stream_query(*result_iterator, timeout_ts, result_count);
+    } else {
+      while (OB_SUCC(ret)) {
+        ++result_count;
+        // the last result_ does not need flush, it will be send automatically
+        if (ObTimeUtility::current_time() > timeout_ts) {
+          ret = OB_TRANS_TIMEOUT;
+          LOG_WARN("exceed operatiton timeout", K(ret));
+        } else if (OB_FAIL(result_iterator->get_next_result(one_result))) {
           if (OB_ITER_END != ret) {
-            LOG_WARN("failed to flush result packet", K(ret));
+            LOG_WARN("fail to get next result", K(ret));
+          }
+        } else if (result_iterator->has_more_result()) {
+          if (OB_FAIL(this->flush())) {
+            if (OB_ITER_END != ret) {
+              LOG_WARN("failed to flush result packet", K(ret));
+            } else {
+              LOG_TRACE("user abort the stream rpc", K(ret));
+            }
           } else {
-            LOG_TRACE("user abort the stream rpc", K(ret));
+            LOG_DEBUG("[yzfdebug] flush one result", K(ret), "row_count", result_.get_row_count());
+            result_row_count_ += result_.get_row_count();
+            result_.reset_except_property();
           }
         } else {
-          LOG_DEBUG("[yzfdebug] flush one result", K(ret), "row_count", result_.get_row_count());
+          // no more result
           result_row_count_ += result_.get_row_count();
-          result_.reset_except_property();
+          break;
         }
-      } else {
-        // no more result
-        result_row_count_ += result_.get_row_count();
-        break;
       }
     }
     if (OB_ITER_END == ret) {
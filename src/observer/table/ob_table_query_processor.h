@@ -40,6 +40,9 @@ protected:
 
 private:
   int get_tablet_ids(uint64_t table_id, ObIArray<ObTabletID> &tablet_ids);
+  int pipelined_stream_query(table::ObTableQueryResultIterator &result_iterator,
+                             const int64_t timeout_ts,
+                             int32_t &result_count);
   DISALLOW_COPY_AND_ASSIGN(ObTableQueryP);
 private:
   common::ObArenaAllocator allocator_;
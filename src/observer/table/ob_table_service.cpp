@@ -620,20 +620,78 @@ int ObTableService::execute_get(ObTableServiceGetCtx &ctx, const ObTableOperatio
   return ret;
 }
 
+// Multi-get keys are handed to storage in rowkey order, so that ObMultipleGetMerge
+// visits macro/micro blocks sequentially and neighbour keys share the prefetched
+// micro block, while the results are still returned in request order.
+struct MultiGetKeyCompare
+{
+  MultiGetKeyCompare(const ObIArray<ObRowkey> &rowkeys, int &ret)
+    : rowkeys_(rowkeys), ret_(ret) {}
+  bool operator()(const int64_t l, const int64_t r)
+  {
+    int cmp = 0;
+    if (OB_SUCCESS == ret_
+        && OB_SUCCESS != (ret_ = rowkeys_.at(l).compare(rowkeys_.at(r), cmp))) {
+      LOG_WARN("failed to compare rowkey", K(ret_), K(l), K(r));
+    }
+    return cmp < 0;
+  }
+  const ObIArray<ObRowkey> &rowkeys_;
+  int &ret_;
+};
+
+int ObTableService::sort_multi_get_keys(const ObTableBatchOperation &batch_operation,
+                                        ObIArray<int64_t> &key_order,
+                                        bool &need_sort)
+{
+  int ret = OB_SUCCESS;
+  const int64_t N = batch_operation.count();
+  ObSEArray<ObRowkey, 16> rowkeys;
+  need_sort = false;
+  key_order.reset();
+  for (int64_t i = 0; OB_SUCC(ret) && i < N; ++i) {
+    ObRowkey rowkey = const_cast<ObITableEntity &>(batch_operation.at(i).entity()).get_rowkey();
+    int cmp = 0;
+    if (OB_FAIL(rowkeys.push_back(rowkey))) {
+      LOG_WARN("failed to push back rowkey", K(ret), K(i));
+    } else if (OB_FAIL(key_order.push_back(i))) {
+      LOG_WARN("failed to push back key idx", K(ret), K(i));
+    } else if (i > 0 && !need_sort) {
+      if (OB_FAIL(rowkeys.at(i - 1).compare(rowkey, cmp))) {
+        LOG_WARN("failed to compare rowkey", K(ret), K(i));
+      } else {
+        need_sort = cmp > 0;
+      }
+    }
+  }
+  if (OB_SUCC(ret) && need_sort) {
+    // stable sort keeps duplicated keys in request order
+    std::stable_sort(&key_order.at(0), &key_order.at(0) + N, MultiGetKeyCompare(rowkeys, ret));
+    if (OB_FAIL(ret)) {
+      LOG_WARN("failed to sort multi get keys", K(ret));
+    }
+  }
+  return ret;
+}
+
 int ObTableService::fill_multi_get_result(
     ObTableServiceGetCtx &ctx,
     const ObTableBatchOperation &batch_operation,
     ObTableApiRowIterator *scan_result,
-    ObTableBatchOperationResult &result)
+    ObTableBatchOperationResult &result,
+    const ObIArray<int64_t> *key_order)
 {
   int ret = OB_SUCCESS;
   const int64_t rowkey_size = batch_operation.at(0).entity().get_rowkey_size();
   ObNewRow *row = NULL;
   const int64_t N = batch_operation.count();
   bool did_get_next_row = true;
+  // results in scan order, only used when the keys are reordered
+  ObSEArray<ObTableOperationResult, 16> sorted_results;
   for (int64_t i = 0; OB_SUCCESS == ret && i < N; ++i) {
     // left join
-    const ObTableEntity &entity = static_cast<const ObTableEntity&>(batch_operation.at(i).entity());
+    const int64_t op_idx = OB_ISNULL(key_order) ? i : key_order->at(i);
+    const ObTableEntity &entity = static_cast<const ObTableEntity&>(batch_operation.at(op_idx).entity());
     ObRowkey expected_key = const_cast<ObTableEntity&>(entity).get_rowkey();
     ObTableOperationResult op_result;
     ObITableEntity *result_entity = result.get_entity_factory()->alloc();
@@ -650,7 +708,7 @@ int ObTableService::fill_multi_get_result(
           // push empty entity
           ret = OB_SUCCESS;
           op_result.set_errno(OB_SUCCESS);
-          if (OB_FAIL(result.push_back(op_result))) {
+          if (OB_FAIL(OB_ISNULL(key_order) ? result.push_back(op_result) : sorted_results.push_back(op_result))) {
             LOG_WARN("failed to push back result", K(ret), K(i));
           }
           continue;
@@ -685,24 +743,46 @@ int ObTableService::fill_multi_get_result(
       op_result.set_errno(OB_SUCCESS);
     }
     if (OB_SUCC(ret)) {
-      if (OB_FAIL(result.push_back(op_result))) {
+      if (OB_FAIL(OB_ISNULL(key_order) ? result.push_back(op_result) : sorted_results.push_back(op_result))) {
         LOG_WARN("failed to push back result", K(ret), K(i));
       }
     }
   }  // end for
+
+  if (OB_SUCC(ret) && OB_NOT_NULL(key_order)) {
+    // restore request order: sorted_results[i] is the result of operation key_order[i]
+    ObSEArray<int64_t, 16> result_pos;
+    if (OB_FAIL(result_pos.prepare_allocate(N))) {
+      LOG_WARN("failed to prepare result pos", K(ret), K(N));
+    } else {
+      for (int64_t i = 0; i < N; ++i) {
+        result_pos.at(key_order->at(i)) = i;
+      }
+      for (int64_t i = 0; OB_SUCC(ret) && i < N; ++i) {
+        if (OB_FAIL(result.push_back(sorted_results.at(result_pos.at(i))))) {
+          LOG_WARN("failed to push back result", K(ret), K(i));
+        }
+      }
+    }
+  }
   return ret;
 }
 
 int ObTableService::multi_get(ObTableServiceGetCtx &ctx, const ObTableBatchOperation &batch_operation, ObTableBatchOperationResult &result)
 {
   int ret = OB_SUCCESS;
+  ObSEArray<int64_t, 16> key_order;
+  bool need_sort = false;
   SMART_VAR(ObTableApiMultiGetRowIterator, multi_get_iter) {
     ObAccessService *access_service = MTL(ObAccessService *);
-    if (OB_FAIL(multi_get_iter.init(*access_service, *schema_service_, ctx))) {
+    if (OB_FAIL(sort_multi_get_keys(batch_operation, key_order, need_sort))) {
+      LOG_WARN("failed to sort multi get keys", K(ret));
+    } else if (OB_FAIL(multi_get_iter.init(*access_service, *schema_service_, ctx))) {
       LOG_WARN("Fail to init multi get iter, ", K(ret));
-    } else if (OB_FAIL(multi_get_iter.open(batch_operation))) {
+    } else if (OB_FAIL(multi_get_iter.open(batch_operation, need_sort ? &key_order : NULL))) {
       LOG_WARN("Fail to open multi get iter, ", K(ret));
-    } else if (OB_FAIL(fill_multi_get_result(ctx, batch_operation, &multi_get_iter, result))) {
+    } else if (OB_FAIL(fill_multi_get_result(ctx, batch_operation, &multi_get_iter, result,
+                                             need_sort ? &key_order : NULL))) {
       LOG_WARN("failed to send result");
     }
   }
@@ -2001,6 +2081,54 @@ int ObTableService::fill_query_scan_ranges(ObTableServiceCtx &ctx,
   return ret;
 }
 
+// Narrow the scan ranges of an htable query to the rows whose K starts with row_key_prefix,
+// so rows rejected by a row key filter are never read from storage. The filter itself is
+// still evaluated by ObHTableFilterOperator.
+int ObTableService::restrict_htable_scan_ranges(ObTableServiceCtx &ctx,
+                                                const ObString &row_key_prefix,
+                                                storage::ObTableScanParam &scan_param)
+{
+  int ret = OB_SUCCESS;
+  if (OB_ISNULL(ctx.param_.allocator_)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("allocator is null", K(ret));
+  } else if (OB_FAIL(ObHTableUtils::restrict_key_ranges_by_prefix(*ctx.param_.allocator_,
+                                                                  ctx.columns_type_.count(),
+                                                                  row_key_prefix,
+                                                                  scan_param.key_ranges_))) {
+    LOG_WARN("fail to restrict key ranges by prefix", K(ret), K(row_key_prefix));
+  } else {
+    LOG_DEBUG("restrict htable scan ranges by row key prefix", K(row_key_prefix),
+              "key_ranges", scan_param.key_ranges_);
+  }
+  return ret;
+}
+
+// A get of selected qualifiers reads only the cells of those qualifiers within the time
+// range, instead of every version of every qualifier of the row. Only forward scans are
+// split, since the ranges are listed in qualifier order. Cells of multi-row scans are still
+// filtered by ObHTableFilterOperator.
+int ObTableService::split_htable_scan_ranges(ObTableServiceCtx &ctx,
+                                             const ObHTableFilter &htable_filter,
+                                             storage::ObTableScanParam &scan_param)
+{
+  int ret = OB_SUCCESS;
+  if (OB_ISNULL(ctx.param_.allocator_)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("allocator is null", K(ret));
+  } else if (OB_FAIL(ObHTableUtils::split_key_ranges_by_qualifiers(*ctx.param_.allocator_,
+                                                                   ctx.columns_type_.count(),
+                                                                   htable_filter.get_columns(),
+                                                                   htable_filter.get_min_stamp(),
+                                                                   htable_filter.get_max_stamp(),
+                                                                   scan_param.key_ranges_))) {
+    LOG_WARN("fail to split key ranges by qualifiers", K(ret), K(htable_filter));
+  } else {
+    LOG_DEBUG("split htable scan ranges by qualifiers", "key_ranges", scan_param.key_ranges_);
+  }
+  return ret;
+}
+
 int ObTableService::fill_query_scan_param(ObTableServiceCtx &ctx,
                                           const ObIArray<uint64_t> &output_column_ids,
                                           int64_t schema_version,
@@ -2267,6 +2395,19 @@ int ObTableService::execute_query(ObTableServiceQueryCtx &ctx, const ObTableQuer
                                             (table_id != index_id) ? padding_num : -1,
                                             ctx.scan_param_))) {
     LOG_WARN("failed to fill range", K(ret));
+  } else if (NULL != p_hcolumn_desc && table_id == index_id) {
+    ObString row_key_prefix;
+    bool has_prefix = false;
+    if (OB_FAIL(ctx.htable_result_iterator_->get_row_key_prefix(row_key_prefix, has_prefix))) {
+      LOG_WARN("failed to get row key prefix", K(ret));
+    } else if (has_prefix && OB_FAIL(restrict_htable_scan_ranges(ctx, row_key_prefix, ctx.scan_param_))) {
+      LOG_WARN("failed to restrict htable scan ranges", K(ret), K(row_key_prefix));
+    } else if (ObQueryFlag::Forward == query.get_scan_order()
+               && OB_FAIL(split_htable_scan_ranges(ctx, query.get_htable_filter(), ctx.scan_param_))) {
+      LOG_WARN("failed to split htable scan ranges", K(ret));
+    }
+  }
+  if (OB_FAIL(ret)) {
   } else if (OB_FAIL(fill_query_scan_param(ctx, output_column_ids, schema_version,
                                            query.get_scan_order(), index_id, query.get_limit(),
                                            query.get_offset(), ctx.scan_param_, for_update))) {
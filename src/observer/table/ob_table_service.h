@@ -260,11 +260,15 @@ private:
       ObTableApiRowIterator *scan_result,
       ObTableOperationResult &operation_result);
   // for multi-get
+  static int sort_multi_get_keys(const ObTableBatchOperation &batch_operation,
+                                 common::ObIArray<int64_t> &key_order,
+                                 bool &need_sort);
   int fill_multi_get_result(
       ObTableServiceGetCtx &ctx,
       const ObTableBatchOperation &batch_operation,
       ObTableApiRowIterator *scan_result,
-      ObTableBatchOperationResult &result);
+      ObTableBatchOperationResult &result,
+      const common::ObIArray<int64_t> *key_order = NULL);
   int delete_can_use_put(table::ObTableEntityType entity_type, uint64_t table_id, bool &use_put);
   static int cons_all_index_properties(share::schema::ObSchemaGetterGuard &schema_guard,
                                        const share::schema::ObTableSchema &table_schema,
@@ -311,6 +315,12 @@ private:
                              const ObTableQuery &query,
                              int64_t padding_num,
                              storage::ObTableScanParam &scan_param);
+  int restrict_htable_scan_ranges(ObTableServiceCtx &ctx,
+                                  const ObString &row_key_prefix,
+                                  storage::ObTableScanParam &scan_param);
+  int split_htable_scan_ranges(ObTableServiceCtx &ctx,
+                               const table::ObHTableFilter &htable_filter,
+                               storage::ObTableScanParam &scan_param);
   int fill_query_scan_param(ObTableServiceCtx &ctx,
                             const common::ObIArray<uint64_t> &output_column_ids,
                             int64_t schema_version,
@@ -33,6 +33,7 @@
 #include "share/schema/ob_part_mgr_util.h"
 #include "share/schema/ob_schema_printer.h"
 #include "share/schema/ob_schema_utils.h"
+#include "share/schema/ob_table_param.h"
 #include "share/schema/ob_ddl_sql_service.h"
 #include "share/schema/ob_security_audit_sql_service.h"
 #include "share/schema/ob_user_sql_service.h"
@@ -2234,7 +2235,21 @@ int ObDDLService::set_raw_table_options(
           break;
         }
         case ObAlterTableArg::EXPIRE_INFO: {
-          ret = new_table_schema.set_expire_info(alter_table_schema.get_expire_info());
+          uint64_t ttl_column_id = OB_INVALID_ID;
+          int64_t ttl_us = 0;
+          if (new_table_schema.get_index_tid_count() > 0) {
+            ret = OB_NOT_SUPPORTED;
+            LOG_WARN("expire info on table with index not supported", K(ret), K(new_table_schema.get_table_id()));
+            LOG_USER_ERROR(OB_NOT_SUPPORTED, "expire info on table with index");
+          } else if (OB_FAIL(new_table_schema.set_expire_info(alter_table_schema.get_expire_info()))) {
+            LOG_WARN("failed to set expire info", K(ret));
+          } else if (OB_FAIL(ObTableTTLParam::get_ttl_column(new_table_schema, ttl_column_id, ttl_us))) {
+            LOG_WARN("failed to get ttl column", K(ret), K(new_table_schema.get_expire_info()));
+            if (OB_ERR_BAD_FIELD_ERROR == ret || OB_NOT_SUPPORTED == ret) {
+              ret = OB_NOT_SUPPORTED;
+              LOG_USER_ERROR(OB_NOT_SUPPORTED, "expire info on column other than timestamp");
+            }
+          }
           break;
         }
         case ObAlterTableArg::PRIMARY_ZONE: {
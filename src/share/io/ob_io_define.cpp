@@ -17,6 +17,7 @@
 #include "share/io/ob_io_struct.h"
 #include "share/io/ob_io_manager.h"
 #include "lib/time/ob_time_utility.h"
+#include "lib/worker.h"
 
 using namespace oceanbase::lib;
 using namespace oceanbase::common;
@@ -843,6 +844,11 @@ int ObIOHandle::wait(const int64_t timeout_ms)
     ret = OB_INVALID_ARGUMENT;
     LOG_WARN("Invalid argument, ", K(timeout_ms), K(ret));
   } else if (!req_->is_finished_) {
+    const bool block_compensation = THIS_WORKER.has_block_compensation();
+    if (block_compensation) {
+      // notify omt that I'd begin to wait
+      THIS_WORKER.sched_wait();
+    }
     ObWaitEventGuard wait_guard(req_->io_info_.flag_.get_wait_event(),
                                 timeout_ms,
                                 req_->io_info_.size_);
@@ -875,6 +881,10 @@ int ObIOHandle::wait(const int64_t timeout_ms)
     } else {
       ret = OB_TIMEOUT;
     }
+    if (block_compensation) {
+      // notify omt that my waiting is done
+      THIS_WORKER.sched_run();
+    }
   }
   if (OB_SUCC(ret)) {
     if (OB_FAIL(req_->ret_code_.io_ret_)) {
@@ -475,6 +475,11 @@ bool ObIOUsage::is_request_doing(const ObIOCategory category) const
   return ATOMIC_LOAD(&doing_request_count_[static_cast<int>(category)]) > 0;
 }
 
+int64_t ObIOUsage::get_doing_request_count(const ObIOCategory category) const
+{
+  return ATOMIC_LOAD(&doing_request_count_[static_cast<int>(category)]);
+}
+
 int64_t ObIOUsage::to_string(char* buf, const int64_t buf_len) const
 {
   int64_t pos = 0;
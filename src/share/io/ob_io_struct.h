@@ -147,6 +147,7 @@ public:
   void record_request_start(const ObIORequest &req);
   void record_request_finish(const ObIORequest &req);
   bool is_request_doing(const ObIOCategory category) const;
+  int64_t get_doing_request_count(const ObIOCategory category) const;
   int64_t to_string(char* buf, const int64_t buf_len) const;
 private:
   ObIOStat io_stats_[static_cast<int>(ObIOCategory::MAX_CATEGORY)][static_cast<int>(ObIOMode::MAX_MODE)];
@@ -52,6 +52,7 @@ TG_DEF(ObHeartbeat, ObHeartbeat, "", TG_STATIC, TIMER)
 TG_DEF(PlanCacheEvict, PlanCacheEvict, "", TG_DYNAMIC, TIMER)
 TG_DEF(MergeLoop, MergeLoop, "", TG_STATIC, TIMER)
 TG_DEF(SSTableGC, SSTableGC, "", TG_STATIC, TIMER)
+TG_DEF(CompactionGovernor, CompactionGov, "", TG_STATIC, TIMER)
 TG_DEF(MinorScan, MinorScan, "", TG_STATIC, TIMER)
 TG_DEF(MajorScan, MajorScan, "", TG_STATIC, TIMER)
 TG_DEF(WriteCkpt, WriteCkpt, "", TG_STATIC, TIMER)
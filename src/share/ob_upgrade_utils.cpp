@@ -34,7 +34,8 @@ using namespace sql;
 namespace share
 {
 const uint64_t ObUpgradeChecker::UPGRADE_PATH[DATA_VERSION_NUM] = {
-  CALC_VERSION(4UL, 1UL, 0UL, 0UL)   // 4.1.0.0
+  CALC_VERSION(4UL, 1UL, 0UL, 0UL),  // 4.1.0.0
+  CALC_VERSION(4UL, 1UL, 0UL, 1UL)   // 4.1.0.1
 };
 
 bool ObUpgradeChecker::check_data_version_exist(
@@ -562,6 +563,7 @@ int ObUpgradeProcesserSet::init(
     }
     // order by data version asc
     INIT_PROCESSOR_BY_VERSION(4, 1, 0, 0);
+    INIT_PROCESSOR_BY_VERSION(4, 1, 0, 1);
 #undef INIT_PROCESSOR_BY_VERSION
     inited_ = true;
   }
@@ -166,12 +166,13 @@ class ObUpgradeChecker
 public:
   static bool check_data_version_exist(const uint64_t version);
 public:
-  static const int64_t DATA_VERSION_NUM = 1;
+  static const int64_t DATA_VERSION_NUM = 2;
   static const uint64_t UPGRADE_PATH[DATA_VERSION_NUM];
 };
 
 /* =========== special upgrade processor start ============= */
 DEF_SIMPLE_UPGRARD_PROCESSER(4, 1, 0, 0)
+DEF_SIMPLE_UPGRARD_PROCESSER(4, 1, 0, 1)
 /* =========== special upgrade processor end   ============= */
 
 /* =========== upgrade processor end ============= */
@@ -129,6 +129,7 @@ int ObBatchRpcBase::post(const uint64_t tenant_id, const ObAddr &dest, const int
     new_dest.set_port(dest.get_port() + BATCH_RPC_PORT_DELTA);
   }
   if (NULL == buffer || !buffer->fill(sub_type, req)) {
+    ATOMIC_INC(&single_req_cnt_);
     Packet* pkt = NULL;
     if (OB_FAIL(build_batch_packet(self_, batch_type, sub_type, req, pkt, is_dynamic_alloc))) {
       RPC_LOG(WARN, "build_batch_packet fail", K(ret));
@@ -145,6 +146,7 @@ int ObBatchRpcBase::post(const uint64_t tenant_id, const ObAddr &dest, const int
       }
     }
   } else {
+    ATOMIC_INC(&batched_req_cnt_);
     if (delay_us_ <= 0) {
       cond_.signal();
     }
@@ -235,6 +237,7 @@ int ObBatchRpcBase::post(const uint64_t tenant_id, const ObAddr &dest, const int
     new_dest.set_port(dest.get_port() + BATCH_RPC_PORT_DELTA);
   }
   if (NULL == buffer || !buffer->fill(sub_type, ls, req)) {
+    ATOMIC_INC(&single_req_cnt_);
     Packet* pkt = NULL;
     if (OB_FAIL(build_batch_packet(self_, batch_type, sub_type, ls, req, pkt, is_dynamic_alloc))) {
       RPC_LOG(WARN, "build_batch_packet fail", K(ret));
@@ -251,6 +254,7 @@ int ObBatchRpcBase::post(const uint64_t tenant_id, const ObAddr &dest, const int
       }
     }
   } else {
+    ATOMIC_INC(&batched_req_cnt_);
     if (delay_us_ <= 0) {
       cond_.signal();
     }
@@ -292,9 +296,12 @@ void ObBatchRpcBase::do_work()
     }
     while(NULL != (iter = buffer_map_->quick_next(iter))) {
       int cnt = 0;
-      while (iter->send(*rpc_, iter->get_tenant_id(), self_, 0 == cnt) > 0) {
+      int64_t size = 0;
+      while ((size = iter->send(*rpc_, iter->get_tenant_id(), self_, 0 == cnt)) > 0) {
         cnt++;
+        batch_pkt_size_ += size;
       }
+      batch_pkt_cnt_ += cnt;
       if (start_ts - iter->get_last_use_ts() > CLEAN_SVR_INTERVAL
           && iter->is_empty()) {
         need_gc = true;
@@ -336,14 +343,43 @@ void ObBatchRpcBase::do_work()
     if (sleep_ts < 0) {
       sleep_ts = 0;
     }
+    if (start_ts - last_stat_ts_ > STAT_INTERVAL) {
+      print_stat(start_ts);
+    }
     if (delay_us_ > 0) {
       ob_usleep((int32_t)sleep_ts);
-    } else {
-      cond_.wait(sleep_ts);
+    } else if (cond_.wait(sleep_ts)) {
+      linger_after_wakeup();
     }
   }
 }
 
+// Messages of nodelay types are sent as soon as the thread is woken up, so those posted
+// at the same time to one server only share a packet when the thread is busy. Waiting a
+// few microseconds before sending merges them, at the cost of that latency.
+void ObBatchRpcBase::linger_after_wakeup()
+{
+  const int64_t linger_time = GCONF._batch_rpc_linger_time;
+  if (linger_time > 0) {
+    ob_usleep(static_cast<int32_t>(linger_time));
+  }
+}
+
+void ObBatchRpcBase::print_stat(const int64_t now)
+{
+  const int64_t batched_req_cnt = ATOMIC_TAS(&batched_req_cnt_, 0);
+  const int64_t single_req_cnt = ATOMIC_TAS(&single_req_cnt_, 0);
+  if (batched_req_cnt > 0 || single_req_cnt > 0) {
+    RPC_LOG(INFO, "batch rpc send statistics", K_(batch_type), K(batched_req_cnt), K(single_req_cnt),
+            K_(batch_pkt_cnt), K_(batch_pkt_size),
+            "req_per_pkt", batch_pkt_cnt_ > 0 ? batched_req_cnt / batch_pkt_cnt_ : 0,
+            "linger_time", static_cast<int64_t>(GCONF._batch_rpc_linger_time));
+  }
+  batch_pkt_cnt_ = 0;
+  batch_pkt_size_ = 0;
+  last_stat_ts_ = now;
+}
+
 ObRpcBuffer* ObBatchRpcBase::create_buffer(const uint64_t tenant_id, const ObAddr& addr, const int64_t dst_cluster_id)
 {
   const int64_t alloc_size = get_batch_buffer_size(batch_type_) * BATCH_BUFFER_COUNT;
@@ -326,16 +326,15 @@ public:
       }
     }
   }
+  // return true if signaled, before the wait or while sleeping, false on timeout
   bool wait(int64_t timeout)  {
-    bool ready = ATOMIC_LOAD(&futex_.val());
-    if (!ready) {
+    auto &ready = futex_.val();
+    if (!ATOMIC_LOAD(&ready)) {
       ATOMIC_FAA(&n_waiters_, 1);
       futex_.wait(0, timeout);
       ATOMIC_FAA(&n_waiters_, -1);
-    } else {
-      ATOMIC_STORE(&futex_.val(), 0);
     }
-    return ready;
+    return ATOMIC_BCAS(&ready, 1, 0);
   }
 private:
   int32_t n_waiters_;
@@ -353,7 +352,10 @@ public:
   typedef common::FixedHash2<RpcBuffer> BufferMap;
   typedef SingleWaitCond SendCond;
   static const int64_t SVR_IDLE_TIME_THRESHOLD = 10 * 60 * 1000 * 1000L;  // 10 minutes
-  ObBatchRpcBase(): is_inited_(false), batch_type_(-1), self_(), delay_us_(0), rpc_(nullptr), buffer_map_(nullptr)
+  static const int64_t STAT_INTERVAL = 10 * 1000 * 1000L;  // 10s
+  ObBatchRpcBase(): is_inited_(false), batch_type_(-1), self_(), delay_us_(0), rpc_(nullptr), buffer_map_(nullptr),
+                    batched_req_cnt_(0), single_req_cnt_(0), batch_pkt_cnt_(0), batch_pkt_size_(0),
+                    last_stat_ts_(0)
   {}
   ~ObBatchRpcBase()
   {
@@ -429,6 +431,8 @@ protected:
 private:
   RpcBuffer* create_buffer(const uint64_t tenant_id, const common::ObAddr& addr, const int64_t dst_cluster_id);
   void destroy_buffer(RpcBuffer* p);
+  void linger_after_wakeup();
+  void print_stat(const int64_t now);
 private:
   bool is_inited_;
   int batch_type_;
@@ -437,6 +441,13 @@ private:
   Rpc* rpc_;
   SendCond cond_;
   BufferMap *buffer_map_;
+  // requests coalesced into batch buffers / sent in a packet of their own since last print
+  int64_t batched_req_cnt_ CACHE_ALIGNED;
+  int64_t single_req_cnt_ CACHE_ALIGNED;
+  // packets and bytes sent from batch buffers, only updated by the batch rpc thread
+  int64_t batch_pkt_cnt_ CACHE_ALIGNED;
+  int64_t batch_pkt_size_;
+  int64_t last_stat_ts_;
 };
 
 class ObBatchRpc: public lib::TGRunnable
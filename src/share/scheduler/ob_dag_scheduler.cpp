@@ -1248,6 +1248,8 @@ const char *ObDagSchedulerInfo::ObValueTypeStr[VALUE_TYPE_MAX] =
     "DAG_COUNT",
     "DAG_NET_COUNT",
     "RUNNING_TASK_CNT",
+    "COMPACTION_THROTTLE",
+    "COMPACTION_WRITE",
 };
 
 const char* ObDagSchedulerInfo::get_value_type_str(ObValueType type)
@@ -1684,9 +1686,12 @@ void ObTenantDagScheduler::inner_free_dag(ObIDag &dag)
 void ObTenantDagScheduler::get_default_config()
 {
   int64_t threads_sum = 0;
+  throttle_info_.reset();
+  write_stat_.reset();
   for (int64_t i = 0; i < ObDagPrio::DAG_PRIO_MAX; ++i) { // calc sum of default_low_limit
     low_limits_[i] = OB_DAG_PRIOS[i].score_; // temp solution
     up_limits_[i] = OB_DAG_PRIOS[i].score_;
+    config_limits_[i] = OB_DAG_PRIOS[i].score_;
     threads_sum += up_limits_[i];
   }
   work_thread_num_ = threads_sum;
@@ -1901,7 +1906,8 @@ int ObTenantDagScheduler::get_all_dag_scheduler_info(
 {
   int ret = OB_SUCCESS;
   int64_t idx = 0;
-  int64_t total_cnt = 3 + 3 * ObDagPrio::DAG_PRIO_MAX + ObDagType::DAG_TYPE_MAX + ObDagNetType::DAG_NET_TYPE_MAX;
+  int64_t total_cnt = 3 + 3 * ObDagPrio::DAG_PRIO_MAX + ObDagType::DAG_TYPE_MAX + ObDagNetType::DAG_NET_TYPE_MAX
+      + ObCompactionThrottleInfo::SCHEDULER_INFO_CNT + ObCompactionWriteStat::SCHEDULER_INFO_CNT;
   void *buf = nullptr;
   ObDagSchedulerInfo *info_list = nullptr;
   if (OB_ISNULL(buf = allocator.alloc(sizeof(ObDagSchedulerInfo) * total_cnt))) {
@@ -1926,6 +1932,23 @@ int ObTenantDagScheduler::get_all_dag_scheduler_info(
       for (int64_t i = 0; i < ObDagNetType::DAG_NET_TYPE_MAX; ++i) {
         ADD_DAG_SCHEDULER_INFO(ObDagSchedulerInfo::DAG_NET_COUNT, OB_DAG_NET_TYPES[i].dag_net_type_str_, dag_net_cnts_[i]);
       }
+      ADD_DAG_SCHEDULER_INFO(ObDagSchedulerInfo::COMPACTION_THROTTLE, "CONCURRENCY_PCT", throttle_info_.concurrency_pct_);
+      ADD_DAG_SCHEDULER_INFO(ObDagSchedulerInfo::COMPACTION_THROTTLE, "FOREGROUND_P99_RT", throttle_info_.fg_rt_us_);
+      ADD_DAG_SCHEDULER_INFO(ObDagSchedulerInfo::COMPACTION_THROTTLE, "FOREGROUND_REQUEST_CNT", throttle_info_.fg_request_cnt_);
+      ADD_DAG_SCHEDULER_INFO(ObDagSchedulerInfo::COMPACTION_THROTTLE, "USER_IO_DEPTH", throttle_info_.user_io_depth_);
+      ADD_DAG_SCHEDULER_INFO(ObDagSchedulerInfo::COMPACTION_THROTTLE, "IO_BANDWIDTH_LIMIT", throttle_info_.io_bandwidth_limit_);
+      ADD_DAG_SCHEDULER_INFO(ObDagSchedulerInfo::COMPACTION_WRITE, "LEVELED_INGEST_BYTES",
+          ATOMIC_LOAD(&write_stat_.ingest_bytes_[ObCompactionWriteStat::LEVELED]));
+      ADD_DAG_SCHEDULER_INFO(ObDagSchedulerInfo::COMPACTION_WRITE, "LEVELED_WRITE_BYTES",
+          ATOMIC_LOAD(&write_stat_.write_bytes_[ObCompactionWriteStat::LEVELED]));
+      ADD_DAG_SCHEDULER_INFO(ObDagSchedulerInfo::COMPACTION_WRITE, "LEVELED_WRITE_AMPLIFICATION_PCT",
+          write_stat_.get_write_amplification_pct(ObCompactionWriteStat::LEVELED));
+      ADD_DAG_SCHEDULER_INFO(ObDagSchedulerInfo::COMPACTION_WRITE, "TIERED_INGEST_BYTES",
+          ATOMIC_LOAD(&write_stat_.ingest_bytes_[ObCompactionWriteStat::TIERED]));
+      ADD_DAG_SCHEDULER_INFO(ObDagSchedulerInfo::COMPACTION_WRITE, "TIERED_WRITE_BYTES",
+          ATOMIC_LOAD(&write_stat_.write_bytes_[ObCompactionWriteStat::TIERED]));
+      ADD_DAG_SCHEDULER_INFO(ObDagSchedulerInfo::COMPACTION_WRITE, "TIERED_WRITE_AMPLIFICATION_PCT",
+          write_stat_.get_write_amplification_pct(ObCompactionWriteStat::TIERED));
     }
   }
   return ret;
@@ -2960,6 +2983,55 @@ void ObTenantDagScheduler::update_work_thread_num()
   work_thread_num_ = threads_sum; 
 }
 
+const int64_t ObCompactionThrottleInfo::MAX_CONCURRENCY_PCT;
+
+// call this func with lock
+void ObTenantDagScheduler::update_limit(const int64_t priority)
+{
+  // mini merge releases memstore and is never throttled
+  if (ObDagPrio::DAG_PRIO_COMPACTION_MID == priority || ObDagPrio::DAG_PRIO_COMPACTION_LOW == priority) {
+    up_limits_[priority] = MAX(1, static_cast<int32_t>(
+        config_limits_[priority] * throttle_info_.concurrency_pct_ / ObCompactionThrottleInfo::MAX_CONCURRENCY_PCT));
+  } else {
+    up_limits_[priority] = config_limits_[priority];
+  }
+  low_limits_[priority] = up_limits_[priority];
+}
+
+int ObTenantDagScheduler::set_compaction_throttle(const ObCompactionThrottleInfo &throttle_info)
+{
+  int ret = OB_SUCCESS;
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+    COMMON_LOG(WARN, "ObTenantDagScheduler is not inited", K(ret));
+  } else if (OB_UNLIKELY(throttle_info.concurrency_pct_ <= 0
+      || throttle_info.concurrency_pct_ > ObCompactionThrottleInfo::MAX_CONCURRENCY_PCT)) {
+    ret = OB_INVALID_ARGUMENT;
+    COMMON_LOG(WARN, "invalid argument", K(ret), K(throttle_info));
+  } else {
+    ObThreadCondGuard guard(scheduler_sync_);
+    const int64_t old_pct = throttle_info_.concurrency_pct_;
+    throttle_info_ = throttle_info;
+    if (old_pct != throttle_info.concurrency_pct_) {
+      update_limit(ObDagPrio::DAG_PRIO_COMPACTION_MID);
+      update_limit(ObDagPrio::DAG_PRIO_COMPACTION_LOW);
+      update_work_thread_num();
+      // running merge tasks beyond the new limits are paused when they yield
+      scheduler_sync_.signal();
+      COMMON_LOG(INFO, "update compaction throttle", K(old_pct), K(throttle_info),
+          "minor_limit", up_limits_[ObDagPrio::DAG_PRIO_COMPACTION_MID],
+          "major_limit", up_limits_[ObDagPrio::DAG_PRIO_COMPACTION_LOW], K_(work_thread_num));
+    }
+  }
+  return ret;
+}
+
+void ObTenantDagScheduler::get_compaction_throttle(ObCompactionThrottleInfo &throttle_info)
+{
+  ObThreadCondGuard guard(scheduler_sync_);
+  throttle_info = throttle_info_;
+}
+
 int ObTenantDagScheduler::set_thread_score(const int64_t priority, const int32_t score)
 {
   int ret = OB_SUCCESS;
@@ -2972,8 +3044,8 @@ int ObTenantDagScheduler::set_thread_score(const int64_t priority, const int32_t
   } else {
     ObThreadCondGuard guard(scheduler_sync_);
     const int32_t old_val = up_limits_[priority];
-    up_limits_[priority] = 0 == score ? OB_DAG_PRIOS[priority].score_ : score;
-    low_limits_[priority] = up_limits_[priority];
+    config_limits_[priority] = 0 == score ? OB_DAG_PRIOS[priority].score_ : score;
+    update_limit(priority);
     if (old_val != up_limits_[priority]) {
       update_work_thread_num();
     }
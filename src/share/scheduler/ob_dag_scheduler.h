@@ -530,6 +530,8 @@ public:
     DAG_COUNT,
     DAG_NET_COUNT,
     RUNNING_TASK_CNT,
+    COMPACTION_THROTTLE,
+    COMPACTION_WRITE,
     VALUE_TYPE_MAX,
   };
   static const char *ObValueTypeStr[VALUE_TYPE_MAX];
@@ -720,6 +722,72 @@ private:
   bool is_inited_;
 };
 
+// set by the compaction governor of the tenant according to the foreground load
+struct ObCompactionThrottleInfo
+{
+public:
+  static const int64_t MAX_CONCURRENCY_PCT = 100;
+  // COMPACTION_THROTTLE rows shown in __all_virtual_dag_scheduler
+  static const int64_t SCHEDULER_INFO_CNT = 5;
+  ObCompactionThrottleInfo() { reset(); }
+  void reset()
+  {
+    concurrency_pct_ = MAX_CONCURRENCY_PCT;
+    fg_rt_us_ = 0;
+    fg_request_cnt_ = 0;
+    user_io_depth_ = 0;
+    io_bandwidth_limit_ = 0;
+  }
+  bool is_throttled() const { return concurrency_pct_ < MAX_CONCURRENCY_PCT || io_bandwidth_limit_ > 0; }
+  TO_STRING_KV(K_(concurrency_pct), K_(fg_rt_us), K_(fg_request_cnt), K_(user_io_depth), K_(io_bandwidth_limit));
+public:
+  int64_t concurrency_pct_;   // percentage of the minor/major merge thread score allowed to run
+  int64_t fg_rt_us_;          // p99 response time of the foreground requests in last round
+  int64_t fg_request_cnt_;
+  int64_t user_io_depth_;     // user io requests in flight
+  int64_t io_bandwidth_limit_; // write bytes per second of minor/major merge, 0 means unlimited
+};
+
+// bytes written by compaction of the tenant, to tell the write amplification of the merge policies
+struct ObCompactionWriteStat
+{
+public:
+  enum PolicyType
+  {
+    LEVELED = 0,
+    TIERED = 1,
+    POLICY_TYPE_MAX
+  };
+  // COMPACTION_WRITE rows shown in __all_virtual_dag_scheduler, 3 for each policy
+  static const int64_t SCHEDULER_INFO_CNT = 3 * POLICY_TYPE_MAX;
+  ObCompactionWriteStat() { reset(); }
+  void reset()
+  {
+    MEMSET(ingest_bytes_, 0, sizeof(ingest_bytes_));
+    MEMSET(write_bytes_, 0, sizeof(write_bytes_));
+  }
+  void add(const PolicyType type, const bool is_ingest, const int64_t bytes)
+  {
+    if (type >= LEVELED && type < POLICY_TYPE_MAX && bytes > 0) {
+      if (is_ingest) {
+        (void)ATOMIC_AAF(&ingest_bytes_[type], bytes);
+      }
+      (void)ATOMIC_AAF(&write_bytes_[type], bytes);
+    }
+  }
+  // bytes written by all kinds of compaction per 100 bytes dumped from memtables
+  int64_t get_write_amplification_pct(const PolicyType type) const
+  {
+    const int64_t ingest_bytes = ATOMIC_LOAD(&ingest_bytes_[type]);
+    return ingest_bytes > 0 ? ATOMIC_LOAD(&write_bytes_[type]) * 100 / ingest_bytes : 0;
+  }
+  TO_STRING_KV("leveled_ingest_bytes", ingest_bytes_[LEVELED], "leveled_write_bytes", write_bytes_[LEVELED],
+               "tiered_ingest_bytes", ingest_bytes_[TIERED], "tiered_write_bytes", write_bytes_[TIERED]);
+public:
+  int64_t ingest_bytes_[POLICY_TYPE_MAX]; // written by mini merge
+  int64_t write_bytes_[POLICY_TYPE_MAX];  // written by mini, minor and major merge
+};
+
 // TODO(@DanLing) parameters in ObTenantDagScheduler
 class DagSchedulerConfig
 {
@@ -801,6 +869,14 @@ public:
   int check_dag_net_exist(
       const ObDagId &dag_id, bool &exist);
   int cancel_dag_net(const ObDagId &dag_id);
+  int set_compaction_throttle(const ObCompactionThrottleInfo &throttle_info);
+  void get_compaction_throttle(ObCompactionThrottleInfo &throttle_info);
+  void add_compaction_write_bytes(
+      const ObCompactionWriteStat::PolicyType type,
+      const bool is_ingest,
+      const int64_t bytes)
+  { write_stat_.add(type, is_ingest, bytes); }
+  const ObCompactionWriteStat &get_compaction_write_stat() const { return write_stat_; }
 
 private:
   typedef common::ObDList<ObIDag> DagList;
@@ -873,6 +949,7 @@ private:
   void dump_dag_status();
   int check_need_load_shedding(const int64_t priority, const bool for_schedule, bool &need_shedding);
   void update_work_thread_num();
+  void update_limit(const int64_t priority);
   int move_dag_to_list_(
       ObIDag *dag,
       ObDagListIndex from_list_index,
@@ -917,6 +994,9 @@ private:
   int32_t running_task_cnts_[ObDagPrio::DAG_PRIO_MAX];
   int32_t low_limits_[ObDagPrio::DAG_PRIO_MAX]; // wait to delete
   int32_t up_limits_[ObDagPrio::DAG_PRIO_MAX]; // wait to delete
+  int32_t config_limits_[ObDagPrio::DAG_PRIO_MAX]; // thread score before compaction throttle
+  ObCompactionThrottleInfo throttle_info_;
+  ObCompactionWriteStat write_stat_;
   int64_t dag_cnts_[ObDagType::DAG_TYPE_MAX];
   int64_t dag_net_cnts_[ObDagNetType::DAG_NET_TYPE_MAX];
   common::ObConcurrentFIFOAllocator allocator_;
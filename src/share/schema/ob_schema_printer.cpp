@@ -1640,6 +1640,8 @@ int ObSchemaPrinter::print_table_definition_table_options(const ObTableSchema &t
     if (!agent_mode) {
       if (table_schema.is_queuing_table()) {
         table_mode_str = "QUEUING";
+      } else if (table_schema.is_tiered_table()) {
+        table_mode_str = "TIERED";
       }
     } else { // true == agent_mode
       table_mode_str = ObBackUpTableModeOp::get_table_mode_str(table_schema.get_table_mode_struct());
@@ -2092,6 +2094,8 @@ int ObSchemaPrinter::print_table_definition_table_options(
       if (!is_agent_mode) {
         if (table_schema.is_queuing_table()) {
           table_mode_str = "QUEUING";
+        } else if (table_schema.is_tiered_table()) {
+          table_mode_str = "TIERED";
         }
       } else { // true == agent_mode
         table_mode_str = ObBackUpTableModeOp::get_table_mode_str(table_schema.get_table_mode_struct());
@@ -36,7 +36,8 @@ ObTableSchemaParam::ObTableSchemaParam(ObIAllocator &allocator)
     columns_(allocator),
     col_map_(allocator),
     pk_name_(),
-    read_info_()
+    read_info_(),
+    ttl_param_()
 {
 }
 
@@ -59,6 +60,7 @@ void ObTableSchemaParam::reset()
   col_map_.clear();
   pk_name_.reset();
   read_info_.reset();
+  ttl_param_.reset();
 }
 
 int ObTableSchemaParam::convert(const ObTableSchema *schema)
@@ -156,6 +158,18 @@ int ObTableSchemaParam::convert(const ObTableSchema *schema)
       }
     }
   }
+
+  if (OB_SUCC(ret) && !schema->get_expire_info().empty()) {
+    uint64_t ttl_column_id = OB_INVALID_ID;
+    int32_t ttl_col_idx = OB_INVALID_INDEX;
+    if (OB_FAIL(ObTableTTLParam::get_ttl_column(*schema, ttl_column_id, ttl_param_.ttl_us_))) {
+      LOG_WARN("failed to get ttl column", K(ret), K(schema->get_expire_info()));
+    } else if (OB_FAIL(col_map_.get(ttl_column_id, ttl_col_idx))) {
+      LOG_WARN("failed to get ttl column index", K(ret), K(ttl_column_id));
+    } else {
+      ttl_param_.col_idx_ = ttl_col_idx;
+    }
+  }
   LOG_DEBUG("Generated read info", K_(read_info));
   return ret;
 }
@@ -316,7 +330,8 @@ int64_t ObTableSchemaParam::to_string(char *buf, const int64_t buf_len) const
        K_(index_name),
        K_(pk_name),
        K_(columns),
-       K_(read_info));
+       K_(read_info),
+       K_(ttl_param));
   J_OBJ_END();
   return pos;
 }
@@ -346,6 +361,7 @@ OB_DEF_SERIALIZE(ObTableSchemaParam)
       LOG_WARN("failed to serialize pk name", K(ret));
     }
   }
+  OB_UNIS_ENCODE(ttl_param_);
   return ret;
 }
 
@@ -388,6 +404,10 @@ OB_DEF_DESERIALIZE(ObTableSchemaParam)
        LOG_WARN("failed to copy pk name", K(ret), K(tmp_name));
      }
   }
+  // for compatibility: the ttl param is absent in the param sent by old servers
+  if (OB_SUCC(ret) && pos < data_len) {
+    OB_UNIS_DECODE(ttl_param_);
+  }
   return ret;
 }
 
@@ -416,6 +436,7 @@ OB_DEF_SERIALIZE_SIZE(ObTableSchemaParam)
   }
   OB_UNIS_ADD_LEN(read_info_);
   len += pk_name_.get_serialize_size();
+  OB_UNIS_ADD_LEN(ttl_param_);
   return len;
 }
 
@@ -76,6 +76,7 @@ public:
   bool is_depend_column(uint64_t column_id) const;
   const storage::ObTableReadInfo &get_read_info() const
   { return read_info_; }
+  OB_INLINE const ObTableTTLParam &get_ttl_param() const { return ttl_param_; }
   int has_udf_column(bool &has_udf) const;
 
   DECLARE_TO_STRING;
@@ -98,6 +99,8 @@ private:
   ColumnMap col_map_;
   common::ObString pk_name_; // use for printing error msg in oracle mode
   storage::ObTableReadInfo read_info_;
+  // the ttl column index is in columns_, dml treats rows expired at its snapshot as absent
+  ObTableTTLParam ttl_param_;
 };
 
 class ObTableDMLParam
@@ -561,6 +561,117 @@ DEFINE_GET_SERIALIZE_SIZE(ObColDesc)
   return len;
 }
 
+/************************************* ObTableTTLParam **********************************/
+OB_SERIALIZE_MEMBER(ObTableTTLParam, col_idx_, ttl_us_);
+
+int ObTableTTLParam::parse_expire_info(
+    const ObString &expire_info,
+    ObString &column_name,
+    int64_t &ttl_us)
+{
+  int ret = OB_SUCCESS;
+  static const int64_t TOKEN_CNT = 5; // <column> + INTERVAL n <unit>
+  static const struct {
+    const char *name_;
+    int64_t usecs_;
+  } TTL_UNITS[] = {
+    {"SECOND", 1000L * 1000L},
+    {"MINUTE", 60L * 1000L * 1000L},
+    {"HOUR", 3600L * 1000L * 1000L},
+    {"DAY", 24L * 3600L * 1000L * 1000L},
+    {"WEEK", 7L * 24L * 3600L * 1000L * 1000L},
+  };
+  ObString tokens[TOKEN_CNT];
+  int64_t token_cnt = 0;
+  const char *ptr = expire_info.ptr();
+  const int64_t len = expire_info.length();
+  int64_t pos = 0;
+  column_name.reset();
+  ttl_us = 0;
+  while (OB_SUCC(ret) && pos < len) {
+    if (isspace(ptr[pos])) {
+      ++pos;
+    } else if (token_cnt >= TOKEN_CNT) {
+      ret = OB_NOT_SUPPORTED;
+    } else {
+      const int64_t start_pos = pos++;
+      if ('+' != ptr[start_pos]) {
+        while (pos < len && !isspace(ptr[pos]) && '+' != ptr[pos]) {
+          ++pos;
+        }
+      }
+      tokens[token_cnt++].assign_ptr(ptr + start_pos, static_cast<int32_t>(pos - start_pos));
+    }
+  }
+
+  int64_t interval = 0;
+  if (OB_FAIL(ret)) {
+  } else if (TOKEN_CNT != token_cnt
+      || 0 != tokens[1].compare("+")
+      || 0 != tokens[2].case_compare("INTERVAL")) {
+    ret = OB_NOT_SUPPORTED;
+  } else {
+    const ObString &num = tokens[3];
+    for (int64_t i = 0; OB_SUCC(ret) && i < num.length(); ++i) {
+      if (!isdigit(num.ptr()[i]) || interval > (INT64_MAX - 9) / 10) {
+        ret = OB_NOT_SUPPORTED;
+      } else {
+        interval = interval * 10 + (num.ptr()[i] - '0');
+      }
+    }
+    if (OB_SUCC(ret) && interval <= 0) {
+      ret = OB_NOT_SUPPORTED;
+    }
+  }
+  if (OB_SUCC(ret)) {
+    ret = OB_NOT_SUPPORTED;
+    for (int64_t i = 0; i < ARRAYSIZEOF(TTL_UNITS); ++i) {
+      if (0 == tokens[4].case_compare(TTL_UNITS[i].name_)) {
+        if (interval <= INT64_MAX / TTL_UNITS[i].usecs_) {
+          ttl_us = interval * TTL_UNITS[i].usecs_;
+          ret = OB_SUCCESS;
+        }
+        break;
+      }
+    }
+  }
+  if (OB_SUCC(ret)) {
+    column_name = tokens[0];
+    if (column_name.length() > 2 && '`' == column_name.ptr()[0]
+        && '`' == column_name.ptr()[column_name.length() - 1]) {
+      column_name.assign_ptr(column_name.ptr() + 1, column_name.length() - 2);
+    }
+  } else {
+    LOG_WARN("unsupported expire info", K(ret), K(expire_info));
+  }
+  return ret;
+}
+
+int ObTableTTLParam::get_ttl_column(
+    const ObTableSchema &table_schema,
+    uint64_t &column_id,
+    int64_t &ttl_us)
+{
+  int ret = OB_SUCCESS;
+  ObString column_name;
+  const ObColumnSchemaV2 *column_schema = nullptr;
+  column_id = OB_INVALID_ID;
+  ttl_us = 0;
+  if (table_schema.get_expire_info().empty()) {
+  } else if (OB_FAIL(parse_expire_info(table_schema.get_expire_info(), column_name, ttl_us))) {
+    LOG_WARN("failed to parse expire info", K(ret), K(table_schema.get_expire_info()));
+  } else if (OB_ISNULL(column_schema = table_schema.get_column_schema(column_name))) {
+    ret = OB_ERR_BAD_FIELD_ERROR;
+    LOG_WARN("ttl column not exist", K(ret), K(column_name), K(table_schema.get_table_id()));
+  } else if (ObTimestampType != column_schema->get_data_type()) {
+    ret = OB_NOT_SUPPORTED;
+    LOG_WARN("ttl column should be timestamp", K(ret), KPC(column_schema));
+  } else {
+    column_id = column_schema->get_column_id();
+  }
+  return ret;
+}
+
 /************************************* ObTableParam **********************************/
 ObTableParam::ObTableParam(ObIAllocator &allocator)
   : allocator_(allocator),
@@ -572,7 +683,8 @@ ObTableParam::ObTableParam(ObIAllocator &allocator)
     has_virtual_column_(false),
     use_lob_locator_(false),
     rowid_version_(ObURowIDData::INVALID_ROWID_VERSION),
-    rowid_projector_(allocator)
+    rowid_projector_(allocator),
+    ttl_param_()
 {
   reset();
 }
@@ -593,6 +705,7 @@ void ObTableParam::reset()
   rowid_version_ = ObURowIDData::INVALID_ROWID_VERSION;
   rowid_projector_.reset();
   main_read_info_.reset();
+  ttl_param_.reset();
 }
 
 OB_DEF_SERIALIZE(ObTableParam)
@@ -609,7 +722,8 @@ OB_DEF_SERIALIZE(ObTableParam)
               use_lob_locator_,
               rowid_version_,
               rowid_projector_,
-              main_read_info_);
+              main_read_info_,
+              ttl_param_);
 
   return ret;
 }
@@ -633,6 +747,7 @@ OB_DEF_DESERIALIZE(ObTableParam)
       LOG_WARN("Fail to deserialize read info", K(ret));
     }
   }
+  OB_UNIS_DECODE(ttl_param_);
 
   return ret;
 }
@@ -652,7 +767,8 @@ OB_DEF_SERIALIZE_SIZE(ObTableParam)
               use_lob_locator_,
               rowid_version_,
               rowid_projector_,
-              main_read_info_);
+              main_read_info_,
+              ttl_param_);
 
   return len;
 }
@@ -854,6 +970,56 @@ int ObTableParam::construct_columns_and_projector(
     }
   }
 
+  // ttl column, needed to mask expired rows even if not accessed by the query
+  if (OB_SUCC(ret) && !table_schema.get_expire_info().empty()) {
+    uint64_t ttl_column_id = OB_INVALID_ID;
+    int64_t ttl_us = 0;
+    int64_t ttl_col_idx = OB_INVALID_INDEX;
+    if (OB_FAIL(ObTableTTLParam::get_ttl_column(table_schema, ttl_column_id, ttl_us))) {
+      LOG_WARN("failed to get ttl column", K(ret), K(table_schema.get_expire_info()));
+    } else {
+      for (int64_t i = 0; OB_INVALID_INDEX == ttl_col_idx && i < tmp_access_cols_desc.count(); ++i) {
+        if (ttl_column_id == tmp_access_cols_desc.at(i).col_id_) {
+          ttl_col_idx = i;
+        }
+      }
+    }
+    if (OB_SUCC(ret) && OB_INVALID_INDEX == ttl_col_idx) {
+      const ObColumnSchemaV2 *column_schema = table_schema.get_column_schema(ttl_column_id);
+      ObColumnParam *column = NULL;
+      int32_t col_index = OB_INVALID_INDEX;
+      for (int32_t j = 0; OB_INVALID_INDEX == col_index && j < column_ids_no_virtual.count(); ++j) {
+        if (ttl_column_id == column_ids_no_virtual.at(j).col_id_) {
+          col_index = j;
+        }
+      }
+      if (OB_ISNULL(column_schema)) {
+        ret = OB_ERR_UNEXPECTED;
+        LOG_WARN("The ttl column is NULL", K(ret), K(ttl_column_id));
+      } else if (OB_FAIL(alloc_column(allocator_, column))) {
+        LOG_WARN("alloc column failed", K(ret));
+      } else if (OB_FAIL(convert_column_schema_to_param(*column_schema, *column))) {
+        LOG_WARN("convert failed", K(ret), K(*column_schema));
+      } else {
+        tmp_col_desc.col_id_ = column->get_column_id();
+        tmp_col_desc.col_type_ = column->get_meta_type();
+        tmp_col_desc.col_order_ = column->get_column_order();
+        ttl_col_idx = tmp_access_cols_param.count();
+        if (OB_FAIL(tmp_access_cols_param.push_back(column))) {
+          LOG_WARN("fail to push_back tmp_access_cols_param", K(ret));
+        } else if (OB_FAIL(tmp_access_cols_desc.push_back(tmp_col_desc))) {
+          LOG_WARN("fail to push_back tmp_access_cols_desc", K(ret));
+        } else if (OB_FAIL(tmp_access_cols_index.push_back(col_index))) {
+          LOG_WARN("fail to push_back tmp_access_cols_index", K(ret));
+        }
+      }
+    }
+    if (OB_SUCC(ret)) {
+      ttl_param_.col_idx_ = ttl_col_idx;
+      ttl_param_.ttl_us_ = ttl_us;
+    }
+  }
+
   // output projector
   if (OB_SUCC(ret)) {
     for (int32_t i = 0; OB_SUCC(ret) && i < output_column_ids.count(); ++i) {
@@ -1196,7 +1362,8 @@ int64_t ObTableParam::to_string(char *buf, const int64_t buf_len) const
        K_(main_read_info),
        K_(use_lob_locator),
        K_(rowid_version),
-       K_(rowid_projector));
+       K_(rowid_projector),
+       K_(ttl_param));
   J_OBJ_END();
 
   return pos;
@@ -241,6 +241,47 @@ typedef common::ObFixedArray<int32_t, common::ObIAllocator> Projector;
 
 class ObTableSchema;
 class ObColumnSchemaV2;
+
+// Table level TTL, declared by EXPIRE_INFO = (<timestamp column> + INTERVAL n SECOND|MINUTE|HOUR|DAY|WEEK).
+// A row is expired once its ttl column is older than the read snapshot minus the interval,
+// expired rows are masked by queries and removed by major merge.
+struct ObTableTTLParam
+{
+  OB_UNIS_VERSION(1);
+public:
+  ObTableTTLParam() : col_idx_(common::OB_INVALID_INDEX), ttl_us_(0) {}
+  ~ObTableTTLParam() {}
+  void reset() { col_idx_ = common::OB_INVALID_INDEX; ttl_us_ = 0; }
+  OB_INLINE bool is_valid() const { return col_idx_ >= 0 && ttl_us_ > 0; }
+  OB_INLINE bool is_expired(const blocksstable::ObStorageDatum &datum, const int64_t snapshot_version) const
+  {
+    return is_expired(datum, ttl_us_, snapshot_version);
+  }
+  // @snapshot_version is a scn in nanoseconds, the ttl column holds microseconds
+  OB_INLINE static bool is_expired(
+      const blocksstable::ObStorageDatum &datum,
+      const int64_t ttl_us,
+      const int64_t snapshot_version)
+  {
+    return !datum.is_null() && !datum.is_nop()
+        && datum.get_timestamp() <= snapshot_version / 1000 - ttl_us;
+  }
+  // parse "<column> + INTERVAL n <unit>", return OB_NOT_SUPPORTED for any other expression
+  static int parse_expire_info(
+      const common::ObString &expire_info,
+      common::ObString &column_name,
+      int64_t &ttl_us);
+  // @column_id is OB_INVALID_ID if the table has no expire info
+  static int get_ttl_column(
+      const ObTableSchema &table_schema,
+      uint64_t &column_id,
+      int64_t &ttl_us);
+  TO_STRING_KV(K_(col_idx), K_(ttl_us));
+
+  int64_t col_idx_; // index of the ttl column in the accessed (or merged) row
+  int64_t ttl_us_;
+};
+
 class ObTableParam
 {
   OB_UNIS_VERSION_V(1);
@@ -276,6 +317,7 @@ public:
   inline const common::ObIArray<int32_t> &get_pad_col_projector() const { return pad_col_projector_; }
   inline void disable_padding() { pad_col_projector_.reset(); }
   inline const storage::ObTableReadInfo &get_read_info() const { return main_read_info_; }
+  inline const ObTableTTLParam &get_ttl_param() const { return ttl_param_; }
 
   DECLARE_TO_STRING;
 
@@ -337,6 +379,8 @@ private:
   bool use_lob_locator_;
   int64_t rowid_version_;
   Projector rowid_projector_;
+  // the ttl column is appended to the access columns if not accessed by the query
+  ObTableTTLParam ttl_param_;
 };
 } //namespace schema
 } //namespace share
@@ -124,6 +124,7 @@ enum ObTableModeFlag
   TABLE_MODE_NORMAL = 0,
   TABLE_MODE_QUEUING = 1,
   TABLE_MODE_PRIMARY_AUX_VP = 2,
+  TABLE_MODE_TIERED = 3, // append-heavy table, minor sstables are merged by size tiers
   TABLE_MODE_MAX,
 };
 
@@ -276,6 +277,10 @@ struct ObBackUpTableModeOp
       "QUEUING|NEW_NO_PK_MODE": TABLE_MODE_QUEUING && TPKM_NEW_NO_PK
       "QUEUING|HEAP_ORGANIZED_TABLE":TABLE_MODE_QUEUING && TOM_HEAP_ORGANIZED
       "QUEUING|INDEX_ORGANIZED_TABLE":TABLE_MODE_QUEUING && TOM_INDEX_ORGANIZED
+      "TIERED":TABLE_MODE_TIERED
+      "TIERED|NEW_NO_PK_MODE": TABLE_MODE_TIERED && TPKM_NEW_NO_PK
+      "TIERED|HEAP_ORGANIZED_TABLE":TABLE_MODE_TIERED && TOM_HEAP_ORGANIZED
+      "TIERED|INDEX_ORGANIZED_TABLE":TABLE_MODE_TIERED && TOM_INDEX_ORGANIZED
   */
   static common::ObString get_table_mode_str(const ObTableMode mode) {
     common::ObString ret_str = "";
@@ -289,6 +294,16 @@ struct ObBackUpTableModeOp
       } else {
         ret_str = "QUEUING";
       }
+    } else if (TABLE_MODE_TIERED == mode.mode_flag_) {
+      if (TPKM_NEW_NO_PK == mode.pk_mode_) {
+        ret_str = "TIERED|NEW_NO_PK_MODE";
+      } else if (TOM_HEAP_ORGANIZED == mode.organization_mode_) {
+        ret_str = "TIERED|HEAP_ORGANIZED_TABLE";
+      } else if (TOM_INDEX_ORGANIZED == mode.organization_mode_) {
+        ret_str = "TIERED|INDEX_ORGANIZED_TABLE";
+      } else {
+        ret_str = "TIERED";
+      }
     } else if (TPKM_NEW_NO_PK == mode.pk_mode_) {
       ret_str = "NEW_NO_PK_MODE";
     } else if (TOM_HEAP_ORGANIZED == mode.organization_mode_) {
@@ -316,6 +331,8 @@ struct ObBackUpTableModeOp
          // do nothing
        } else if (0 == flag_str.case_compare("queuing")) {
          ret_mode.mode_flag_ = TABLE_MODE_QUEUING;
+       } else if (0 == flag_str.case_compare("tiered")) {
+         ret_mode.mode_flag_ = TABLE_MODE_TIERED;
        } else if (0 == flag_str.case_compare("new_no_pk_mode")) {
          ret_mode.pk_mode_ = TPKM_NEW_NO_PK;
        } else if (0 == flag_str.case_compare("heap_organized_table")) {
@@ -541,6 +558,8 @@ public:
   { table_mode_.state_flag_ = flag; }
   inline bool is_queuing_table() const
   { return TABLE_MODE_QUEUING == (enum ObTableModeFlag)table_mode_.mode_flag_; }
+  inline bool is_tiered_table() const
+  { return TABLE_MODE_TIERED == (enum ObTableModeFlag)table_mode_.mode_flag_; }
   inline bool is_iot_table() const
   { return TOM_INDEX_ORGANIZED == (enum ObTableOrganizationMode)table_mode_.organization_mode_; }
   inline bool is_heap_table() const
@@ -580,7 +580,8 @@ ObTableRequestOptions::ObTableRequestOptions()
      returning_affected_rows_(false),
      returning_rowkey_(false),
      returning_affected_entity_(false),
-     binlog_row_image_type_(ObBinlogRowImageType::FULL)
+     binlog_row_image_type_(ObBinlogRowImageType::FULL),
+     query_result_size_(-1)
 {}
 
 ////////////////////////////////////////////////////////////////
@@ -432,6 +432,9 @@ public:
   bool returning_affected_entity() const { return returning_affected_entity_; }
   void set_binlog_row_image_type(ObBinlogRowImageType type) { binlog_row_image_type_ = type; }
   ObBinlogRowImageType binlog_row_image_type() const { return binlog_row_image_type_; }
+  /// bytes of one result packet for stream query, only used when the query itself sets none
+  void set_query_result_size(int64_t result_size) { query_result_size_ = result_size; }
+  int64_t query_result_size() const { return query_result_size_; }
 private:
   ObTableConsistencyLevel consistency_level_;
   int64_t server_timeout_us_;
@@ -443,6 +446,7 @@ private:
   // bool batch_operation_as_atomic_;  // default: false
   // int route_policy
   ObBinlogRowImageType binlog_row_image_type_;  // default: FULL
+  int64_t query_result_size_;  // default: -1, decided by server
 };
 
 /// A batch operation
@@ -31,6 +31,21 @@ public:
   RPC_SS(PR5 execute_query, obrpc::OB_TABLE_API_EXECUTE_QUERY, (table::ObTableQueryRequest), table::ObTableQueryResult);
   RPC_S(PR5 query_and_mutate, obrpc::OB_TABLE_API_QUERY_AND_MUTATE, (table::ObTableQueryAndMutateRequest), table::ObTableQueryAndMutateResult);
   RPC_S(PR5 execute_query_sync, obrpc::OB_TABLE_API_EXECUTE_QUERY_SYNC, (table::ObTableQuerySyncRequest), table::ObTableQuerySyncResult);
+
+  // asynchronous batch_execute sharing the packet struct of the synchronous one above,
+  // used by the client to keep one request per tablet in flight
+  int async_batch_execute(const table::ObTableBatchOperationRequest &args,
+                          AsyncCB<obrpc::OB_TABLE_API_BATCH_EXECUTE> *cb,
+                          const ObRpcOpts &opts = ObRpcOpts())
+  {
+    ObRpcOpts newopts = opts;
+    if (newopts.pr_ == ORPR_UNDEF) {
+      newopts.pr_ = ORPR5;
+    }
+    newopts.ssl_invited_nodes_ = GCONF._ob_ssl_invited_nodes.get_value_string();
+    newopts.local_addr_ = GCTX.self_addr();
+    return rpc_post<ObRpc<obrpc::OB_TABLE_API_BATCH_EXECUTE>>(args, cb, newopts);
+  }
 };
 
 }; // end namespace obrpc
@@ -6315,9 +6315,24 @@ int ObLogPlan::try_push_aggr_into_table_scan(ObLogicalOperator *top,
     LOG_WARN("get unexpected null", K(ret), K(top));
   } else if (log_op_def::LOG_TABLE_SCAN == top->get_type()) {
     ObLogTableScan *scan_op = static_cast<ObLogTableScan*>(top);
+    ObSqlSchemaGuard *schema_guard = NULL;
+    const ObTableSchema *table_schema = NULL;
     if (scan_op->get_index_back() ||
         scan_op->is_sample_scan()) {
       // can not push down
+    } else if (OB_ISNULL(schema_guard = get_optimizer_context().get_sql_schema_guard())) {
+      ret = OB_ERR_UNEXPECTED;
+      LOG_WARN("get unexpected null", K(ret));
+    } else if (OB_FAIL(schema_guard->get_table_schema(scan_op->get_table_id(),
+                                                      scan_op->get_ref_table_id(),
+                                                      get_stmt(),
+                                                      table_schema))) {
+      LOG_WARN("fail to get table schema", K(ret), K(scan_op->get_ref_table_id()));
+    } else if (OB_ISNULL(table_schema)) {
+      ret = OB_ERR_UNEXPECTED;
+      LOG_WARN("get unexpected null", K(ret), K(scan_op->get_ref_table_id()));
+    } else if (!table_schema->get_expire_info().empty()) {
+      // storage masks expired rows one by one, they can't be aggregated by blocks
     } else if (OB_FAIL(scan_op->get_pushdown_aggr_exprs().assign(aggr_items))) {
       LOG_WARN("failed to assign group exprs", K(ret));
     }
@@ -700,6 +700,68 @@ int ObParser::check_is_insert(common::ObIArray<common::ObString> &queries, bool
   return ret;
 }
 
+int ObParser::check_is_homogeneous_dml(const common::ObIArray<common::ObString> &queries,
+                                       bool &is_homogeneous)
+{
+  int ret = OB_SUCCESS;
+  static const char *dml_keywords[] = { "insert", "update", "delete" };
+  static const int64_t dml_keyword_len = 6;
+  int64_t first_kw_idx = -1;
+  is_homogeneous = queries.count() > 1;
+  for (int64_t i = 0; OB_SUCC(ret) && is_homogeneous && i < queries.count(); ++i) {
+    const ObString &query = queries.at(i);
+    const char *p = query.ptr();
+    const char *p_end = p + query.length();
+    int64_t kw_idx = -1;
+    // skip leading white spaces and comments, multi-stmt queries are split by ';'
+    // and usually start with a new line
+    bool skip_done = false;
+    while (!skip_done && p < p_end) {
+      if (ISSPACE(*p)) {
+        ++p;
+      } else if ('#' == *p || ('-' == *p && p + 1 < p_end && '-' == *(p + 1))) {
+        while (p < p_end && '\n' != *p) {
+          ++p;
+        }
+      } else if ('/' == *p && p + 2 < p_end && '*' == *(p + 1) && '!' != *(p + 2)) {
+        // '/*! */' is executed by mysql, keep it and let the normal path handle it
+        const char *c_end = p + 2;
+        while (c_end + 1 < p_end && !('*' == *c_end && '/' == *(c_end + 1))) {
+          ++c_end;
+        }
+        if (c_end + 1 < p_end) {
+          p = c_end + 2;
+        } else {
+          skip_done = true;
+        }
+      } else {
+        skip_done = true;
+      }
+    }
+    // the keyword may be followed directly by hints or comments, e.g. insert/*+ ... */ into
+    if (p_end - p > dml_keyword_len
+        && (ISSPACE(*(p + dml_keyword_len))
+            || '/' == *(p + dml_keyword_len)
+            || '-' == *(p + dml_keyword_len)
+            || '#' == *(p + dml_keyword_len))) {
+      for (int64_t j = 0; kw_idx < 0 && j < ARRAYSIZEOF(dml_keywords); ++j) {
+        if (0 == STRNCASECMP(p, dml_keywords[j], dml_keyword_len)) {
+          kw_idx = j;
+        }
+      }
+    }
+    if (kw_idx < 0) {
+      // not a batchable dml, let the normal path handle it
+      is_homogeneous = false;
+    } else if (first_kw_idx < 0) {
+      first_kw_idx = kw_idx;
+    } else if (first_kw_idx != kw_idx) {
+      is_homogeneous = false;
+    }
+  }
+  return ret;
+}
+
 int ObParser::reconstruct_insert_sql(const common::ObString &stmt,
                                      common::ObIArray<common::ObString> &queries,
                                      common::ObIArray<common::ObString> &ins_queries,
@@ -65,6 +65,10 @@ public:
   void get_single_sql(const common::ObString &stmt, int64_t offset, int64_t remain, int64_t &str_len);
 
   int check_is_insert(common::ObIArray<common::ObString> &queries, bool &is_ins);
+  // cheap check before batched multi-stmt optimization: all queries must be the same kind of
+  // batchable DML (insert/update/delete), otherwise the batched attempt is doomed to rollback.
+  static int check_is_homogeneous_dml(const common::ObIArray<common::ObString> &queries,
+                                      bool &is_homogeneous);
   int reconstruct_insert_sql(const common::ObString &stmt,
                              common::ObIArray<common::ObString> &queries,
                              common::ObIArray<common::ObString> &ins_queries,
@@ -1101,6 +1101,10 @@ int ObAlterTableResolver::resolve_add_index(const ParseNode &node)
   if (T_INDEX_ADD != node.type_ || OB_ISNULL(node.children_)) {
     ret = OB_ERR_UNEXPECTED;
     SQL_RESV_LOG(WARN, "invalid parse tree!", K(ret));
+  } else if (OB_NOT_NULL(table_schema_) && !table_schema_->get_expire_info().empty()) {
+    ret = OB_NOT_SUPPORTED;
+    SQL_RESV_LOG(WARN, "add index on table with expire info not supported", K(ret));
+    LOG_USER_ERROR(OB_NOT_SUPPORTED, "create index on table with expire info");
   } else {
     bool is_unique_key = 1 == node.value_;
     ParseNode *index_name_node = nullptr;
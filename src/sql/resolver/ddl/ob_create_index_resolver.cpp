@@ -460,6 +460,11 @@ int ObCreateIndexResolver::resolve(const ParseNode &parse_tree)
   } else if (OB_ISNULL(tbl_schema)) {
     ret = OB_ERR_UNEXPECTED;
     LOG_WARN("table schema is NULL", K(ret));
+  } else if (!tbl_schema->get_expire_info().empty()) {
+    // expired rows are removed by major merge of the data table only
+    ret = OB_NOT_SUPPORTED;
+    LOG_WARN("create index on table with expire info not supported", K(ret), K(tbl_schema->get_expire_info()));
+    LOG_USER_ERROR(OB_NOT_SUPPORTED, "create index on table with expire info");
   } else {
     is_oracle_temp_table_ = (tbl_schema->is_oracle_tmp_table());
     ObTableSchema &index_schema = crt_idx_stmt->get_create_index_arg().index_schema_;
@@ -20,6 +20,7 @@
 #include "common/sql_mode/ob_sql_mode_utils.h"
 #include "common/ob_store_format.h"
 #include "share/schema/ob_table_schema.h"
+#include "share/schema/ob_table_param.h"
 #include "share/config/ob_server_config.h"
 #include "sql/resolver/ddl/ob_create_table_stmt.h"
 #include "sql/resolver/expr/ob_raw_expr_util.h"
@@ -610,6 +611,24 @@ int ObCreateTableResolver::resolve(const ParseNode &parse_tree)
             SQL_RESV_LOG(WARN, "resolve check constraint failed", K(ret));
           } else { /* do nothing */ }
         }
+        if (OB_SUCC(ret) && !expire_info_.empty()) {
+          // expired rows are removed by major merge of the data table only
+          const ObTableSchema &table_schema = create_table_stmt->get_create_table_arg().schema_;
+          uint64_t ttl_column_id = OB_INVALID_ID;
+          int64_t ttl_us = 0;
+          if (create_table_stmt->get_index_arg_list().count() > 0) {
+            ret = OB_NOT_SUPPORTED;
+            LOG_USER_ERROR(OB_NOT_SUPPORTED, "create index on table with expire info");
+          } else if (OB_FAIL(ObTableTTLParam::get_ttl_column(table_schema, ttl_column_id, ttl_us))) {
+            SQL_RESV_LOG(WARN, "failed to get ttl column", K(ret), K_(expire_info));
+            if (OB_ERR_BAD_FIELD_ERROR == ret) {
+              ret = OB_NOT_SUPPORTED;
+              LOG_USER_ERROR(OB_NOT_SUPPORTED, "expire info on column not exist");
+            } else if (OB_NOT_SUPPORTED == ret) {
+              LOG_USER_ERROR(OB_NOT_SUPPORTED, "expire info on column other than timestamp");
+            }
+          }
+        }
         // 对foreign key 进行references 权限检查
         if (OB_SUCC(ret) && ObSchemaChecker::is_ora_priv_check()) {
           const ObSArray<ObCreateForeignKeyArg> &fka_list =
@@ -2636,6 +2655,10 @@ int ObCreateTableResolver::resolve_vertical_partition(const ParseNode *node)
     ret = OB_NOT_SUPPORTED;
     LOG_USER_ERROR(OB_NOT_SUPPORTED, "Vertical partition table cannot set queuing table mode");
     SQL_RESV_LOG(WARN, "Vertical partition table cannot set queuing table mode", K(ret));
+  } else if (table_mode_.mode_flag_ == TABLE_MODE_TIERED) {
+    ret = OB_NOT_SUPPORTED;
+    LOG_USER_ERROR(OB_NOT_SUPPORTED, "Vertical partition table cannot set tiered table mode");
+    SQL_RESV_LOG(WARN, "Vertical partition table cannot set tiered table mode", K(ret));
   } else {
     SMART_VAR(VPColumnIdHashSet, vp_column_id_set) {
       for (int64_t i = 0; OB_SUCC(ret) && i < node->num_child_; ++i) {
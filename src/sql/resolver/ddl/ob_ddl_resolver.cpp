@@ -18,6 +18,7 @@
 #include "lib/charset/ob_charset.h"
 #include "lib/string/ob_sql_string.h"
 #include "share/schema/ob_table_schema.h"
+#include "share/schema/ob_table_param.h"
 #include "share/schema/ob_part_mgr_util.h"
 #include "sql/resolver/ddl/ob_create_table_stmt.h"
 #include "sql/resolver/ddl/ob_alter_table_stmt.h"
@@ -792,59 +793,32 @@ int ObDDLResolver::resolve_table_option(const ParseNode *option_node, const bool
   }
   if (OB_SUCCESS == ret && NULL != option_node) {
     switch (option_node->type_) {
-    case T_EXPIRE_INFO: {
-//        //not supported in version(1.0)
-//        ret = OB_NOT_SUPPORTED;
-//        LOG_USER_ERROR(ret, "expire info in version(1.0)");
-//        if (stmt::T_CREATE_INDEX == stmt_->get_stmt_type()) {
-//          ret = OB_ERR_PARSE_SQL;
-//          SQL_RESV_LOG(WARN, "Expire info can not be specified in index option", K(ret));
-//        }
-//        const bool is_index_table = false;
-//        if (OB_ISNULL(option_node->children_)) {
-//          ret = OB_ERR_UNEXPECTED;
-//          SQL_RESV_LOG(WARN, "(the children of option_node is null", K(option_node->children_), K(ret));
-//        } else if (NULL != option_node->children_[0] && T_NULL == option_node->children_[0]->type_) {
-//          //drop expire info
-//          expire_info_.assign_ptr(NULL, 0);
-//        } else {
-//          ObRawExpr *expr = NULL;
-//          ObString expire_info;
-//          expire_info.assign_ptr(const_cast<char *>(option_node->str_value_),
-//                                 static_cast<int32_t>(option_node->str_len_));
-//          if (OB_ISNULL(option_node->children_[0])) {
-//            ret = OB_ERR_UNEXPECTED;
-//            SQL_RESV_LOG(ERROR,"children can't be null", K(ret));
-//          } else if (OB_FAIL(ob_write_string(*allocator_, expire_info, expire_info_))) {
-//            SQL_RESV_LOG(WARN, "write string failed", K(ret));
-//          } else {
-//            if (stmt::T_ALTER_TABLE != stmt_->get_stmt_type()) {
-//              if (OB_FAIL(schema_checker_->get_table_schema(tenant_id, database_id, table_name_,
-//                                                            is_index_table, &tab_schema))) {
-//                SQL_RESV_LOG(WARN, "table is not exist", K(tenant_id), K(database_id), K_(table_name), K(ret));
-//              } else if (OB_ISNULL(tab_schema)) {
-//                ret = OB_ERR_UNEXPECTED;
-//                SQL_RESV_LOG(WARN, "tab schema is null", K(tab_schema), K(ret));
-//              } else if ((tab_schema->get_progressive_merge_num() > 1 || progressive_merge_num_ > 1)
-//                         && tab_schema->get_index_tid_count() > 0) {
-//                ret = OB_OP_NOT_ALLOW;
-//                SQL_RESV_LOG(WARN, "this progressive merge num > 1 and contain index table", K(ret));
-//              } else if (OB_FAIL(resolve_sql_expr(*(option_node->children_[0]), expr, T_EXPIRE_SCOPE))
-//                  || OB_FAIL(stmt_->get_condition_exprs().push_back(expr))) {
-//                if (OB_ERR_BAD_FIELD_ERROR != ret) {
-//                  SQL_RESV_LOG(WARN, "Resolve expire info failed", K(ret));
-//                }
-//              }
-//            } else {
-//              //mark alter table option
-//              if (OB_FAIL(alter_table_bitset_.add_member(ObAlterTableArg::EXPIRE_INFO))) {
-//                SQL_RESV_LOG(WARN, "failed to add member to bitset!", K(ret));
-//              }
-//            }
-//          }
-//        }
-      break;
-    }
+      case T_EXPIRE_INFO: {
+        ObString expire_info;
+        ObString ttl_column_name;
+        int64_t ttl_us = 0;
+        if (is_index_option) {
+          ret = OB_NOT_SUPPORTED;
+          LOG_USER_ERROR(OB_NOT_SUPPORTED, "specify expire info in index option");
+        } else if (OB_ISNULL(option_node->children_) || OB_ISNULL(option_node->children_[0])) {
+          ret = OB_ERR_UNEXPECTED;
+          SQL_RESV_LOG(WARN, "the children of option_node is null", K(ret));
+        } else if (FALSE_IT(expire_info.assign_ptr(option_node->str_value_,
+                                                   static_cast<int32_t>(option_node->str_len_)))) {
+        } else if (OB_FAIL(ObTableTTLParam::parse_expire_info(expire_info, ttl_column_name, ttl_us))) {
+          if (OB_NOT_SUPPORTED == ret) {
+            LOG_USER_ERROR(OB_NOT_SUPPORTED, "expire info other than (<timestamp column> + INTERVAL n SECOND|MINUTE|HOUR|DAY|WEEK)");
+          }
+          SQL_RESV_LOG(WARN, "failed to parse expire info", K(ret), K(expire_info));
+        } else if (OB_FAIL(ob_write_string(*allocator_, expire_info, expire_info_))) {
+          SQL_RESV_LOG(WARN, "write string failed", K(ret));
+        } else if (stmt::T_ALTER_TABLE == stmt_->get_stmt_type()) {
+          if (OB_FAIL(alter_table_bitset_.add_member(ObAlterTableArg::EXPIRE_INFO))) {
+            SQL_RESV_LOG(WARN, "failed to add member to bitset!", K(ret));
+          }
+        }
+        break;
+      }
       case T_BLOCK_SIZE: {
         if (OB_ISNULL(option_node->children_[0])) {
           ret = OB_ERR_UNEXPECTED;
@@ -1325,6 +1299,8 @@ int ObDDLResolver::resolve_table_option(const ParseNode *option_node, const bool
             table_mode_.mode_flag_ = TABLE_MODE_NORMAL;
           } else if (0 == table_mode_str.case_compare("queuing")) {
             table_mode_.mode_flag_ = TABLE_MODE_QUEUING;
+          } else if (0 == table_mode_str.case_compare("tiered")) {
+            table_mode_.mode_flag_ = TABLE_MODE_TIERED;
           } else if (0 == table_mode_str.case_compare("heap_organized_table")) {
             table_mode_.organization_mode_ = TOM_HEAP_ORGANIZED;
             table_mode_.pk_mode_ = TPKM_TABLET_SEQ_PK;
@@ -1349,6 +1325,11 @@ int ObDDLResolver::resolve_table_option(const ParseNode *option_node, const bool
                 ret = OB_NOT_SUPPORTED;
                 LOG_USER_ERROR(OB_NOT_SUPPORTED, "set vertical partition table as queuing table mode");
                 SQL_RESV_LOG(WARN, "Vertical partition table cannot set queuing table mode", K(ret));
+              } else if ((tmp_table_schema.is_primary_aux_vp_table() || tmp_table_schema.is_aux_vp_table())
+                  && table_mode_.mode_flag_ == TABLE_MODE_TIERED) {
+                ret = OB_NOT_SUPPORTED;
+                LOG_USER_ERROR(OB_NOT_SUPPORTED, "set vertical partition table as tiered table mode");
+                SQL_RESV_LOG(WARN, "Vertical partition table cannot set tiered table mode", K(ret));
               } else { // 暂不支持用户在alter table时变更PK_MODE
                 // 设置Table当前的PK_MODE，组装最终态TableMode
                 table_mode_.pk_mode_ = tmp_table_schema.get_table_mode_struct().pk_mode_;
@@ -645,7 +645,16 @@ int ObMultipleMerge::process_fuse_row(const bool not_using_static_engine,
   bool is_filter_filtered = false;
   out_row = nullptr;
   bool need_fill_lob = false;
-  if (OB_FAIL((not_using_static_engine)
+  const ObTableTTLParam *ttl_param = access_param_->ttl_param_;
+  if (nullptr != ttl_param && OB_UNLIKELY(in_row.count_ <= ttl_param->col_idx_)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("ttl column not in row", K(ret), K(in_row), KPC(ttl_param));
+  } else if (nullptr != ttl_param
+      && ttl_param->is_expired(in_row.storage_datums_[ttl_param->col_idx_],
+                               access_ctx_->trans_version_range_.snapshot_version_)) {
+    // mask rows expired at the read snapshot, they may not be removed by major merge yet
+    need_skip = true;
+  } else if (OB_FAIL((not_using_static_engine)
           ?  project_row(in_row,
                          access_param_->iter_param_.out_cols_project_,
                          range_idx_delta_,
@@ -149,6 +149,7 @@ ObTableAccessParam::ObTableAccessParam()
       row2exprs_projector_(NULL),
       output_sel_mask_(NULL),
       fast_agg_project_(NULL),
+      ttl_param_(NULL),
       is_inited_(false)
 {
 }
@@ -168,6 +169,7 @@ void ObTableAccessParam::reset()
   row2exprs_projector_ = NULL;
   output_sel_mask_ = NULL;
   fast_agg_project_ = NULL;
+  ttl_param_ = NULL;
   is_inited_ = false;
 }
 
@@ -212,6 +214,14 @@ int ObTableAccessParam::init(
       iter_param_.disable_blockscan();
 
     }
+    if (table_param.get_ttl_param().is_valid()) {
+      // every row need be checked for expiry, so no rows should be filtered or aggregated
+      // in micro blocks or index blocks, the optimizer never pushes aggregates down either
+      ttl_param_ = &table_param.get_ttl_param();
+      iter_param_.disable_blockscan();
+      iter_param_.pd_filter_ = 0;
+      iter_param_.pd_aggregate_ = 0;
+    }
     if (scan_param.need_switch_param_) {
       iter_param_.set_use_iter_pool_flag();
     }
@@ -276,6 +286,10 @@ int ObTableAccessParam::init_dml_access_param(
         break;
       }
     }
+    if (schema_param.get_ttl_param().is_valid()) {
+      // dml reads all columns, rows expired at its snapshot are treated as absent
+      ttl_param_ = &schema_param.get_ttl_param();
+    }
     if (OB_FAIL(iter_param_.check_read_info_valid())) {
       STORAGE_LOG(WARN, "Failed to check read info valdie", K(ret), K(iter_param_));
     } else {
@@ -298,6 +312,7 @@ DEF_TO_STRING(ObTableAccessParam)
       KP_(row2exprs_projector),
       KPC_(output_sel_mask),
       KP_(fast_agg_project),
+      KPC_(ttl_param),
       K_(is_inited));
   J_OBJ_END();
   return pos;
@@ -211,6 +211,8 @@ public:
 
   // for fast agg project
   const common::ObIArray<ObFastAggProjectCell> *fast_agg_project_;
+  // rows expired at the read snapshot are skipped, NULL if the table has no ttl
+  const share::schema::ObTableTTLParam *ttl_param_;
 
   bool is_inited_;
 };
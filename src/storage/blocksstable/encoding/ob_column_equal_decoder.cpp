@@ -52,67 +52,8 @@ int ObColumnEqualDecoder::decode(ObColumnDecoderCtx &ctx, ObObj &cell, const int
 
     if (!has_exc(ctx)) {
       ref = -1;
-    } else {
-      const ObObjType store_type = ctx.col_header_->get_store_obj_type();
-      const ObObjTypeClass tc = ob_obj_type_class(store_type);
-      switch (get_store_class_map()[tc]) {
-        case ObUIntSC:
-        case ObIntSC: {
-          if (OB_FAIL(ObBitMapMetaReader<ObUIntSC>::read(
-              meta_header_->payload_, ctx.micro_block_header_->row_count_,
-              ctx.is_bit_packing(), row_id,
-              ctx.col_header_->length_ - sizeof(ObColumnEqualMetaHeader),
-              ref, cell, store_type))) {
-            LOG_WARN("meta_reader_ read failed", K(ret), K(row_id), K(ctx));
-          }
-          break;
-        }
-        case ObNumberSC: {
-          if (OB_FAIL(ObBitMapMetaReader<ObNumberSC>::read(
-              meta_header_->payload_, ctx.micro_block_header_->row_count_,
-              ctx.is_bit_packing(), row_id,
-              ctx.col_header_->length_ - sizeof(ObColumnEqualMetaHeader),
-              ref, cell, store_type))) {
-            LOG_WARN("meta_reader_ read failed", K(ret), K(row_id), K(ctx));
-          }
-          break;
-        }
-        case ObStringSC:
-        case ObTextSC:
-        case ObJsonSC: {
-          if (OB_FAIL(ObBitMapMetaReader<ObStringSC>::read(
-              meta_header_->payload_, ctx.micro_block_header_->row_count_,
-              ctx.is_bit_packing(), row_id,
-              ctx.col_header_->length_ - sizeof(ObColumnEqualMetaHeader),
-              ref, cell, store_type))) {
-            LOG_WARN("meta_reader_ read failed", K(ret), K(row_id), K(ctx));
-          }
-          break;
-        }
-        case ObOTimestampSC: {
-          if (OB_FAIL(ObBitMapMetaReader<ObOTimestampSC>::read(
-              meta_header_->payload_, ctx.micro_block_header_->row_count_,
-              ctx.is_bit_packing(), row_id,
-              ctx.col_header_->length_ - sizeof(ObColumnEqualMetaHeader),
-              ref, cell, store_type))) {
-            LOG_WARN("meta_reader_ read failed", K(ret), K(row_id), K(ctx));
-          }
-          break;
-        }
-        case ObIntervalSC: {
-          if (OB_FAIL(ObBitMapMetaReader<ObIntervalSC>::read(
-              meta_header_->payload_, ctx.micro_block_header_->row_count_,
-              ctx.is_bit_packing(), row_id,
-              ctx.col_header_->length_ - sizeof(ObColumnEqualMetaHeader),
-              ref, cell, store_type))) {
-            LOG_WARN("meta_reader_ read failed", K(ret), K(row_id), K(ctx));
-          }
-          break;
-        }
-        default:
-          ret = OB_INNER_STAT_ERROR;
-          LOG_WARN("not supported store class", K(ret), K(ctx));
-      }
+    } else if (OB_FAIL(read_exception(ctx, row_id, ref, cell))) {
+      LOG_WARN("read exception failed", K(ret), K(row_id), K(ctx));
     }
 
     // not an exception, get from reffed column
@@ -126,6 +67,156 @@ int ObColumnEqualDecoder::decode(ObColumnDecoderCtx &ctx, ObObj &cell, const int
   return ret;
 }
 
+int ObColumnEqualDecoder::read_exception(const ObColumnDecoderCtx &ctx, const int64_t row_id,
+    int64_t &ref, ObObj &cell) const
+{
+  int ret = OB_SUCCESS;
+  const ObObjType store_type = ctx.col_header_->get_store_obj_type();
+  const ObObjTypeClass tc = ob_obj_type_class(store_type);
+  switch (get_store_class_map()[tc]) {
+    case ObUIntSC:
+    case ObIntSC: {
+      if (OB_FAIL(ObBitMapMetaReader<ObUIntSC>::read(
+          meta_header_->payload_, ctx.micro_block_header_->row_count_,
+          ctx.is_bit_packing(), row_id,
+          ctx.col_header_->length_ - sizeof(ObColumnEqualMetaHeader),
+          ref, cell, store_type))) {
+        LOG_WARN("meta_reader_ read failed", K(ret), K(row_id), K(ctx));
+      }
+      break;
+    }
+    case ObNumberSC: {
+      if (OB_FAIL(ObBitMapMetaReader<ObNumberSC>::read(
+          meta_header_->payload_, ctx.micro_block_header_->row_count_,
+          ctx.is_bit_packing(), row_id,
+          ctx.col_header_->length_ - sizeof(ObColumnEqualMetaHeader),
+          ref, cell, store_type))) {
+        LOG_WARN("meta_reader_ read failed", K(ret), K(row_id), K(ctx));
+      }
+      break;
+    }
+    case ObStringSC:
+    case ObTextSC:
+    case ObJsonSC: {
+      if (OB_FAIL(ObBitMapMetaReader<ObStringSC>::read(
+          meta_header_->payload_, ctx.micro_block_header_->row_count_,
+          ctx.is_bit_packing(), row_id,
+          ctx.col_header_->length_ - sizeof(ObColumnEqualMetaHeader),
+          ref, cell, store_type))) {
+        LOG_WARN("meta_reader_ read failed", K(ret), K(row_id), K(ctx));
+      }
+      break;
+    }
+    case ObOTimestampSC: {
+      if (OB_FAIL(ObBitMapMetaReader<ObOTimestampSC>::read(
+          meta_header_->payload_, ctx.micro_block_header_->row_count_,
+          ctx.is_bit_packing(), row_id,
+          ctx.col_header_->length_ - sizeof(ObColumnEqualMetaHeader),
+          ref, cell, store_type))) {
+        LOG_WARN("meta_reader_ read failed", K(ret), K(row_id), K(ctx));
+      }
+      break;
+    }
+    case ObIntervalSC: {
+      if (OB_FAIL(ObBitMapMetaReader<ObIntervalSC>::read(
+          meta_header_->payload_, ctx.micro_block_header_->row_count_,
+          ctx.is_bit_packing(), row_id,
+          ctx.col_header_->length_ - sizeof(ObColumnEqualMetaHeader),
+          ref, cell, store_type))) {
+        LOG_WARN("meta_reader_ read failed", K(ret), K(row_id), K(ctx));
+      }
+      break;
+    }
+    default:
+      ret = OB_INNER_STAT_ERROR;
+      LOG_WARN("not supported store class", K(ret), K(ctx));
+  }
+  return ret;
+}
+
+/**
+ * Rows equal to the referenced column are filtered by the pushdown operator of the referenced
+ * column decoder on its own encoding, only the exception rows are read and patched here.
+ */
+int ObColumnEqualDecoder::pushdown_operator(
+    const sql::ObPushdownFilterExecutor *parent,
+    const ObColumnDecoderCtx &col_ctx,
+    const sql::ObWhiteFilterExecutor &filter,
+    const char* meta_data,
+    const ObIRowIndex* row_index,
+    ObBitmap &result_bitmap) const
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(!inited_)) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("ColumnEqual decoder not inited", K(ret), K(filter));
+  } else if (OB_ISNULL(col_ctx.ref_decoder_) || OB_ISNULL(col_ctx.ref_ctx_)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("Null reference column decoder", K(ret), K(col_ctx));
+  } else if (OB_UNLIKELY(col_ctx.ref_ctx_->obj_meta_ != col_ctx.obj_meta_)) {
+    ret = OB_NOT_SUPPORTED;
+    LOG_DEBUG("Reference column type differs, not supported", K(ret), K(col_ctx));
+  } else {
+    // values of the referenced column are padded by the accuracy of this column
+    const share::schema::ObColumnParam *ref_col_param = col_ctx.ref_ctx_->col_param_;
+    col_ctx.ref_ctx_->set_col_param(col_ctx.col_param_);
+    if (OB_FAIL(col_ctx.ref_decoder_->pushdown_operator(
+        parent, *col_ctx.ref_ctx_, filter, meta_data, row_index, result_bitmap))) {
+      if (OB_NOT_SUPPORTED != ret) {
+        LOG_WARN("Failed to pushdown operator to reference column", K(ret), K(col_ctx));
+      }
+    } else if (has_exc(col_ctx)
+        && OB_FAIL(exception_operator(parent, col_ctx, filter, result_bitmap))) {
+      LOG_WARN("Failed to filter exception rows", K(ret), K(col_ctx));
+    }
+    col_ctx.ref_ctx_->set_col_param(ref_col_param);
+  }
+  return ret;
+}
+
+int ObColumnEqualDecoder::exception_operator(
+    const sql::ObPushdownFilterExecutor *parent,
+    const ObColumnDecoderCtx &col_ctx,
+    const sql::ObWhiteFilterExecutor &filter,
+    ObBitmap &result_bitmap) const
+{
+  int ret = OB_SUCCESS;
+  const sql::ObWhiteFilterOperatorType op_type = filter.get_op_type();
+  const uint64_t *exc_bits = reinterpret_cast<const uint64_t *>(
+      meta_header_->payload_ + sizeof(ObBitMapMetaHeader));
+  ObObj cur_obj;
+  int64_t ref = -1;
+  for (int64_t row_id = 0;
+       OB_SUCC(ret) && row_id < col_ctx.micro_block_header_->row_count_;
+       ++row_id) {
+    bool result = false;
+    if (nullptr != parent && parent->can_skip_filter(row_id)) {
+      continue;
+    } else if (!BitSet::get(exc_bits, row_id)) {
+      continue;
+    } else if (FALSE_IT(cur_obj.copy_meta_type(col_ctx.obj_meta_))) {
+    } else if (OB_FAIL(read_exception(col_ctx, row_id, ref, cur_obj))) {
+      LOG_WARN("Failed to read exception", K(ret), K(row_id));
+    } else if (cur_obj.is_null()) {
+      result = sql::WHITE_OP_NU == op_type;
+    } else if (cur_obj.is_ext() || sql::WHITE_OP_NU == op_type) {
+      result = false;
+    } else if (sql::WHITE_OP_NN == op_type) {
+      result = true;
+    } else if (cur_obj.is_fixed_len_char_type() && nullptr != col_ctx.col_param_
+        && OB_FAIL(storage::pad_column(col_ctx.col_param_->get_accuracy(),
+                                       *col_ctx.allocator_, cur_obj))) {
+      LOG_WARN("Failed to pad column", K(ret), K(row_id));
+    } else if (OB_FAIL(evaluate_white_filter(cur_obj, filter, result))) {
+      LOG_WARN("Failed on trying to filter the row", K(ret), K(row_id), K(cur_obj));
+    }
+    if (OB_SUCC(ret) && OB_FAIL(result_bitmap.set(row_id, result))) {
+      LOG_WARN("Failed to set result bitmap", K(ret), K(row_id), K(result));
+    }
+  }
+  return ret;
+}
+
 int ObColumnEqualDecoder::update_pointer(const char *old_block, const char *cur_block)
 {
   int ret = OB_SUCCESS;
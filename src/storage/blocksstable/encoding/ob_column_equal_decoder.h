@@ -51,10 +51,27 @@ public:
 
   virtual bool can_vectorized() const override { return false; }
 
+  virtual int pushdown_operator(
+      const sql::ObPushdownFilterExecutor *parent,
+      const ObColumnDecoderCtx &col_ctx,
+      const sql::ObWhiteFilterExecutor &filter,
+      const char* meta_data,
+      const ObIRowIndex* row_index,
+      ObBitmap &result_bitmap) const override;
+
 protected:
   inline bool has_exc(const ObColumnDecoderCtx &ctx) const
   { return ctx.col_header_->length_ > sizeof(ObColumnEqualMetaHeader); }
 private:
+  int read_exception(const ObColumnDecoderCtx &ctx, const int64_t row_id,
+      int64_t &ref, common::ObObj &cell) const;
+
+  int exception_operator(
+      const sql::ObPushdownFilterExecutor *parent,
+      const ObColumnDecoderCtx &col_ctx,
+      const sql::ObWhiteFilterExecutor &filter,
+      ObBitmap &result_bitmap) const;
+
   bool inited_;
   const ObColumnEqualMetaHeader *meta_header_;
 };
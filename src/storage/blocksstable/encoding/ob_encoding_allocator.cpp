@@ -29,6 +29,9 @@ int64_t size_array [] = {                \
   sizeof(ObStringPrefix##Item),          \
   sizeof(ObColumnEqual##Item),           \
   sizeof(ObInterColSubStr##Item),        \
+  sizeof(ObIntegerStrideDiff##Item),     \
+  sizeof(ObFloatDecimal##Item),          \
+  sizeof(ObStringSymbol##Item),          \
 }                                        \
 
 DEF_SIZE_ARRAY(Encoder, encoder_sizes);
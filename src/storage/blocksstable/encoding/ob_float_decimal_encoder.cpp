@@ -0,0 +1,215 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX STORAGE
+
+#include "ob_float_decimal_encoder.h"
+
+#include <cmath>
+#include "storage/blocksstable/ob_data_buffer.h"
+#include "ob_bit_stream.h"
+
+namespace oceanbase
+{
+namespace blocksstable
+{
+
+using namespace common;
+
+const ObColumnHeader::Type ObFloatDecimalEncoder::type_;
+
+ObFloatDecimalEncoder::ObFloatDecimalEncoder()
+  : is_float_(false), exponent_(0), base_(0), header_(NULL)
+{
+}
+
+int ObFloatDecimalEncoder::init(
+    const ObColumnEncodingCtx &ctx,
+    const int64_t column_index,
+    const ObConstDatumRowArray &rows)
+{
+  int ret = OB_SUCCESS;
+  if (IS_INIT) {
+    ret = OB_INIT_TWICE;
+    LOG_WARN("init twice", K(ret));
+  } else if (OB_FAIL(ObIColumnEncoder::init(ctx, column_index, rows))) {
+    LOG_WARN("init base column encoder failed",
+        K(ret), K(ctx), K(column_index), "row count", rows.count());
+  } else {
+    const ObObjTypeClass tc = ob_obj_type_class(column_type_.get_type());
+    if (ObFloatTC != tc && ObDoubleTC != tc) {
+      ret = OB_NOT_SUPPORTED;
+      LOG_WARN("not supported type for float decimal", K(ret), K(tc), K_(column_index));
+    } else {
+      is_float_ = ObFloatTC == tc;
+      column_header_.type_ = type_;
+    }
+  }
+  return ret;
+}
+
+void ObFloatDecimalEncoder::reuse()
+{
+  ObIColumnEncoder::reuse();
+  is_float_ = false;
+  exponent_ = 0;
+  base_ = 0;
+  header_ = NULL;
+  is_inited_ = false;
+}
+
+bool ObFloatDecimalEncoder::scale(
+    const ObDatum &datum, const int64_t exponent, int64_t &digits) const
+{
+  // keep scaled value inside the range where every integer is exact in double
+  static const double MAX_EXACT_INTEGER = static_cast<double>(1LL << 53);
+  bool exact = false;
+  const double v = is_float_ ? datum.get_float() : datum.get_double();
+  const double scaled = v * ObFloatDecimalHeader::pow10(exponent);
+  if (std::isfinite(scaled) && std::fabs(scaled) < MAX_EXACT_INTEGER) {
+    digits = std::llround(scaled);
+    const double decoded = ObFloatDecimalHeader::descale(digits, exponent);
+    if (is_float_) {
+      const float f = static_cast<float>(decoded);
+      exact = 0 == MEMCMP(&f, datum.ptr_, sizeof(f));
+    } else {
+      exact = 0 == MEMCMP(&decoded, datum.ptr_, sizeof(decoded));
+    }
+  }
+  return exact;
+}
+
+int ObFloatDecimalEncoder::traverse(bool &suitable)
+{
+  int ret = OB_SUCCESS;
+  suitable = false;
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("not init", K(ret));
+  } else {
+    const ObColDatums &datums = *ctx_->col_datums_;
+    int64_t digits = 0;
+    int64_t min = INT64_MAX;
+    int64_t max = INT64_MIN;
+    bool exact = true;
+    exponent_ = 0;
+    // grow exponent until current value round trips, then check all values once more
+    for (int64_t i = 0; exact && i < datums.count(); ++i) {
+      const ObDatum &datum = datums.at(i);
+      if (!datum.is_null() && !datum.is_nop()) {
+        while (!(exact = scale(datum, exponent_, digits))
+            && exponent_ < ObFloatDecimalHeader::MAX_EXPONENT) {
+          ++exponent_;
+        }
+      }
+    }
+    for (int64_t i = 0; exact && i < datums.count(); ++i) {
+      const ObDatum &datum = datums.at(i);
+      if (!datum.is_null() && !datum.is_nop()) {
+        if ((exact = scale(datum, exponent_, digits))) {
+          min = digits < min ? digits : min;
+          max = digits > max ? digits : max;
+        }
+      }
+    }
+
+    if (exact && min <= max) {
+      base_ = min;
+      const uint64_t delta = static_cast<uint64_t>(max) - static_cast<uint64_t>(min);
+      const int64_t orig_size = get_type_size_map()[column_type_.get_type()] * CHAR_BIT;
+      bool bit_packing = false;
+      int64_t delta_size = get_packing_size(bit_packing, delta);
+      if (!bit_packing) {
+        delta_size *= CHAR_BIT;
+      }
+      LOG_DEBUG("float decimal size", K_(column_index), K_(exponent), K(delta_size), K(orig_size));
+      if ((orig_size - delta_size) * rows_->count() > sizeof(ObFloatDecimalHeader) * CHAR_BIT) {
+        suitable = true;
+        if (bit_packing) {
+          desc_.bit_packing_length_ = delta_size;
+        } else {
+          desc_.fix_data_length_ = delta_size / CHAR_BIT;
+        }
+        desc_.need_data_store_ = true;
+        desc_.has_null_ = ctx_->null_cnt_ > 0;
+        desc_.has_nope_ = ctx_->nope_cnt_ > 0;
+        desc_.need_extend_value_bit_store_ = desc_.has_null_ || desc_.has_nope_;
+        if (desc_.need_extend_value_bit_store_) {
+          column_header_.set_has_extend_value_attr();
+        }
+        if (desc_.bit_packing_length_ > 0) {
+          column_header_.set_bit_packing_attr();
+        }
+        column_header_.set_fix_lenght_attr();
+      }
+    }
+  }
+  return ret;
+}
+
+int ObFloatDecimalEncoder::store_meta(ObBufferWriter &buf_writer)
+{
+  int ret = OB_SUCCESS;
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("not init", K(ret));
+  } else {
+    header_ = reinterpret_cast<ObFloatDecimalHeader *>(buf_writer.current());
+    if (OB_FAIL(buf_writer.advance_zero(sizeof(*header_)))) {
+      LOG_WARN("advance meta store size failed", K(ret));
+    } else {
+      header_->version_ = ObFloatDecimalHeader::OB_FLOAT_DECIMAL_HEADER_V1;
+      header_->exponent_ = static_cast<uint8_t>(exponent_);
+      header_->base_ = base_;
+      LOG_DEBUG("float decimal meta", K(*header_));
+    }
+  }
+  return ret;
+}
+
+int64_t ObFloatDecimalEncoder::calc_size() const
+{
+  int64_t size = INT64_MAX;
+  if (is_inited_) {
+    if (desc_.bit_packing_length_ > 0) {
+      size = (rows_->count() * desc_.bit_packing_length_ + CHAR_BIT - 1) / CHAR_BIT;
+    } else {
+      size = rows_->count() * desc_.fix_data_length_;
+    }
+  }
+  return size + sizeof(ObFloatDecimalHeader);
+}
+
+int ObFloatDecimalEncoder::store_fix_data(ObBufferWriter &buf_writer)
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(!is_inited_)) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("not init", K(ret));
+  } else if (OB_UNLIKELY(!is_valid_fix_encoder())) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid argument", K(ret), K_(desc));
+  } else {
+    DeltaGetter getter(*this);
+    FixDataSetter setter(*this);
+    header_->length_ = static_cast<uint8_t>(desc_.bit_packing_length_ > 0
+        ? desc_.bit_packing_length_
+        : desc_.fix_data_length_);
+    if (OB_FAIL(fill_column_store(buf_writer, *ctx_->col_datums_, getter, setter))) {
+      LOG_WARN("fill column store failed", K(ret));
+    }
+  }
+  return ret;
+}
+
+} // end namespace blocksstable
+} // end namespace oceanbase
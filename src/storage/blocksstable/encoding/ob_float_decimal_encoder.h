@@ -0,0 +1,142 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#ifndef OCEANBASE_ENCODING_OB_FLOAT_DECIMAL_ENCODER_H_
+#define OCEANBASE_ENCODING_OB_FLOAT_DECIMAL_ENCODER_H_
+
+#include "ob_icolumn_encoder.h"
+#include "ob_encoding_util.h"
+#include "ob_bit_stream.h"
+
+namespace oceanbase
+{
+namespace blocksstable
+{
+
+// Float decimal encoding, for float / double columns holding decimal like values such as
+// prices or sensor readings (12.34, 0.5, 100.25 ...):
+//   value(row_id) = (base_ + delta(row_id)) / 10^exponent_
+// A column is suitable only if every value round trips bit exactly under one exponent,
+// so -0.0, NaN and infinity always fall back to other encodings.
+struct ObFloatDecimalHeader
+{
+  static constexpr uint8_t OB_FLOAT_DECIMAL_HEADER_V1 = 0;
+  static constexpr int64_t MAX_EXPONENT = 18;
+  uint8_t version_;
+  uint8_t length_;
+  uint8_t exponent_;
+  int64_t base_;
+
+  ObFloatDecimalHeader()
+    : version_(OB_FLOAT_DECIMAL_HEADER_V1), length_(0), exponent_(0), base_(0)
+  {
+  }
+
+  static OB_INLINE double pow10(const int64_t exponent)
+  {
+    // all exactly representable in double
+    static const double POW10[MAX_EXPONENT + 1] = {
+      1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9,
+      1e10, 1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18
+    };
+    return POW10[exponent];
+  }
+
+  // encoder verifies round trip with exactly the same expression as decoder
+  static OB_INLINE double descale(const int64_t digits, const int64_t exponent)
+  {
+    return static_cast<double>(digits) / pow10(exponent);
+  }
+
+  TO_STRING_KV(K_(length), K_(exponent), K_(base));
+} __attribute__((packed));
+
+class ObFloatDecimalEncoder : public ObIColumnEncoder
+{
+public:
+  static const ObColumnHeader::Type type_ = ObColumnHeader::FLOAT_DECIMAL;
+
+  ObFloatDecimalEncoder();
+  virtual ~ObFloatDecimalEncoder() {}
+
+  virtual int init(
+      const ObColumnEncodingCtx &ctx,
+      const int64_t column_index,
+      const ObConstDatumRowArray &rows) override;
+
+  virtual void reuse() override;
+  virtual int store_meta(ObBufferWriter &buf_writer) override;
+  virtual int store_data(
+      const int64_t row_id, ObBitStream &bs, char *buf, const int64_t len) override
+  {
+    UNUSEDx(row_id, bs, buf, len);
+    return common::OB_NOT_SUPPORTED;
+  }
+
+  virtual int traverse(bool &suitable) override;
+  virtual int64_t calc_size() const override;
+  virtual ObColumnHeader::Type get_type() const { return type_; }
+  virtual int store_fix_data(ObBufferWriter &buf_writer) override;
+
+public:
+  struct DeltaGetter
+  {
+    explicit DeltaGetter(const ObFloatDecimalEncoder &encoder) : encoder_(encoder) {}
+    inline int operator()(const int64_t, const common::ObDatum &datum, uint64_t &v)
+    {
+      v = encoder_.delta(datum);
+      return common::OB_SUCCESS;
+    }
+
+    const ObFloatDecimalEncoder &encoder_;
+  };
+
+  struct FixDataSetter
+  {
+    explicit FixDataSetter(const ObFloatDecimalEncoder &encoder) : encoder_(encoder) {}
+    inline int operator()(
+        const int64_t,
+        const common::ObDatum &datum,
+        char *buf,
+        const int64_t len) const
+    {
+      // performance critical, do not check parameters
+      uint64_t v = encoder_.delta(datum);
+      MEMCPY(buf, &v, len);
+      return common::OB_SUCCESS;
+    }
+
+    const ObFloatDecimalEncoder &encoder_;
+  };
+
+private:
+  bool scale(const common::ObDatum &datum, const int64_t exponent, int64_t &digits) const;
+  OB_INLINE uint64_t delta(const common::ObDatum &datum) const
+  {
+    int64_t digits = 0;
+    // always succeed after traverse
+    scale(datum, exponent_, digits);
+    return static_cast<uint64_t>(digits) - static_cast<uint64_t>(base_);
+  }
+
+private:
+  bool is_float_;
+  int64_t exponent_;
+  int64_t base_;
+  // is null before write meta
+  ObFloatDecimalHeader *header_;
+};
+
+} // end namespace blocksstable
+} // end namespace oceanbase
+
+#endif // OCEANBASE_ENCODING_OB_FLOAT_DECIMAL_ENCODER_H_
@@ -265,5 +265,45 @@ int ObIColumnDecoder::get_null_count_from_extend_value(
   return ret;
 }
 
+int ObIColumnDecoder::evaluate_white_filter(
+    const ObObj &cur_obj,
+    const sql::ObWhiteFilterExecutor &filter,
+    bool &result)
+{
+  int ret = OB_SUCCESS;
+  const sql::ObWhiteFilterOperatorType op_type = filter.get_op_type();
+  result = false;
+  switch (op_type) {
+  case sql::WHITE_OP_EQ:
+  case sql::WHITE_OP_NE:
+  case sql::WHITE_OP_GT:
+  case sql::WHITE_OP_GE:
+  case sql::WHITE_OP_LT:
+  case sql::WHITE_OP_LE: {
+    result = ObObjCmpFuncs::compare_oper_nullsafe(
+        cur_obj,
+        filter.get_objs().at(0),
+        cur_obj.get_collation_type(),
+        sql::ObPushdownWhiteFilterNode::WHITE_OP_TO_CMP_OP[op_type]);
+    break;
+  }
+  case sql::WHITE_OP_BT: {
+    result = (cur_obj >= filter.get_objs().at(0)) && (cur_obj <= filter.get_objs().at(1));
+    break;
+  }
+  case sql::WHITE_OP_IN: {
+    if (OB_FAIL(filter.exist_in_obj_set(cur_obj, result))) {
+      LOG_WARN("Failed to check object in hashset", K(ret), K(cur_obj));
+    }
+    break;
+  }
+  default: {
+    ret = OB_NOT_SUPPORTED;
+    LOG_WARN("Not supported operation type", K(ret), K(op_type));
+  }
+  }
+  return ret;
+}
+
 } // end of namespace oceanbase
 } // end of namespace oceanbase
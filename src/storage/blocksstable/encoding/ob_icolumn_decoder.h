@@ -199,6 +199,13 @@ public:
       int64_t &null_count) const;
 
 protected:
+  // Evaluate a pushed down comparison, BETWEEN or IN operator on one non-null cell,
+  // shared by decoders that walk the encoded rows themselves in pushdown_operator.
+  static int evaluate_white_filter(
+      const common::ObObj &cur_obj,
+      const sql::ObWhiteFilterExecutor &filter,
+      bool &result);
+
   int get_null_count_from_extend_value(
     const ObColumnDecoderCtx &ctx,
     const ObIRowIndex *row_index,
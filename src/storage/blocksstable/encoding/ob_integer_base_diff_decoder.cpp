@@ -12,11 +12,16 @@
 
 #define USING_LOG_PREFIX STORAGE
 
+#if defined ( __x86_64__ )
+#include <immintrin.h>
+#endif
+
 #include "ob_integer_base_diff_decoder.h"
 
 #include "storage/blocksstable/ob_block_sstable_struct.h"
 #include "ob_bit_stream.h"
 #include "ob_integer_array.h"
+#include "ob_raw_decoder.h"
 
 namespace oceanbase
 {
@@ -24,6 +29,160 @@ namespace blocksstable
 {
 using namespace common;
 const ObColumnHeader::Type ObIntegerBaseDiffDecoder::type_;
+const int64_t ObIntegerBaseDiffDecoder::UNPACK_BATCH_SIZE;
+
+#if defined ( __x86_64__ )
+// Functions of this TU are not compiled with AVX flags, enable AVX2 for these kernels only,
+// make sure no AVX-512 instruction generated for CPU with AVX2 only.
+#define BIT_PACKED_AVX2_FUNC __attribute__((target("avx2")))
+
+struct BitUnpackAVX2Func
+{
+  BIT_PACKED_AVX2_FUNC static void bit_unpack_func(
+      const unsigned char *buf,
+      const int64_t offset,
+      const int64_t width,
+      const int64_t cnt,
+      const int64_t bs_len,
+      const uint64_t base,
+      uint64_t *values)
+  {
+    const uint64_t mask = ObBitStream::get_mask(width);
+    const int64_t word_cnt = get_word_unpack_cnt(offset, width, cnt, bs_len);
+    const __m256i mask_vec = _mm256_set1_epi64x(mask);
+    const __m256i base_vec = _mm256_set1_epi64x(base);
+    const __m256i bit_off_mask = _mm256_set1_epi64x(CHAR_BIT - 1);
+    const __m256i step = _mm256_set1_epi64x(4 * width);
+    __m256i pos = _mm256_setr_epi64x(offset, offset + width, offset + 2 * width, offset + 3 * width);
+    int64_t i = 0;
+    for (; i + 4 <= word_cnt; i += 4) {
+      const __m256i words = _mm256_i64gather_epi64(
+          reinterpret_cast<const long long *>(buf), _mm256_srli_epi64(pos, 3), 1);
+      __m256i v = _mm256_srlv_epi64(words, _mm256_and_si256(pos, bit_off_mask));
+      v = _mm256_add_epi64(_mm256_and_si256(v, mask_vec), base_vec);
+      _mm256_storeu_si256(reinterpret_cast<__m256i *>(values + i), v);
+      pos = _mm256_add_epi64(pos, step);
+    }
+    for (int64_t bit_pos = offset + i * width; i < cnt; ++i, bit_pos += width) {
+      values[i] = get_bit_packed_value(buf, bit_pos, width, mask, i < word_cnt) + base;
+    }
+  }
+};
+
+template <int32_t CMP_TYPE>
+struct BitPackedFilterAVX2Func_T
+{
+  // AVX2 has no unsigned 64 bit compare, flip the sign bit and compare as signed
+  BIT_PACKED_AVX2_FUNC static uint8_t cmp_mask(const __m256i value, const __m256i literal)
+  {
+    __m256i res;
+    switch (CMP_TYPE) {
+      case sql::WHITE_OP_EQ:
+      case sql::WHITE_OP_NE:
+        res = _mm256_cmpeq_epi64(value, literal);
+        break;
+      case sql::WHITE_OP_GT:
+      case sql::WHITE_OP_LE:
+        res = _mm256_cmpgt_epi64(value, literal);
+        break;
+      default:
+        // LT, GE
+        res = _mm256_cmpgt_epi64(literal, value);
+        break;
+    }
+    uint8_t mask = static_cast<uint8_t>(_mm256_movemask_pd(_mm256_castsi256_pd(res)));
+    if (sql::WHITE_OP_NE == CMP_TYPE || sql::WHITE_OP_LE == CMP_TYPE || sql::WHITE_OP_GE == CMP_TYPE) {
+      mask = ~mask & 0xF;
+    }
+    return mask;
+  }
+
+  BIT_PACKED_AVX2_FUNC static void bit_packed_filter_func(
+      const unsigned char *buf,
+      const int64_t offset,
+      const int64_t width,
+      const int64_t cnt,
+      const int64_t bs_len,
+      const uint64_t literal,
+      sql::ObBitVector &res)
+  {
+    const uint64_t mask = ObBitStream::get_mask(width);
+    const int64_t word_cnt = get_word_unpack_cnt(offset, width, cnt, bs_len);
+    const __m256i sign_bit = _mm256_set1_epi64x(INT64_MIN);
+    const __m256i mask_vec = _mm256_set1_epi64x(mask);
+    const __m256i literal_vec = _mm256_xor_si256(_mm256_set1_epi64x(literal), sign_bit);
+    const __m256i bit_off_mask = _mm256_set1_epi64x(CHAR_BIT - 1);
+    const __m256i step = _mm256_set1_epi64x(4 * width);
+    __m256i pos = _mm256_setr_epi64x(offset, offset + width, offset + 2 * width, offset + 3 * width);
+    uint8_t *res_data = res.reinterpret_data<uint8_t>();
+    int64_t row_id = 0;
+    for (; row_id + 4 <= word_cnt; row_id += 4) {
+      const __m256i words = _mm256_i64gather_epi64(
+          reinterpret_cast<const long long *>(buf), _mm256_srli_epi64(pos, 3), 1);
+      __m256i v = _mm256_srlv_epi64(words, _mm256_and_si256(pos, bit_off_mask));
+      v = _mm256_xor_si256(_mm256_and_si256(v, mask_vec), sign_bit);
+      res_data[row_id / CHAR_BIT] |= static_cast<uint8_t>(
+          cmp_mask(v, literal_vec) << (row_id % CHAR_BIT));
+      pos = _mm256_add_epi64(pos, step);
+    }
+    for (int64_t bit_pos = offset + row_id * width; row_id < cnt; ++row_id, bit_pos += width) {
+      const uint64_t value = get_bit_packed_value(buf, bit_pos, width, mask, row_id < word_cnt);
+      if (value_cmp_t<uint64_t, CMP_TYPE>(value, literal)) {
+        res.set(row_id);
+      }
+    }
+  }
+};
+#undef BIT_PACKED_AVX2_FUNC
+#endif
+
+bit_unpack_func bit_packed_unpack_func = nullptr;
+ObMultiDimArray_T<bit_packed_filter_func, 6> bit_packed_filter_funcs;
+
+bool init_bit_packed_avx512_funcs();
+
+template <int32_t CMP_TYPE>
+struct BitPackedFilterArrayInit
+{
+  bool operator()()
+  {
+    bit_packed_filter_funcs[CMP_TYPE]
+        = &(BitPackedFilterFunc_T<CMP_TYPE>::bit_packed_filter_func);
+    return true;
+  }
+};
+
+#if defined ( __x86_64__ )
+template <int32_t CMP_TYPE>
+struct BitPackedFilterAVX2ArrayInit
+{
+  bool operator()()
+  {
+    bit_packed_filter_funcs[CMP_TYPE]
+        = &(BitPackedFilterAVX2Func_T<CMP_TYPE>::bit_packed_filter_func);
+    return true;
+  }
+};
+#endif
+
+bool init_bit_packed_funcs()
+{
+  bool res = false;
+  bit_packed_unpack_func = &BitUnpackFunc::bit_unpack_func;
+  res = ObNDArrayIniter<BitPackedFilterArrayInit, 6>::apply();
+  // Dispatch simd version unpack and filter funcs
+#if defined ( __x86_64__ )
+  if (is_avx512_valid()) {
+    res = init_bit_packed_avx512_funcs();
+  } else if (is_avx2_valid()) {
+    bit_packed_unpack_func = &BitUnpackAVX2Func::bit_unpack_func;
+    res = ObNDArrayIniter<BitPackedFilterAVX2ArrayInit, 6>::apply();
+  }
+#endif
+  return res;
+}
+
+bool bit_packed_funcs_inited = init_bit_packed_funcs();
 
 int ObIntegerBaseDiffDecoder::decode(ObColumnDecoderCtx &ctx, common::ObObj &cell, const int64_t row_id,
     const ObBitStream &bs, const char *data, const int64_t len) const
@@ -154,8 +313,37 @@ int ObIntegerBaseDiffDecoder::batch_get_bitpacked_values(
 
 #undef INT_DIFF_UNPACK_REFS
 
+void ObIntegerBaseDiffDecoder::batch_unpack_continuous_values(
+    const ObColumnDecoderCtx &ctx,
+    const int64_t start_row_id,
+    const int64_t row_cap,
+    const int64_t datum_len,
+    const int64_t data_offset,
+    common::ObDatum *datums) const
+{
+  const int64_t packed_len = header_->length_;
+  const int64_t bs_len = data_offset + packed_len * ctx.micro_block_header_->row_count_;
+  const bool has_ext_val = ctx.has_extend_value();
+  const unsigned char *col_data = reinterpret_cast<const unsigned char *>(header_)
+                                  + ctx.col_header_->length_;
+  uint64_t values[UNPACK_BATCH_SIZE];
+  for (int64_t i = 0; i < row_cap; i += UNPACK_BATCH_SIZE) {
+    const int64_t cnt = std::min(UNPACK_BATCH_SIZE, row_cap - i);
+    bit_packed_unpack_func(col_data, data_offset + (start_row_id + i) * packed_len,
+        packed_len, cnt, bs_len, base_, values);
+    for (int64_t j = 0; j < cnt; ++j) {
+      ObDatum &datum = datums[i + j];
+      if (has_ext_val && datum.is_null()) {
+        // Skip
+      } else {
+        MEMCPY(const_cast<char *>(datum.ptr_), &values[j], datum_len);
+        datum.pack_ = datum_len;
+      }
+    }
+  }
+}
+
 // Internal call, not check parameters for performance
-// Potential optimization: SIMD batch add @base_ to packed delta values
 int ObIntegerBaseDiffDecoder::batch_decode(
     const ObColumnDecoderCtx &ctx,
     const ObIRowIndex* row_index,
@@ -189,7 +377,10 @@ int ObIntegerBaseDiffDecoder::batch_decode(
         datum_len))) {
       LOG_WARN("Failed to get datum length of int/uint data", K(ret));
     } else if (ctx.is_bit_packing()) {
-      if (OB_FAIL(batch_get_bitpacked_values(
+      if (row_cap > 0 && row_ids[row_cap - 1] - row_ids[0] == row_cap - 1) {
+        // Continuous ascending rows, unpack with dispatched simd kernel
+        batch_unpack_continuous_values(ctx, row_ids[0], row_cap, datum_len, data_offset, datums);
+      } else if (OB_FAIL(batch_get_bitpacked_values(
           ctx, row_ids, row_cap, datum_len, data_offset, datums))) {
         LOG_WARN("Failed to batch unpack delta values", K(ret), K(ctx));
       }
@@ -326,6 +517,57 @@ inline int ObIntegerBaseDiffDecoder::get_delta<int64_t>(
   return ret;
 }
 
+bool ObIntegerBaseDiffDecoder::fixed_fast_filter_valid(
+    const int64_t cell_len,
+    const uint64_t param_delta_value) const
+{
+  // delta in filter should be representable by stored cell, otherwise truncated on compare
+  return raw_fix_fast_filter_funcs_inited
+      && (1 == cell_len || 2 == cell_len || 4 == cell_len || 8 == cell_len)
+      && param_delta_value <= ObBitStream::get_mask(cell_len * CHAR_BIT);
+}
+
+// Compare all rows with dispatched simd kernel, cheaper than skipping rows by parent filter
+int ObIntegerBaseDiffDecoder::fast_comparison_operator(
+    const ObColumnDecoderCtx &col_ctx,
+    const unsigned char* col_data,
+    const int64_t data_offset,
+    const uint64_t param_delta_value,
+    const bool null_value_contained,
+    const sql::ObWhiteFilterExecutor &filter,
+    ObBitmap &result_bitmap) const
+{
+  int ret = OB_SUCCESS;
+  const int64_t row_cnt = col_ctx.micro_block_header_->row_count_;
+  const int64_t cell_len = header_->length_;
+  const sql::ObWhiteFilterOperatorType op_type = filter.get_op_type();
+  const int64_t size = sql::ObBitVector::memory_size(row_cnt);
+  // Use BitVector to set the result of filter here because the memory of ObBitMap is not continuous
+  char buf[size];
+  sql::ObBitVector *bit_vec = sql::to_bit_vector(buf);
+  bit_vec->reset(row_cnt);
+
+  if (col_ctx.is_bit_packing()) {
+    bit_packed_filter_funcs[op_type](col_data, data_offset, cell_len, row_cnt,
+        data_offset + cell_len * row_cnt, param_delta_value, *bit_vec);
+  } else {
+    const int64_t byte_offset = (data_offset + CHAR_BIT - 1) / CHAR_BIT;
+    raw_fix_fast_filter_funcs[0][get_value_len_tag_map()[cell_len]][op_type](
+        row_cnt, col_data + byte_offset, param_delta_value, *bit_vec);
+  }
+  if (null_value_contained) {
+    for (int64_t row_id = 0; row_id < row_cnt; ++row_id) {
+      if (result_bitmap.test(row_id)) {
+        bit_vec->unset(row_id);
+      }
+    }
+  }
+  if (OB_FAIL(result_bitmap.load_blocks_from_array(reinterpret_cast<uint64_t *>(buf), row_cnt))) {
+    LOG_WARN("Failed to load bitmap from array on stack", K(ret), KP(buf), K(row_cnt));
+  }
+  return ret;
+}
+
 int ObIntegerBaseDiffDecoder::comparison_operator(
     const sql::ObPushdownFilterExecutor *parent,
     const ObColumnDecoderCtx &col_ctx,
@@ -396,25 +638,14 @@ int ObIntegerBaseDiffDecoder::comparison_operator(
 
       if (OB_FAIL(ret)) {
       } else if (col_ctx.is_bit_packing()) {
-        for (int64_t row_id = 0;
-            OB_SUCC(ret) && row_id < col_ctx.micro_block_header_->row_count_;
-            ++row_id) {
-          if (exist_parent_filter && parent->can_skip_filter(row_id)) {
-          } else if (null_value_contained && result_bitmap.test(row_id)) {
-            if (OB_FAIL(result_bitmap.set(row_id, false))) {
-              LOG_WARN("Failed to set row with null object to false", K(ret));
-            }
-          } else if (OB_FAIL(ObBitStream::get(
-                col_data, data_offset + row_id * cell_len, cell_len, delta_value))) {
-              LOG_WARN("Failed to get bit packing value", K(ret), K_(header));
-          } else {
-            bool cmp_result = fp_int_cmp<uint64_t>(delta_value, param_delta_value, cmp_op_type);
-            if (cmp_result) {
-              if (OB_FAIL(result_bitmap.set(row_id))) {
-                LOG_WARN("Failed to set result bitmap", K(ret), K(row_id), K(filter));
-              }
-            }
-          }
+        if (OB_FAIL(fast_comparison_operator(col_ctx, col_data, data_offset, param_delta_value,
+            null_value_contained, filter, result_bitmap))) {
+          LOG_WARN("Failed to compare bit packed values", K(ret), K(col_ctx));
+        }
+      } else if (fixed_fast_filter_valid(cell_len, param_delta_value)) {
+        if (OB_FAIL(fast_comparison_operator(col_ctx, col_data, data_offset, param_delta_value,
+            null_value_contained, filter, result_bitmap))) {
+          LOG_WARN("Failed to compare fixed length values", K(ret), K(col_ctx));
         }
       } else {
         data_offset = (data_offset + CHAR_BIT - 1) / CHAR_BIT;
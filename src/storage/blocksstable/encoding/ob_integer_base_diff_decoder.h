@@ -16,6 +16,7 @@
 
 #include "ob_icolumn_decoder.h"
 #include "ob_encoding_util.h"
+#include "ob_encoding_query_util.h"
 #include "ob_integer_base_diff_encoder.h"
 #include "ob_bit_stream.h"
 
@@ -81,6 +82,14 @@ private:
       const int64_t data_offset,
       common::ObDatum *datums) const;
 
+  void batch_unpack_continuous_values(
+      const ObColumnDecoderCtx &ctx,
+      const int64_t start_row_id,
+      const int64_t row_cap,
+      const int64_t datum_len,
+      const int64_t data_offset,
+      common::ObDatum *datums) const;
+
   template <typename T>
   inline int get_delta(const common::ObObj &cell, uint64_t &delta) const
   {
@@ -97,6 +106,17 @@ private:
       const sql::ObWhiteFilterExecutor &filter,
       ObBitmap &result_bitmap) const;
 
+  bool fixed_fast_filter_valid(const int64_t cell_len, const uint64_t param_delta_value) const;
+
+  int fast_comparison_operator(
+      const ObColumnDecoderCtx &col_ctx,
+      const unsigned char* col_data,
+      const int64_t data_offset,
+      const uint64_t param_delta_value,
+      const bool null_value_contained,
+      const sql::ObWhiteFilterExecutor &filter,
+      ObBitmap &result_bitmap) const;
+
   int bt_operator(
       const sql::ObPushdownFilterExecutor *parent,
       const ObColumnDecoderCtx &col_ctx,
@@ -122,10 +142,115 @@ private:
           const sql::ObWhiteFilterExecutor &filter,
           bool &result)) const;
 private:
+  static const int64_t UNPACK_BATCH_SIZE = 256;
   const ObIntegerBaseDiffHeader *header_;
   uint64_t base_;
 };
 
+// Unpack @cnt bit packed values of @width bits started from bit @offset of @buf, and add @base
+// to every value. @bs_len is the valid bit length of @buf, never read over it.
+typedef void (*bit_unpack_func)(
+    const unsigned char *buf,
+    const int64_t offset,
+    const int64_t width,
+    const int64_t cnt,
+    const int64_t bs_len,
+    const uint64_t base,
+    uint64_t *values);
+
+// Compare @cnt bit packed values with @literal as unsigned integer, set matched rows in @res.
+typedef void (*bit_packed_filter_func)(
+    const unsigned char *buf,
+    const int64_t offset,
+    const int64_t width,
+    const int64_t cnt,
+    const int64_t bs_len,
+    const uint64_t literal,
+    sql::ObBitVector &res);
+
+// Count of leading values which can be fetched by one unaligned 8 bytes load
+// without reading over @bs_len bits of buffer.
+OB_INLINE int64_t get_word_unpack_cnt(
+    const int64_t offset,
+    const int64_t width,
+    const int64_t cnt,
+    const int64_t bs_len)
+{
+  int64_t word_cnt = 0;
+  // value start after this bit may overflow the word
+  const int64_t limit = ((bs_len + CHAR_BIT - 1) / CHAR_BIT - sizeof(uint64_t) + 1) * CHAR_BIT;
+  if (width > 0 && width <= (sizeof(uint64_t) - 1) * CHAR_BIT + 1 && limit > offset) {
+    word_cnt = std::min(cnt, (limit - 1 - offset) / width + 1);
+  }
+  return word_cnt;
+}
+
+OB_INLINE uint64_t get_bit_packed_value(
+    const unsigned char *buf,
+    const int64_t pos,
+    const int64_t width,
+    const uint64_t mask,
+    const bool in_word)
+{
+  uint64_t value = 0;
+  if (OB_LIKELY(in_word)) {
+    MEMCPY(&value, buf + (pos / CHAR_BIT), sizeof(value));
+    value = (value >> (pos % CHAR_BIT)) & mask;
+  } else {
+    ObBitStream::get(buf, pos, width, value);
+  }
+  return value;
+}
+
+struct BitUnpackFunc
+{
+  static void bit_unpack_func(
+      const unsigned char *buf,
+      const int64_t offset,
+      const int64_t width,
+      const int64_t cnt,
+      const int64_t bs_len,
+      const uint64_t base,
+      uint64_t *values)
+  {
+    const uint64_t mask = ObBitStream::get_mask(width);
+    const int64_t word_cnt = get_word_unpack_cnt(offset, width, cnt, bs_len);
+    int64_t pos = offset;
+    for (int64_t i = 0; i < cnt; ++i, pos += width) {
+      values[i] = get_bit_packed_value(buf, pos, width, mask, i < word_cnt) + base;
+    }
+  }
+};
+
+template <int32_t CMP_TYPE>
+struct BitPackedFilterFunc_T
+{
+  static void bit_packed_filter_func(
+      const unsigned char *buf,
+      const int64_t offset,
+      const int64_t width,
+      const int64_t cnt,
+      const int64_t bs_len,
+      const uint64_t literal,
+      sql::ObBitVector &res)
+  {
+    const uint64_t mask = ObBitStream::get_mask(width);
+    const int64_t word_cnt = get_word_unpack_cnt(offset, width, cnt, bs_len);
+    int64_t pos = offset;
+    for (int64_t row_id = 0; row_id < cnt; ++row_id, pos += width) {
+      const uint64_t value = get_bit_packed_value(buf, pos, width, mask, row_id < word_cnt);
+      if (value_cmp_t<uint64_t, CMP_TYPE>(value, literal)) {
+        res.set(row_id);
+      }
+    }
+  }
+};
+
+// Dispatched to AVX-512 / AVX2 version by CPU feature on startup
+extern bit_unpack_func bit_packed_unpack_func;
+extern ObMultiDimArray_T<bit_packed_filter_func, 6> bit_packed_filter_funcs;
+extern bool bit_packed_funcs_inited;
+
 OB_INLINE int ObIntegerBaseDiffDecoder::init(
                                              const ObMicroBlockHeader &micro_block_header,
                                              const ObColumnHeader &column_header, const char *meta)
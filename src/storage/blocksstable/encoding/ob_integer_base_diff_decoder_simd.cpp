@@ -0,0 +1,131 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX STORAGE
+
+#include "ob_encoding_query_util.h"
+#include "ob_integer_base_diff_decoder.h"
+
+namespace oceanbase {
+namespace blocksstable {
+
+#if defined ( __AVX512BW__ )
+// Fetch 8 bit packed values started from bit positions in @pos with one gather
+OB_INLINE static __m512i bit_packed_gather_avx512(
+    const unsigned char *buf,
+    const __m512i pos,
+    const __m512i mask_vec)
+{
+  const __m512i words = _mm512_i64gather_epi64(_mm512_srli_epi64(pos, 3), buf, 1);
+  const __m512i v = _mm512_srlv_epi64(words, _mm512_and_si512(pos, _mm512_set1_epi64(CHAR_BIT - 1)));
+  return _mm512_and_si512(v, mask_vec);
+}
+
+OB_INLINE static __m512i bit_packed_pos_avx512(const int64_t offset, const int64_t width)
+{
+  return _mm512_add_epi64(_mm512_set1_epi64(offset),
+      _mm512_setr_epi64(0, width, 2 * width, 3 * width,
+                        4 * width, 5 * width, 6 * width, 7 * width));
+}
+
+struct BitUnpackAVX512Func
+{
+  // Unpack 8 values by one gather, shift and mask, then add base
+  static void bit_unpack_func(
+      const unsigned char *buf,
+      const int64_t offset,
+      const int64_t width,
+      const int64_t cnt,
+      const int64_t bs_len,
+      const uint64_t base,
+      uint64_t *values)
+  {
+    const uint64_t mask = ObBitStream::get_mask(width);
+    const int64_t word_cnt = get_word_unpack_cnt(offset, width, cnt, bs_len);
+    const __m512i mask_vec = _mm512_set1_epi64(mask);
+    const __m512i base_vec = _mm512_set1_epi64(base);
+    const __m512i step = _mm512_set1_epi64(8 * width);
+    __m512i pos = bit_packed_pos_avx512(offset, width);
+    int64_t i = 0;
+    for (; i + 8 <= word_cnt; i += 8) {
+      const __m512i v = bit_packed_gather_avx512(buf, pos, mask_vec);
+      _mm512_storeu_si512(values + i, _mm512_add_epi64(v, base_vec));
+      pos = _mm512_add_epi64(pos, step);
+    }
+    for (int64_t bit_pos = offset + i * width; i < cnt; ++i, bit_pos += width) {
+      values[i] = get_bit_packed_value(buf, bit_pos, width, mask, i < word_cnt) + base;
+    }
+  }
+};
+
+template <int32_t CMP_TYPE>
+struct BitPackedFilterAVX512Func_T
+{
+  // Unpack 8 values and compare with pre-computed delta of literal, one mask byte per 8 rows
+  static void bit_packed_filter_func(
+      const unsigned char *buf,
+      const int64_t offset,
+      const int64_t width,
+      const int64_t cnt,
+      const int64_t bs_len,
+      const uint64_t literal,
+      sql::ObBitVector &res)
+  {
+    const uint64_t mask = ObBitStream::get_mask(width);
+    const int64_t word_cnt = get_word_unpack_cnt(offset, width, cnt, bs_len);
+    constexpr static int op = ObCmpTypeToAvxOpMap<CMP_TYPE>::value_;
+    const __m512i mask_vec = _mm512_set1_epi64(mask);
+    const __m512i literal_vec = _mm512_set1_epi64(literal);
+    const __m512i step = _mm512_set1_epi64(8 * width);
+    __m512i pos = bit_packed_pos_avx512(offset, width);
+    int64_t row_id = 0;
+    for (; row_id + 8 <= word_cnt; row_id += 8) {
+      const __m512i v = bit_packed_gather_avx512(buf, pos, mask_vec);
+      res.reinterpret_data<uint8_t>()[row_id / 8] = _mm512_cmp_epu64_mask(v, literal_vec, op);
+      pos = _mm512_add_epi64(pos, step);
+    }
+    for (int64_t bit_pos = offset + row_id * width; row_id < cnt; ++row_id, bit_pos += width) {
+      const uint64_t value = get_bit_packed_value(buf, bit_pos, width, mask, row_id < word_cnt);
+      if (value_cmp_t<uint64_t, CMP_TYPE>(value, literal)) {
+        res.set(row_id);
+      }
+    }
+  }
+};
+#else
+struct BitUnpackAVX512Func : public BitUnpackFunc
+{};
+
+template <int32_t CMP_TYPE>
+struct BitPackedFilterAVX512Func_T : public BitPackedFilterFunc_T<CMP_TYPE>
+{};
+#endif
+
+template <int32_t CMP_TYPE>
+struct BitPackedFilterAVX512ArrayInit
+{
+  bool operator()()
+  {
+    bit_packed_filter_funcs[CMP_TYPE]
+        = &(BitPackedFilterAVX512Func_T<CMP_TYPE>::bit_packed_filter_func);
+    return true;
+  }
+};
+
+bool init_bit_packed_avx512_funcs()
+{
+  bit_packed_unpack_func = &BitUnpackAVX512Func::bit_unpack_func;
+  return ObNDArrayIniter<BitPackedFilterAVX512ArrayInit, 6>::apply();
+}
+
+} // end of namespace blocksstable
+} // end of namespace oceanbase
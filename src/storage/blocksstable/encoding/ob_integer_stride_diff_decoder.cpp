@@ -0,0 +1,238 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX STORAGE
+
+#include "ob_integer_stride_diff_decoder.h"
+
+#include "storage/blocksstable/ob_block_sstable_struct.h"
+#include "ob_bit_stream.h"
+
+namespace oceanbase
+{
+namespace blocksstable
+{
+using namespace common;
+const ObColumnHeader::Type ObIntegerStrideDiffDecoder::type_;
+
+int ObIntegerStrideDiffDecoder::decode(ObColumnDecoderCtx &ctx, common::ObObj &cell,
+    const int64_t row_id, const ObBitStream &bs, const char *data, const int64_t len) const
+{
+  int ret = OB_SUCCESS;
+  uint64_t val = STORED_NOT_EXT;
+  const unsigned char *col_data = reinterpret_cast<const unsigned char *>(header_)
+      + ctx.col_header_->length_;
+  if (OB_UNLIKELY(!is_inited())) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("not init", K(ret));
+  } else if (OB_UNLIKELY(NULL == data || len < 0)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid argument", K(ret), KP(data), K(len));
+  } else if (ctx.has_extend_value()
+      && OB_FAIL(ObBitStream::get(col_data, row_id * ctx.micro_block_header_->extend_value_bit_,
+          ctx.micro_block_header_->extend_value_bit_, val))) {
+    LOG_WARN("get extend value failed", K(ret), K(bs), K(ctx));
+  } else if (STORED_NOT_EXT != val) {
+    set_stored_ext_value(cell, static_cast<ObStoredExtValue>(val));
+  } else {
+    if (cell.get_meta() != ctx.obj_meta_) {
+      cell.set_meta_type(ctx.obj_meta_);
+    }
+    uint64_t v = 0;
+    if (OB_FAIL(get_value(ctx, col_data, get_data_offset(ctx), row_id, v))) {
+      LOG_WARN("get stride diff value failed", K(ret), K_(header), K(row_id));
+    } else {
+      cell.v_.uint64_ = v;
+    }
+  }
+  return ret;
+}
+
+int ObIntegerStrideDiffDecoder::update_pointer(const char *old_block, const char *cur_block)
+{
+  int ret = OB_SUCCESS;
+  if (!is_inited()) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("not init", K(ret));
+  } else if (OB_ISNULL(old_block) || OB_ISNULL(cur_block)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid argument", K(ret), KP(old_block), KP(cur_block));
+  } else {
+    ObIColumnDecoder::update_pointer(header_, old_block, cur_block);
+  }
+  return ret;
+}
+
+template <ObBitStream::ObBitStreamUnpackType UNPACK_TYPE>
+void ObIntegerStrideDiffDecoder::batch_get_bitpacked_values(
+    const ObColumnDecoderCtx &ctx,
+    const int64_t *row_ids,
+    const int64_t row_cap,
+    const int64_t datum_len,
+    const int64_t data_offset,
+    common::ObDatum *datums) const
+{
+  const bool has_ext_val = ctx.has_extend_value();
+  const int64_t bs_len = header_->length_ * ctx.micro_block_header_->row_count_;
+  const unsigned char *col_data = reinterpret_cast<const unsigned char *>(header_)
+      + ctx.col_header_->length_;
+  const uint64_t base = header_->base_;
+  const uint64_t stride = header_->stride_;
+  for (int64_t i = 0; i < row_cap; ++i) {
+    if (has_ext_val && datums[i].is_null()) {
+    } else {
+      const int64_t row_id = row_ids[i];
+      int64_t delta = 0;
+      ObBitStream::get<UNPACK_TYPE>(
+          col_data, data_offset + row_id * header_->length_, header_->length_, bs_len, delta);
+      const uint64_t value = base + static_cast<uint64_t>(delta)
+          + static_cast<uint64_t>(row_id) * stride;
+      MEMCPY(const_cast<char *>(datums[i].ptr_), &value, datum_len);
+      datums[i].pack_ = static_cast<uint32_t>(datum_len);
+    }
+  }
+}
+
+// Internal call, not check parameters for performance
+int ObIntegerStrideDiffDecoder::batch_decode(
+    const ObColumnDecoderCtx &ctx,
+    const ObIRowIndex* row_index,
+    const int64_t *row_ids,
+    const char **cell_datas,
+    const int64_t row_cap,
+    common::ObDatum *datums) const
+{
+  UNUSEDx(row_index, cell_datas);
+  int ret = OB_SUCCESS;
+  uint32_t datum_len = 0;
+  const unsigned char *col_data = reinterpret_cast<const unsigned char *>(header_)
+      + ctx.col_header_->length_;
+  if (OB_UNLIKELY(!is_inited())) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("Not inited", K(ret));
+  } else if (ctx.has_extend_value()
+      && OB_FAIL(set_null_datums_from_fixed_column(ctx, row_ids, row_cap, col_data, datums))) {
+    LOG_WARN("Failed to set null datums from fixed data", K(ret), K(ctx));
+  } else if (OB_FAIL(get_uint_data_datum_len(
+      ObDatum::get_obj_datum_map_type(ctx.obj_meta_.get_type()), datum_len))) {
+    LOG_WARN("Failed to get datum length of int/uint data", K(ret));
+  } else {
+    const int64_t data_offset = get_data_offset(ctx);
+    if (ctx.is_bit_packing()) {
+      const int64_t packed_len = header_->length_;
+      if (packed_len < 10) {
+        batch_get_bitpacked_values<ObBitStream::PACKED_LEN_LESS_THAN_10>(
+            ctx, row_ids, row_cap, datum_len, data_offset, datums);
+      } else if (packed_len < 26) {
+        batch_get_bitpacked_values<ObBitStream::PACKED_LEN_LESS_THAN_26>(
+            ctx, row_ids, row_cap, datum_len, data_offset, datums);
+      } else if (packed_len <= 64) {
+        batch_get_bitpacked_values<ObBitStream::DEFAULT>(
+            ctx, row_ids, row_cap, datum_len, data_offset, datums);
+      } else {
+        ret = OB_ERR_UNEXPECTED;
+        LOG_WARN("Unpack size larger than 64 bit", K(ret), K(packed_len));
+      }
+    } else {
+      uint64_t value = 0;
+      for (int64_t i = 0; OB_SUCC(ret) && i < row_cap; ++i) {
+        if (ctx.has_extend_value() && datums[i].is_null()) {
+          // Skip
+        } else if (OB_FAIL(get_value(ctx, col_data, data_offset, row_ids[i], value))) {
+          LOG_WARN("Failed to get stride diff value", K(ret), K(i));
+        } else {
+          MEMCPY(const_cast<char *>(datums[i].ptr_), &value, datum_len);
+          datums[i].pack_ = datum_len;
+        }
+      }
+    }
+  }
+  return ret;
+}
+
+int ObIntegerStrideDiffDecoder::pushdown_operator(
+    const sql::ObPushdownFilterExecutor *parent,
+    const ObColumnDecoderCtx &col_ctx,
+    const sql::ObWhiteFilterExecutor &filter,
+    const char* meta_data,
+    const ObIRowIndex* row_index,
+    ObBitmap &result_bitmap) const
+{
+  UNUSEDx(meta_data, row_index);
+  int ret = OB_SUCCESS;
+  const sql::ObWhiteFilterOperatorType op_type = filter.get_op_type();
+  const unsigned char *col_data = reinterpret_cast<const unsigned char *>(header_)
+      + col_ctx.col_header_->length_;
+  if (OB_UNLIKELY(!is_inited())) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("Stride diff decoder not inited", K(ret), K(filter));
+  } else if (OB_UNLIKELY(op_type >= sql::WHITE_OP_MAX
+      || col_ctx.micro_block_header_->row_count_ != result_bitmap.size())) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("Invalid argument for pushed down white filter", K(ret), K(op_type),
+        "bitmap_size", result_bitmap.size());
+  } else if (OB_FAIL(get_is_null_bitmap_from_fixed_column(col_ctx, col_data, result_bitmap))) {
+    LOG_WARN("Failed to get is null bitmap", K(ret), K(col_ctx));
+  } else if (sql::WHITE_OP_NU == op_type) {
+  } else if (sql::WHITE_OP_NN == op_type) {
+    if (OB_FAIL(result_bitmap.bit_not())) {
+      LOG_WARN("Failed to flip bits for result bitmap", K(ret), K(result_bitmap.size()));
+    }
+  } else {
+    // value of a row is a linear function of row id, evaluate it without touching neighbours
+    const int64_t data_offset = get_data_offset(col_ctx);
+    const bool null_value_contained = result_bitmap.popcnt() > 0;
+    const bool exist_parent_filter = nullptr != parent;
+    ObObj cur_obj;
+    cur_obj.copy_meta_type(col_ctx.obj_meta_);
+    for (int64_t row_id = 0;
+         OB_SUCC(ret) && row_id < col_ctx.micro_block_header_->row_count_;
+         ++row_id) {
+      bool result = false;
+      if (exist_parent_filter && parent->can_skip_filter(row_id)) {
+      } else if (null_value_contained && result_bitmap.test(row_id)) {
+        if (OB_FAIL(result_bitmap.set(row_id, false))) {
+          LOG_WARN("Failed to set row with null object to false", K(ret), K(row_id));
+        }
+      } else if (OB_FAIL(get_value(col_ctx, col_data, data_offset, row_id, cur_obj.v_.uint64_))) {
+        LOG_WARN("Failed to get stride diff value", K(ret), K(row_id), K_(header));
+      } else if (OB_FAIL(evaluate_white_filter(cur_obj, filter, result))) {
+        LOG_WARN("Failed to evaluate white filter", K(ret), K(row_id), K(cur_obj));
+      } else if (result && OB_FAIL(result_bitmap.set(row_id))) {
+        LOG_WARN("Failed to set result bitmap", K(ret), K(row_id), K(filter));
+      }
+    }
+  }
+  return ret;
+}
+
+int ObIntegerStrideDiffDecoder::get_null_count(
+    const ObColumnDecoderCtx &ctx,
+    const ObIRowIndex *row_index,
+    const int64_t *row_ids,
+    const int64_t row_cap,
+    int64_t &null_count) const
+{
+  int ret = OB_SUCCESS;
+  const char *col_data = reinterpret_cast<const char *>(header_) + ctx.col_header_->length_;
+  if (OB_UNLIKELY(!is_inited())) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("Stride diff decoder is not inited", K(ret));
+  } else if (OB_FAIL(ObIColumnDecoder::get_null_count_from_extend_value(
+      ctx, row_index, row_ids, row_cap, col_data, null_count))) {
+    LOG_WARN("Failed to get null count", K(ctx), K(ret));
+  }
+  return ret;
+}
+
+} // end namespace blocksstable
+} // end namespace oceanbase
@@ -0,0 +1,149 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#ifndef OCEANBASE_ENCODING_OB_INTEGER_STRIDE_DIFF_DECODER_H_
+#define OCEANBASE_ENCODING_OB_INTEGER_STRIDE_DIFF_DECODER_H_
+
+#include "ob_icolumn_decoder.h"
+#include "ob_encoding_util.h"
+#include "ob_integer_stride_diff_encoder.h"
+#include "ob_bit_stream.h"
+
+namespace oceanbase
+{
+namespace blocksstable
+{
+
+struct ObColumnHeader;
+struct ObIntegerStrideDiffHeader;
+
+class ObIntegerStrideDiffDecoder : public ObIColumnDecoder
+{
+public:
+  static const ObColumnHeader::Type type_ = ObColumnHeader::INTEGER_STRIDE_DIFF;
+  ObIntegerStrideDiffDecoder() : header_(NULL)
+  {}
+  virtual ~ObIntegerStrideDiffDecoder() {}
+
+  OB_INLINE int init(
+      const ObMicroBlockHeader &micro_block_header,
+      const ObColumnHeader &column_header,
+      const char *meta);
+
+  virtual int decode(ObColumnDecoderCtx &ctx, common::ObObj &cell, const int64_t row_id,
+      const ObBitStream &bs, const char *data, const int64_t len) const override;
+
+  virtual int update_pointer(const char *old_block, const char *cur_block) override;
+
+  void reset() { this->~ObIntegerStrideDiffDecoder(); new (this) ObIntegerStrideDiffDecoder(); }
+  OB_INLINE void reuse() { header_ = NULL; }
+  virtual ObColumnHeader::Type get_type() const override { return type_; }
+  bool is_inited() const { return NULL != header_; }
+
+  virtual int batch_decode(
+      const ObColumnDecoderCtx &ctx,
+      const ObIRowIndex* row_index,
+      const int64_t *row_ids,
+      const char **cell_datas,
+      const int64_t row_cap,
+      common::ObDatum *datums) const override;
+
+  virtual int pushdown_operator(
+      const sql::ObPushdownFilterExecutor *parent,
+      const ObColumnDecoderCtx &col_ctx,
+      const sql::ObWhiteFilterExecutor &filter,
+      const char* meta_data,
+      const ObIRowIndex* row_index,
+      ObBitmap &result_bitmap) const override;
+
+  virtual int get_null_count(
+      const ObColumnDecoderCtx &ctx,
+      const ObIRowIndex *row_index,
+      const int64_t *row_ids,
+      const int64_t row_cap,
+      int64_t &null_count) const override;
+
+private:
+  // offset of the delta values in @col_data, in bits for bit packing and bytes otherwise
+  OB_INLINE int64_t get_data_offset(const ObColumnDecoderCtx &ctx) const
+  {
+    int64_t data_offset = 0;
+    if (ctx.has_extend_value()) {
+      data_offset = ctx.micro_block_header_->row_count_
+          * ctx.micro_block_header_->extend_value_bit_;
+    }
+    if (!ctx.is_bit_packing()) {
+      data_offset = (data_offset + CHAR_BIT - 1) / CHAR_BIT;
+    }
+    return data_offset;
+  }
+
+  OB_INLINE int get_value(
+      const ObColumnDecoderCtx &ctx,
+      const unsigned char *col_data,
+      const int64_t data_offset,
+      const int64_t row_id,
+      uint64_t &value) const
+  {
+    int ret = common::OB_SUCCESS;
+    uint64_t delta = 0;
+    if (ctx.is_bit_packing()) {
+      ret = ObBitStream::get(col_data, data_offset + row_id * header_->length_,
+          header_->length_, delta);
+    } else {
+      MEMCPY(&delta, col_data + data_offset + row_id * header_->length_, header_->length_);
+    }
+    value = header_->base_ + delta + static_cast<uint64_t>(row_id) * header_->stride_;
+    return ret;
+  }
+
+  template <ObBitStream::ObBitStreamUnpackType UNPACK_TYPE>
+  void batch_get_bitpacked_values(
+      const ObColumnDecoderCtx &ctx,
+      const int64_t *row_ids,
+      const int64_t row_cap,
+      const int64_t datum_len,
+      const int64_t data_offset,
+      common::ObDatum *datums) const;
+
+private:
+  const ObIntegerStrideDiffHeader *header_;
+};
+
+OB_INLINE int ObIntegerStrideDiffDecoder::init(
+    const ObMicroBlockHeader &micro_block_header,
+    const ObColumnHeader &column_header,
+    const char *meta)
+{
+  UNUSED(micro_block_header);
+  int ret = common::OB_SUCCESS;
+  // performance critical, don't check params
+  if (is_inited()) {
+    ret = common::OB_INIT_TWICE;
+    STORAGE_LOG(WARN, "init twice", K(ret));
+  } else {
+    const ObObjTypeStoreClass sc =
+        get_store_class_map()[ob_obj_type_class(column_header.get_store_obj_type())];
+    if (ObIntSC != sc && ObUIntSC != sc) {
+      ret = common::OB_INNER_STAT_ERROR;
+      STORAGE_LOG(WARN, "not supported store class", K(ret), K(column_header), K(sc));
+    } else {
+      header_ = reinterpret_cast<const ObIntegerStrideDiffHeader *>(meta + column_header.offset_);
+    }
+  }
+  return ret;
+}
+
+} // end namespace blocksstable
+} // end namespace oceanbase
+
+#endif // OCEANBASE_ENCODING_OB_INTEGER_STRIDE_DIFF_DECODER_H_
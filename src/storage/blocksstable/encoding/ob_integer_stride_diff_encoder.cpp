@@ -0,0 +1,237 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX STORAGE
+
+#include "ob_integer_stride_diff_encoder.h"
+
+#include "storage/blocksstable/ob_data_buffer.h"
+#include "ob_bit_stream.h"
+
+namespace oceanbase
+{
+namespace blocksstable
+{
+
+using namespace common;
+
+const ObColumnHeader::Type ObIntegerStrideDiffEncoder::type_;
+
+ObIntegerStrideDiffEncoder::ObIntegerStrideDiffEncoder()
+  : type_store_size_(0), mask_(0), reverse_mask_(0), base_(0), stride_(0), header_(NULL)
+{
+}
+
+int ObIntegerStrideDiffEncoder::init(
+    const ObColumnEncodingCtx &ctx,
+    const int64_t column_index,
+    const ObConstDatumRowArray &rows)
+{
+  int ret = OB_SUCCESS;
+  if (IS_INIT) {
+    ret = OB_INIT_TWICE;
+    LOG_WARN("init twice", K(ret));
+  } else if (OB_FAIL(ObIColumnEncoder::init(ctx, column_index, rows))) {
+    LOG_WARN("init base column encoder failed",
+        K(ret), K(ctx), K(column_index), "row count", rows.count());
+  } else {
+    const ObObjTypeClass tc = ob_obj_type_class(column_type_.get_type());
+    const ObObjTypeStoreClass sc = get_store_class_map()[tc];
+    type_store_size_ = get_type_size_map()[column_type_.get_type()];
+    if ((ObIntSC != sc && ObUIntSC != sc) || ObFloatTC == tc || ObDoubleTC == tc
+        || type_store_size_ < 0) {
+      // the bit pattern of float point numbers has no linear trend
+      ret = OB_NOT_SUPPORTED;
+      LOG_WARN("not supported type for integer stride diff",
+          K(ret), K(sc), K(tc), K_(type_store_size), K_(column_index));
+    } else {
+      mask_ = INTEGER_MASK_TABLE[type_store_size_];
+      if (ObIntSC == sc) {
+        reverse_mask_ = ~mask_;
+      }
+      column_header_.type_ = type_;
+    }
+  }
+  return ret;
+}
+
+void ObIntegerStrideDiffEncoder::reuse()
+{
+  ObIColumnEncoder::reuse();
+  type_store_size_ = 0;
+  mask_ = 0;
+  reverse_mask_ = 0;
+  base_ = 0;
+  stride_ = 0;
+  header_ = NULL;
+  is_inited_ = false;
+}
+
+// Estimate stride by the first and last not null cell, which is exact for
+// regularly sampled series and leaves the jitter to the bit packed deltas.
+int ObIntegerStrideDiffEncoder::detect_stride(bool &found)
+{
+  int ret = OB_SUCCESS;
+  const ObColDatums &datums = *ctx_->col_datums_;
+  int64_t first = -1;
+  int64_t last = -1;
+  found = false;
+  for (int64_t i = 0; i < datums.count(); ++i) {
+    if (!datums.at(i).is_null() && !datums.at(i).is_nop()) {
+      first = i;
+      break;
+    }
+  }
+  for (int64_t i = datums.count() - 1; first >= 0 && i > first; --i) {
+    if (!datums.at(i).is_null() && !datums.at(i).is_nop()) {
+      last = i;
+      break;
+    }
+  }
+  if (first >= 0 && last > first) {
+    const int64_t first_v = static_cast<int64_t>(cast_to_uint64(datums.at(first)));
+    const int64_t last_v = static_cast<int64_t>(cast_to_uint64(datums.at(last)));
+    // overflow of signed subtraction means the range is far too wide for a stride
+    int64_t diff = 0;
+    if (!__builtin_sub_overflow(last_v, first_v, &diff)) {
+      stride_ = static_cast<uint64_t>(diff / (last - first));
+      found = 0 != stride_;
+    }
+  }
+  return ret;
+}
+
+int ObIntegerStrideDiffEncoder::traverse(bool &suitable)
+{
+  int ret = OB_SUCCESS;
+  bool found = false;
+  suitable = false;
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("not init", K(ret));
+  } else if (OB_FAIL(detect_stride(found))) {
+    LOG_WARN("detect stride failed", K(ret));
+  } else if (!found) {
+    // constant or too sparse, leave it to integer base diff
+  } else {
+    const ObColDatums &datums = *ctx_->col_datums_;
+    int64_t min = INT64_MAX;
+    int64_t max = INT64_MIN;
+    uint64_t max_value = 0;
+    for (int64_t i = 0; i < datums.count(); ++i) {
+      const ObDatum &datum = datums.at(i);
+      if (!datum.is_null() && !datum.is_nop()) {
+        const int64_t r = static_cast<int64_t>(residual(i, datum));
+        const uint64_t v = cast_to_uint64(datum);
+        min = r < min ? r : min;
+        max = r > max ? r : max;
+        if (0 != reverse_mask_ && static_cast<int64_t>(v) < 0) {
+          max_value = UINT64_MAX;
+        } else if (v > max_value) {
+          max_value = v;
+        }
+      }
+    }
+    base_ = static_cast<uint64_t>(min);
+    const uint64_t delta = static_cast<uint64_t>(max) - static_cast<uint64_t>(min);
+
+    bool bit_packing = false;
+    int64_t orig_size = get_packing_size(bit_packing, max_value);
+    if (!bit_packing) {
+      orig_size *= CHAR_BIT;
+    }
+    bit_packing = false;
+    int64_t delta_size = get_packing_size(bit_packing, delta);
+    if (!bit_packing) {
+      delta_size *= CHAR_BIT;
+    }
+    LOG_DEBUG("integer stride diff size", K_(column_index), K_(stride), K(delta_size), K(orig_size));
+    if ((orig_size - delta_size) * rows_->count() > sizeof(ObIntegerStrideDiffHeader) * CHAR_BIT) {
+      suitable = true;
+      if (bit_packing) {
+        desc_.bit_packing_length_ = delta_size;
+      } else {
+        desc_.fix_data_length_ = delta_size / CHAR_BIT;
+      }
+      desc_.need_data_store_ = true;
+      desc_.has_null_ = ctx_->null_cnt_ > 0;
+      desc_.has_nope_ = ctx_->nope_cnt_ > 0;
+      desc_.need_extend_value_bit_store_ = desc_.has_null_ || desc_.has_nope_;
+      if (desc_.need_extend_value_bit_store_) {
+        column_header_.set_has_extend_value_attr();
+      }
+      if (desc_.bit_packing_length_ > 0) {
+        column_header_.set_bit_packing_attr();
+      }
+      column_header_.set_fix_lenght_attr();
+    }
+  }
+  return ret;
+}
+
+int ObIntegerStrideDiffEncoder::store_meta(ObBufferWriter &buf_writer)
+{
+  int ret = OB_SUCCESS;
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("not init", K(ret));
+  } else {
+    header_ = reinterpret_cast<ObIntegerStrideDiffHeader *>(buf_writer.current());
+    if (OB_FAIL(buf_writer.advance_zero(sizeof(*header_)))) {
+      LOG_WARN("advance meta store size failed", K(ret));
+    } else {
+      header_->version_ = ObIntegerStrideDiffHeader::OB_INTEGER_STRIDE_DIFF_HEADER_V1;
+      header_->base_ = base_;
+      header_->stride_ = stride_;
+      LOG_DEBUG("integer stride diff meta", K(*header_));
+    }
+  }
+  return ret;
+}
+
+int64_t ObIntegerStrideDiffEncoder::calc_size() const
+{
+  int64_t size = INT64_MAX;
+  if (is_inited_) {
+    if (desc_.bit_packing_length_ > 0) {
+      size = (rows_->count() * desc_.bit_packing_length_ + CHAR_BIT - 1) / CHAR_BIT;
+    } else {
+      size = rows_->count() * desc_.fix_data_length_;
+    }
+  }
+  return size + sizeof(ObIntegerStrideDiffHeader);
+}
+
+int ObIntegerStrideDiffEncoder::store_fix_data(ObBufferWriter &buf_writer)
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(!is_inited_)) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("not init", K(ret));
+  } else if (OB_UNLIKELY(!is_valid_fix_encoder())) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid argument", K(ret), K_(desc));
+  } else {
+    DeltaGetter getter(*this);
+    FixDataSetter setter(*this);
+    header_->length_ = static_cast<uint8_t>(desc_.bit_packing_length_ > 0
+        ? desc_.bit_packing_length_
+        : desc_.fix_data_length_);
+    if (OB_FAIL(fill_column_store(buf_writer, *ctx_->col_datums_, getter, setter))) {
+      LOG_WARN("fill column store failed", K(ret));
+    }
+  }
+  return ret;
+}
+
+} // end namespace blocksstable
+} // end namespace oceanbase
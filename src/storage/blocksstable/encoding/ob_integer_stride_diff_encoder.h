@@ -0,0 +1,137 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#ifndef OCEANBASE_ENCODING_OB_INTEGER_STRIDE_DIFF_ENCODER_H_
+#define OCEANBASE_ENCODING_OB_INTEGER_STRIDE_DIFF_ENCODER_H_
+
+#include "ob_icolumn_encoder.h"
+#include "ob_encoding_util.h"
+#include "ob_bit_stream.h"
+
+namespace oceanbase
+{
+namespace blocksstable
+{
+
+// Integer stride diff encoding, for monotonic series such as timestamps or auto increment
+// ids sampled at a (nearly) regular interval:
+//   value(row_id) = base_ + row_id * stride_ + delta(row_id)
+// The delta of delta between adjacent rows is folded into one stride for the whole
+// micro block, so every row can still be located directly by row id.
+// All arithmetic wraps around in 64 bits.
+struct ObIntegerStrideDiffHeader
+{
+  static constexpr uint8_t OB_INTEGER_STRIDE_DIFF_HEADER_V1 = 0;
+  uint8_t version_;
+  uint8_t length_;
+  uint64_t base_;
+  uint64_t stride_;
+
+  ObIntegerStrideDiffHeader()
+    : version_(OB_INTEGER_STRIDE_DIFF_HEADER_V1), length_(0), base_(0), stride_(0)
+  {
+  }
+
+  TO_STRING_KV(K_(length), K_(base), K_(stride));
+} __attribute__((packed));
+
+class ObIntegerStrideDiffEncoder : public ObIColumnEncoder
+{
+public:
+  static const ObColumnHeader::Type type_ = ObColumnHeader::INTEGER_STRIDE_DIFF;
+
+  ObIntegerStrideDiffEncoder();
+  virtual ~ObIntegerStrideDiffEncoder() {}
+
+  virtual int init(
+      const ObColumnEncodingCtx &ctx,
+      const int64_t column_index,
+      const ObConstDatumRowArray &rows) override;
+
+  virtual void reuse() override;
+  virtual int store_meta(ObBufferWriter &buf_writer) override;
+  virtual int store_data(
+      const int64_t row_id, ObBitStream &bs, char *buf, const int64_t len) override
+  {
+    UNUSEDx(row_id, bs, buf, len);
+    return common::OB_NOT_SUPPORTED;
+  }
+
+  virtual int traverse(bool &suitable) override;
+  virtual int64_t calc_size() const override;
+  virtual ObColumnHeader::Type get_type() const { return type_; }
+  virtual int store_fix_data(ObBufferWriter &buf_writer) override;
+
+public:
+  struct DeltaGetter
+  {
+    explicit DeltaGetter(const ObIntegerStrideDiffEncoder &encoder) : encoder_(encoder) {}
+    inline int operator()(const int64_t row_id, const common::ObDatum &datum, uint64_t &v)
+    {
+      v = encoder_.delta(row_id, datum);
+      return common::OB_SUCCESS;
+    }
+
+    const ObIntegerStrideDiffEncoder &encoder_;
+  };
+
+  struct FixDataSetter
+  {
+    explicit FixDataSetter(const ObIntegerStrideDiffEncoder &encoder) : encoder_(encoder) {}
+    inline int operator()(
+        const int64_t row_id,
+        const common::ObDatum &datum,
+        char *buf,
+        const int64_t len) const
+    {
+      // performance critical, do not check parameters
+      uint64_t v = encoder_.delta(row_id, datum);
+      MEMCPY(buf, &v, len);
+      return common::OB_SUCCESS;
+    }
+
+    const ObIntegerStrideDiffEncoder &encoder_;
+  };
+
+private:
+  OB_INLINE uint64_t cast_to_uint64(const common::ObDatum &datum) const
+  {
+    uint64_t v = datum.get_uint64() & mask_;
+    if (0 != reverse_mask_ && (v & (reverse_mask_ >> 1))) {
+      v |= reverse_mask_;
+    }
+    return v;
+  }
+  OB_INLINE uint64_t residual(const int64_t row_id, const common::ObDatum &datum) const
+  {
+    return cast_to_uint64(datum) - static_cast<uint64_t>(row_id) * stride_;
+  }
+  OB_INLINE uint64_t delta(const int64_t row_id, const common::ObDatum &datum) const
+  {
+    return residual(row_id, datum) - base_;
+  }
+  int detect_stride(bool &found);
+
+private:
+  int64_t type_store_size_;
+  uint64_t mask_;
+  uint64_t reverse_mask_;
+  uint64_t base_;
+  uint64_t stride_;
+  // is null before write meta
+  ObIntegerStrideDiffHeader *header_;
+};
+
+} // end namespace blocksstable
+} // end namespace oceanbase
+
+#endif // OCEANBASE_ENCODING_OB_INTEGER_STRIDE_DIFF_ENCODER_H_
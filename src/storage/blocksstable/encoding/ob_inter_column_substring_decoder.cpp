@@ -71,24 +71,119 @@ int ObInterColSubStrDecoder::decode(ObColumnDecoderCtx &ctx, ObObj &cell, const
       } else if (ObActionFlag::OP_NOP == ref_cell.get_ext()) {
         cell.set_ext(ObActionFlag::OP_NOP);
       } else {
-        const char *cell_data =
-            reinterpret_cast<const char *>(meta_header_) + ctx.col_header_->length_
-            + row_id * (meta_header_->start_pos_byte_ + meta_header_->val_len_byte_);
-        int64_t start_pos = 0;
-        if (!meta_header_->is_same_start_pos()) {
-          MEMCPY(&start_pos, cell_data, meta_header_->start_pos_byte_);
-        } else {
-          start_pos = meta_header_->start_pos_;
-        }
-        int64_t val_len = 0;
-        if (!meta_header_->is_fix_length()) {
-          MEMCPY(&val_len, cell_data + meta_header_->start_pos_byte_, meta_header_->val_len_byte_);
+        get_substr(ctx, row_id, ref_cell, cell);
+      }
+    }
+  }
+  return ret;
+}
+
+OB_INLINE void ObInterColSubStrDecoder::get_substr(const ObColumnDecoderCtx &ctx,
+    const int64_t row_id, const ObObj &ref_cell, ObObj &cell) const
+{
+  const char *cell_data =
+      reinterpret_cast<const char *>(meta_header_) + ctx.col_header_->length_
+      + row_id * (meta_header_->start_pos_byte_ + meta_header_->val_len_byte_);
+  int64_t start_pos = 0;
+  if (!meta_header_->is_same_start_pos()) {
+    MEMCPY(&start_pos, cell_data, meta_header_->start_pos_byte_);
+  } else {
+    start_pos = meta_header_->start_pos_;
+  }
+  int64_t val_len = 0;
+  if (!meta_header_->is_fix_length()) {
+    MEMCPY(&val_len, cell_data + meta_header_->start_pos_byte_, meta_header_->val_len_byte_);
+  } else {
+    val_len = meta_header_->length_;
+  }
+
+  cell.v_.string_ = ref_cell.v_.string_ + start_pos;
+  cell.val_len_ = static_cast<int32_t>(val_len);
+}
+
+/**
+ * Substrings are evaluated in place on the cells of the referenced column, exception rows are
+ * read from the column meta. Neither is copied or materialized through the row reader.
+ */
+int ObInterColSubStrDecoder::pushdown_operator(
+    const sql::ObPushdownFilterExecutor *parent,
+    const ObColumnDecoderCtx &col_ctx,
+    const sql::ObWhiteFilterExecutor &filter,
+    const char* meta_data,
+    const ObIRowIndex* row_index,
+    ObBitmap &result_bitmap) const
+{
+  UNUSED(meta_data);
+  int ret = OB_SUCCESS;
+  const sql::ObWhiteFilterOperatorType op_type = filter.get_op_type();
+  if (OB_UNLIKELY(!is_inited())) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("InterColSubStr decoder not inited", K(ret), K(filter));
+  } else if (OB_UNLIKELY(nullptr == row_index
+                         || col_ctx.micro_block_header_->row_count_ != result_bitmap.size())) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("Invalid argument for pushdown operator", K(ret), KP(row_index),
+        K(result_bitmap.size()));
+  } else if (OB_ISNULL(col_ctx.ref_decoder_) || OB_ISNULL(col_ctx.ref_ctx_)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("Null reference column decoder", K(ret), K(col_ctx));
+  } else if (OB_UNLIKELY(op_type >= sql::WHITE_OP_MAX)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("Invalid op type for pushed down white filter", K(ret), K(op_type));
+  } else {
+    ObObj cur_obj;
+    ObObj ref_cell;
+    const char *row_data = nullptr;
+    int64_t row_len = 0;
+    for (int64_t row_id = 0;
+         OB_SUCC(ret) && row_id < col_ctx.micro_block_header_->row_count_;
+         ++row_id) {
+      int64_t ref = -1;
+      bool result = false;
+      cur_obj.copy_meta_type(col_ctx.obj_meta_);
+      if (nullptr != parent && parent->can_skip_filter(row_id)) {
+        continue;
+      } else if (has_exc(col_ctx) && OB_FAIL(ObBitMapMetaReader<ObStringSC>::read(
+          meta_header_->payload_,
+          col_ctx.micro_block_header_->row_count_,
+          col_ctx.is_bit_packing(), row_id,
+          col_ctx.col_header_->length_ - sizeof(ObInterColSubStrMetaHeader),
+          ref, cur_obj, col_ctx.col_header_->get_store_obj_type()))) {
+        LOG_WARN("meta_reader_ read failed", K(ret), K(row_id));
+      } else if (-1 != ref) {
+        // exception row, already read
+      } else if (OB_FAIL(locate_row_data(col_ctx, row_index, row_id, row_data, row_len))) {
+        LOG_WARN("Failed to locate row data", K(ret), K(row_id));
+      } else {
+        ObBitStream bs(reinterpret_cast<unsigned char *>(const_cast<char *>(row_data)), row_len);
+        if (OB_FAIL(col_ctx.ref_decoder_->decode(
+            *col_ctx.ref_ctx_, ref_cell, row_id, bs, row_data, row_len))) {
+          LOG_WARN("ref_decoder decode failed", K(ret), K(row_id), KP(row_data), K(row_len));
+        } else if (ref_cell.is_null()) {
+          cur_obj.set_null();
+        } else if (ObActionFlag::OP_NOP == ref_cell.get_ext()) {
+          cur_obj.set_ext(ObActionFlag::OP_NOP);
         } else {
-          val_len = meta_header_->length_;
+          get_substr(col_ctx, row_id, ref_cell, cur_obj);
         }
+      }
 
-        cell.v_.string_ = ref_cell.v_.string_ + start_pos;
-        cell.val_len_ = static_cast<int32_t>(val_len);
+      if (OB_FAIL(ret)) {
+      } else if (cur_obj.is_null()) {
+        result = sql::WHITE_OP_NU == op_type;
+      } else if (cur_obj.is_ext() || sql::WHITE_OP_NU == op_type) {
+        result = false;
+      } else if (sql::WHITE_OP_NN == op_type) {
+        result = true;
+      } else if (cur_obj.is_fixed_len_char_type() && nullptr != col_ctx.col_param_
+          && OB_FAIL(storage::pad_column(col_ctx.col_param_->get_accuracy(),
+                                         *col_ctx.allocator_, cur_obj))) {
+        LOG_WARN("Failed to pad column", K(ret), K(row_id));
+      } else if (OB_FAIL(evaluate_white_filter(cur_obj, filter, result))) {
+        LOG_WARN("Failed on trying to filter the row", K(ret), K(row_id), K(cur_obj));
+      }
+      if (OB_SUCC(ret) && result && OB_FAIL(result_bitmap.set(row_id))) {
+        LOG_WARN("Failed to set result bitmap", K(ret), K(row_id));
       }
     }
   }
@@ -53,11 +53,22 @@ public:
 
   virtual bool can_vectorized() const override { return false; }
 
+  virtual int pushdown_operator(
+      const sql::ObPushdownFilterExecutor *parent,
+      const ObColumnDecoderCtx &col_ctx,
+      const sql::ObWhiteFilterExecutor &filter,
+      const char* meta_data,
+      const ObIRowIndex* row_index,
+      ObBitmap &result_bitmap) const override;
+
 protected:
   inline bool has_exc(const ObColumnDecoderCtx &ctx) const
   { return ctx.col_header_->length_ > sizeof(ObInterColSubStrMetaHeader); }
 
 private:
+  void get_substr(const ObColumnDecoderCtx &ctx, const int64_t row_id,
+      const common::ObObj &ref_cell, common::ObObj &cell) const;
+
   const ObInterColSubStrMetaHeader *meta_header_;
 };
 
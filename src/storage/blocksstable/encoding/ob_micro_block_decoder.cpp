@@ -271,7 +271,10 @@ ObIEncodeBlockReader::decode_acquire_func ObIEncodeBlockReader::acquire_funcs_[O
     acquire_decoder<ObHexStringDecoder>,
     acquire_decoder<ObStringPrefixDecoder>,
     acquire_decoder<ObColumnEqualDecoder>,
-    acquire_decoder<ObInterColSubStrDecoder>
+    acquire_decoder<ObInterColSubStrDecoder>,
+    acquire_decoder<ObIntegerStrideDiffDecoder>,
+    acquire_decoder<ObFloatDecimalDecoder>,
+    acquire_decoder<ObStringSymbolDecoder>
 };
 
 ObIEncodeBlockReader::ObIEncodeBlockReader()
@@ -1015,6 +1018,39 @@ int ObMicroBlockDecoder::acquire(
         }
         break;
       }
+      case ObColumnHeader::INTEGER_STRIDE_DIFF: {
+        ObIntegerStrideDiffDecoder *d = NULL;
+        if (OB_FAIL(allocator.alloc(d))) {
+          LOG_WARN("alloc failed", K(ret));
+        } else if (OB_FAIL(d->init(header, col_header, meta_data))) {
+          LOG_WARN("init integer stride diff decoder failed", K(ret));
+        } else {
+          decoder = d;
+        }
+        break;
+      }
+      case ObColumnHeader::FLOAT_DECIMAL: {
+        ObFloatDecimalDecoder *d = NULL;
+        if (OB_FAIL(allocator.alloc(d))) {
+          LOG_WARN("alloc failed", K(ret));
+        } else if (OB_FAIL(d->init(header, col_header, meta_data))) {
+          LOG_WARN("init float decimal decoder failed", K(ret));
+        } else {
+          decoder = d;
+        }
+        break;
+      }
+      case ObColumnHeader::STRING_SYMBOL: {
+        ObStringSymbolDecoder *d = NULL;
+        if (OB_FAIL(allocator.alloc(d))) {
+          LOG_WARN("alloc failed", K(ret));
+        } else if (OB_FAIL(d->init(header, col_header, meta_data))) {
+          LOG_WARN("init string symbol decoder failed", K(ret));
+        } else {
+          decoder = d;
+        }
+        break;
+      }
       default:
         ret = OB_INNER_STAT_ERROR;
         LOG_WARN("unsupported encoding type", K(ret), "type", col_header.type_);
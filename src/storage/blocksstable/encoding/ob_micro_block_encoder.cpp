@@ -31,6 +31,9 @@
 #include "ob_encoding_hash_util.h"
 #include "ob_string_prefix_encoder.h"
 #include "ob_inter_column_substring_encoder.h"
+#include "ob_integer_stride_diff_encoder.h"
+#include "ob_float_decimal_encoder.h"
+#include "ob_string_symbol_encoder.h"
 
 namespace oceanbase
 {
@@ -58,6 +61,17 @@ void ObMicroBlockEncoder::free_encoder(ObIColumnEncoder *encoder)
   }
 }
 
+bool ObMicroBlockEncoder::is_encoding_supported(const ObColumnHeader::Type type) const
+{
+  bool supported = true;
+  if (ObColumnHeader::INTEGER_STRIDE_DIFF == type
+      || ObColumnHeader::FLOAT_DECIMAL == type
+      || ObColumnHeader::STRING_SYMBOL == type) {
+    supported = ctx_.major_working_cluster_version_ >= CLUSTER_VERSION_4_1_0_1;
+  }
+  return supported;
+}
+
 template <typename T>
 int ObMicroBlockEncoder::try_encoder(ObIColumnEncoder *&encoder, const int64_t column_index)
 {
@@ -70,7 +84,7 @@ int ObMicroBlockEncoder::try_encoder(ObIColumnEncoder *&encoder, const int64_t c
   } else if (OB_UNLIKELY(column_index < 0 || column_index > ctx_.column_cnt_)) {
     ret = OB_INVALID_ARGUMENT;
     LOG_WARN("invalid argument", K(ret), K(column_index));
-  } else if (ctx_.encoder_opt_.enable<T>()) {
+  } else if (ctx_.encoder_opt_.enable<T>() && is_encoding_supported(T::type_)) {
     T *e = alloc_encoder<T>();
     if (NULL == e) {
       ret = OB_ALLOCATE_MEMORY_FAILED;
@@ -1297,6 +1311,18 @@ int ObMicroBlockEncoder::try_encoder(ObIColumnEncoder *&e, const int64_t column_
               : try_span_column_encoder<ObInterColSubStrEncoder>(e, column_index);
         break;
       }
+      case ObColumnHeader::INTEGER_STRIDE_DIFF: {
+        ret = try_encoder<ObIntegerStrideDiffEncoder>(e, column_index);
+        break;
+      }
+      case ObColumnHeader::FLOAT_DECIMAL: {
+        ret = try_encoder<ObFloatDecimalEncoder>(e, column_index);
+        break;
+      }
+      case ObColumnHeader::STRING_SYMBOL: {
+        ret = try_encoder<ObStringSymbolEncoder>(e, column_index);
+        break;
+      }
       default:
         ret = OB_ERR_UNEXPECTED;
         LOG_WARN("unknown encoding type", K(ret), K(type));
@@ -1604,6 +1630,44 @@ int ObMicroBlockEncoder::choose_encoder(const int64_t column_idx,
       }
     }
 
+    // time series: monotonic integers with a regular step, decimal like float point numbers
+    if (OB_SUCC(ret) && try_more) {
+      if (!is_encoding_supported(ObIntegerStrideDiffEncoder::type_)
+          || !is_encoding_supported(ObFloatDecimalEncoder::type_)) {
+        // not readable by replicas of the older version until the upgrade finishes
+      } else if ((ObIntSC == sc || ObUIntSC == sc) && ObFloatTC != tc && ObDoubleTC != tc) {
+        if (cc.detected_encoders_[ObIntegerStrideDiffEncoder::type_]) {
+        } else if (OB_FAIL(try_encoder<ObIntegerStrideDiffEncoder>(e, column_idx))) {
+          LOG_WARN("try integer stride diff encoder failed", K(ret), K(column_idx));
+        } else if (NULL != e) {
+          int64_t size = e->calc_size();
+          if (size < choose->calc_size()) {
+            free_encoder(choose);
+            choose = e;
+            try_more = size <= acceptable_size;
+          } else {
+            free_encoder(e);
+            e = NULL;
+          }
+        }
+      } else if (ObFloatTC == tc || ObDoubleTC == tc) {
+        if (cc.detected_encoders_[ObFloatDecimalEncoder::type_]) {
+        } else if (OB_FAIL(try_encoder<ObFloatDecimalEncoder>(e, column_idx))) {
+          LOG_WARN("try float decimal encoder failed", K(ret), K(column_idx));
+        } else if (NULL != e) {
+          int64_t size = e->calc_size();
+          if (size < choose->calc_size()) {
+            free_encoder(choose);
+            choose = e;
+            try_more = size <= acceptable_size;
+          } else {
+            free_encoder(e);
+            e = NULL;
+          }
+        }
+      }
+    }
+
     bool string_diff_suitable = false;
     if (OB_SUCC(ret) && try_more) {
       if (is_string_encoding_valid(sc) && cc.fix_data_size_ > 0) {
@@ -1665,6 +1729,27 @@ int ObMicroBlockEncoder::choose_encoder(const int64_t column_idx,
       }
     }
 
+    // symbol table compression helps strings sharing substrings at any position, such as
+    // urls and log lines, which are neither sorted for string diff nor share one prefix
+    if (OB_SUCC(ret) && try_more) {
+      if (ObStringSC == sc && is_encoding_supported(ObStringSymbolEncoder::type_)) {
+        if (cc.detected_encoders_[ObStringSymbolEncoder::type_]) {
+        } else if (OB_FAIL(try_encoder<ObStringSymbolEncoder>(e, column_idx))) {
+          LOG_WARN("try string symbol encoder failed", K(ret), K(column_idx));
+        } else if (NULL != e) {
+          int64_t size = e->calc_size();
+          if (size < choose->calc_size()) {
+            free_encoder(choose);
+            choose = e;
+            try_more = size <= acceptable_size;
+          } else {
+            free_encoder(e);
+            e = NULL;
+          }
+        }
+      }
+    }
+
     if (OB_SUCC(ret)) {
       LOG_DEBUG("used encoder", K(column_idx),
           "column_header", choose->get_column_header(),
@@ -106,6 +106,9 @@ private:
   int choose_encoder(const int64_t column_idx, ObColumnEncodingCtx &column_ctx);
   void free_encoders();
 
+  // encodings added in 4.1.0.1 can't be decoded by replicas running an older version
+  bool is_encoding_supported(const ObColumnHeader::Type type) const;
+
   template <typename T>
   T *alloc_encoder();
   void free_encoder(ObIColumnEncoder *encoder);
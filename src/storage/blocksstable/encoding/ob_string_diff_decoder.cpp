@@ -256,5 +256,272 @@ int ObStringDiffDecoder::batch_decode(
   return ret;
 }
 
+/**
+ * Filter pushdown for string diff encoding. The bytes shared by all rows are stored once in
+ * the column meta, so they are either compared with the filter value once (EQ/NE on binary
+ * collation) or copied once into the buffer used to rebuild every row for other operators.
+ * Only the differing bytes of each row are read afterwards.
+ */
+int ObStringDiffDecoder::pushdown_operator(
+    const sql::ObPushdownFilterExecutor *parent,
+    const ObColumnDecoderCtx &col_ctx,
+    const sql::ObWhiteFilterExecutor &filter,
+    const char* meta_data,
+    const ObIRowIndex* row_index,
+    ObBitmap &result_bitmap) const
+{
+  UNUSED(meta_data);
+  int ret = OB_SUCCESS;
+  const sql::ObWhiteFilterOperatorType op_type = filter.get_op_type();
+  const unsigned char *col_data = reinterpret_cast<const unsigned char *>(header_)
+      + col_ctx.col_header_->length_;
+  if (OB_UNLIKELY(!is_inited())) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("StringDiff decoder not inited", K(ret), K(filter));
+  } else if (OB_UNLIKELY(nullptr == row_index
+                         || col_ctx.micro_block_header_->row_count_ != result_bitmap.size())) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("Invalid argument for pushdown operator", K(ret), KP(row_index),
+        K(result_bitmap.size()));
+  } else if (OB_UNLIKELY(op_type >= sql::WHITE_OP_MAX)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("Invalid op type for pushed down white filter", K(ret), K(op_type));
+  } else if (col_ctx.is_fix_length()) {
+    if (OB_FAIL(get_is_null_bitmap_from_fixed_column(col_ctx, col_data, result_bitmap))) {
+      LOG_WARN("Failed to get isnull bitmap from fixed column", K(ret), K(col_ctx));
+    }
+  } else if (OB_FAIL(get_is_null_bitmap_from_var_column(col_ctx, row_index, result_bitmap))) {
+    LOG_WARN("Failed to get isnull bitmap from var column", K(ret), K(col_ctx));
+  }
+
+  if (OB_SUCC(ret)) {
+    switch (op_type) {
+    case sql::WHITE_OP_NU: {
+      break;
+    }
+    case sql::WHITE_OP_NN: {
+      if (OB_FAIL(result_bitmap.bit_not())) {
+        LOG_WARN("Failed to flip bits for result bitmap",
+            K(ret), K(result_bitmap.size()));
+      }
+      break;
+    }
+    case sql::WHITE_OP_EQ:
+    case sql::WHITE_OP_NE:
+    case sql::WHITE_OP_GT:
+    case sql::WHITE_OP_GE:
+    case sql::WHITE_OP_LT:
+    case sql::WHITE_OP_LE:
+    case sql::WHITE_OP_BT:
+    case sql::WHITE_OP_IN: {
+      if (OB_UNLIKELY(filter.get_objs().count() == 0
+                      || (sql::WHITE_OP_BT == op_type && filter.get_objs().count() != 2))) {
+        ret = OB_INVALID_ARGUMENT;
+        LOG_WARN("Invalid filter params", K(ret), K(op_type), K(filter.get_objs()));
+      } else if (fast_filter_valid(col_ctx, filter)) {
+        if (OB_FAIL(equal_operator(parent, col_ctx, row_index, filter, result_bitmap))) {
+          LOG_WARN("Failed on equal operator", K(ret), K(col_ctx));
+        }
+      } else if (OB_FAIL(traverse_all_data(parent, col_ctx, row_index, filter, result_bitmap))) {
+        LOG_WARN("Failed to traverse all data in micro block", K(ret), K(col_ctx));
+      }
+      break;
+    }
+    default: {
+      ret = OB_NOT_SUPPORTED;
+      LOG_WARN("Not supported operation type", K(ret), K(op_type));
+    }
+    } // end of switch
+  }
+  return ret;
+}
+
+// Bytewise equality is only the same as the object comparison for binary collation on
+// types without padding semantics.
+bool ObStringDiffDecoder::fast_filter_valid(
+    const ObColumnDecoderCtx &col_ctx,
+    const sql::ObWhiteFilterExecutor &filter) const
+{
+  bool valid = false;
+  const sql::ObWhiteFilterOperatorType op_type = filter.get_op_type();
+  if ((sql::WHITE_OP_EQ == op_type || sql::WHITE_OP_NE == op_type)
+      && 1 == filter.get_objs().count()) {
+    const ObObj &ref_obj = filter.get_objs().at(0);
+    valid = CS_TYPE_BINARY == col_ctx.obj_meta_.get_collation_type()
+        && !col_ctx.obj_meta_.is_fixed_len_char_type()
+        && ref_obj.get_type() == col_ctx.obj_meta_.get_type()
+        && CS_TYPE_BINARY == ref_obj.get_collation_type();
+  }
+  return valid;
+}
+
+OB_INLINE int ObStringDiffDecoder::locate_cell(
+    const ObColumnDecoderCtx &col_ctx,
+    const ObIRowIndex *row_index,
+    const int64_t row_id,
+    const char *&cell_data) const
+{
+  int ret = OB_SUCCESS;
+  if (col_ctx.is_fix_length()) {
+    int64_t data_offset = 0;
+    if (col_ctx.has_extend_value()) {
+      data_offset = col_ctx.micro_block_header_->row_count_
+          * col_ctx.micro_block_header_->extend_value_bit_;
+      data_offset = (data_offset + CHAR_BIT - 1) / CHAR_BIT;
+    }
+    cell_data = reinterpret_cast<const char *>(header_) + col_ctx.col_header_->length_
+        + data_offset + row_id * header_->length_;
+  } else {
+    const char *row_data = nullptr;
+    int64_t row_len = 0;
+    int64_t cell_len = 0;
+    if (OB_FAIL(locate_row_data(col_ctx, row_index, row_id, row_data, row_len))) {
+      LOG_WARN("Failed to read data offset from row index", K(ret), K(row_id));
+    } else if (OB_FAIL(ObRawDecoder::locate_cell_data(cell_data, cell_len, row_data, row_len,
+        *col_ctx.micro_block_header_, *col_ctx.col_header_, *header_))) {
+      LOG_WARN("Failed to locate cell data", K(ret), K(row_id), K(col_ctx));
+    }
+  }
+  return ret;
+}
+
+int ObStringDiffDecoder::equal_operator(
+    const sql::ObPushdownFilterExecutor *parent,
+    const ObColumnDecoderCtx &col_ctx,
+    const ObIRowIndex* row_index,
+    const sql::ObWhiteFilterExecutor &filter,
+    ObBitmap &result_bitmap) const
+{
+  int ret = OB_SUCCESS;
+  const ObString value = filter.get_objs().at(0).get_string();
+  const bool is_ne = sql::WHITE_OP_NE == filter.get_op_type();
+  const bool null_value_contained = result_bitmap.popcnt() > 0;
+  // Rows can only be equal to the value if the shared bytes are
+  bool common_equal = value.length() == header_->string_size_;
+  int64_t ppos = 0;
+  int64_t fpos = 0;
+  for (int64_t i = 0; common_equal && i < header_->diff_desc_cnt_; ++i) {
+    const int64_t count = header_->diff_descs_[i].count_;
+    if (0 == header_->diff_descs_[i].diff_) {
+      common_equal = 0 == MEMCMP(header_->common_data() + ppos, value.ptr() + fpos, count);
+      ppos += count;
+    }
+    fpos += count;
+  }
+
+  const char *cell_data = nullptr;
+  for (int64_t row_id = 0;
+       OB_SUCC(ret) && row_id < col_ctx.micro_block_header_->row_count_;
+       ++row_id) {
+    bool equal = common_equal;
+    if (nullptr != parent && parent->can_skip_filter(row_id)) {
+      continue;
+    } else if (null_value_contained && result_bitmap.test(row_id)) {
+      if (OB_FAIL(result_bitmap.set(row_id, false))) {
+        LOG_WARN("Failed to set null value to false", K(ret), K(row_id));
+      }
+      continue;
+    } else if (!equal) {
+    } else if (OB_FAIL(locate_cell(col_ctx, row_index, row_id, cell_data))) {
+      LOG_WARN("Failed to locate cell", K(ret), K(row_id));
+    } else if (header_->is_hex_packing()) {
+      ObHexStringUnpacker unpacker(header_->hex_char_array(),
+          reinterpret_cast<const unsigned char *>(cell_data));
+      fpos = 0;
+      for (int64_t i = 0; equal && i < header_->diff_desc_cnt_; ++i) {
+        const int64_t count = header_->diff_descs_[i].count_;
+        if (0 != header_->diff_descs_[i].diff_) {
+          for (int64_t k = 0; equal && k < count; ++k) {
+            equal = static_cast<char>(unpacker.unpack()) == value.ptr()[fpos + k];
+          }
+        }
+        fpos += count;
+      }
+    } else {
+      ppos = 0;
+      fpos = 0;
+      for (int64_t i = 0; equal && i < header_->diff_desc_cnt_; ++i) {
+        const int64_t count = header_->diff_descs_[i].count_;
+        if (0 != header_->diff_descs_[i].diff_) {
+          equal = 0 == MEMCMP(cell_data + ppos, value.ptr() + fpos, count);
+          ppos += count;
+        }
+        fpos += count;
+      }
+    }
+    if (OB_SUCC(ret) && equal != is_ne) {
+      if (OB_FAIL(result_bitmap.set(row_id))) {
+        LOG_WARN("Failed to set result bitmap", K(ret), K(row_id));
+      }
+    }
+  }
+  return ret;
+}
+
+int ObStringDiffDecoder::traverse_all_data(
+    const sql::ObPushdownFilterExecutor *parent,
+    const ObColumnDecoderCtx &col_ctx,
+    const ObIRowIndex* row_index,
+    const sql::ObWhiteFilterExecutor &filter,
+    ObBitmap &result_bitmap) const
+{
+  int ret = OB_SUCCESS;
+  const static uint16_t min_buf_size = 128;
+  const int64_t buf_size = std::max(header_->string_size_, min_buf_size);
+  char *buf = nullptr;
+  if (OB_ISNULL(buf = static_cast<char *>(col_ctx.allocator_->alloc(buf_size)))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("Failed to allocate memory", K(ret), K(buf_size));
+  } else {
+    // shared bytes are filled once, each row only overwrites its differing bytes
+    header_->copy_string(ObStringDiffHeader::LeftToRight(), std::logical_not<uint8_t>(),
+        header_->common_data(), buf);
+    const bool null_value_contained = result_bitmap.popcnt() > 0;
+    const char *cell_data = nullptr;
+    ObObj cur_obj;
+    for (int64_t row_id = 0;
+         OB_SUCC(ret) && row_id < col_ctx.micro_block_header_->row_count_;
+         ++row_id) {
+      bool result = false;
+      if (nullptr != parent && parent->can_skip_filter(row_id)) {
+        continue;
+      } else if (null_value_contained && result_bitmap.test(row_id)) {
+        if (OB_FAIL(result_bitmap.set(row_id, false))) {
+          LOG_WARN("Failed to set null value to false", K(ret), K(row_id));
+        }
+      } else if (OB_FAIL(locate_cell(col_ctx, row_index, row_id, cell_data))) {
+        LOG_WARN("Failed to locate cell", K(ret), K(row_id));
+      } else {
+        if (header_->is_hex_packing()) {
+          ObHexStringUnpacker unpacker(header_->hex_char_array(),
+              reinterpret_cast<const unsigned char *>(cell_data));
+          header_->copy_hex_string(unpacker,
+              static_cast<void (ObHexStringUnpacker::*)(unsigned char &)>(&ObHexStringUnpacker::unpack),
+              reinterpret_cast<unsigned char *>(buf));
+        } else {
+          header_->copy_string(ObStringDiffHeader::LeftToRight(),
+              ObStringDiffHeader::LogicTrue<uint8_t>(), cell_data, buf);
+        }
+        cur_obj.copy_meta_type(col_ctx.obj_meta_);
+        cur_obj.v_.string_ = buf;
+        cur_obj.val_len_ = header_->string_size_;
+        if (cur_obj.is_fixed_len_char_type() && nullptr != col_ctx.col_param_) {
+          if (OB_FAIL(storage::pad_column(col_ctx.col_param_->get_accuracy(),
+                                          *col_ctx.allocator_, cur_obj))) {
+            LOG_WARN("Failed to pad column", K(ret));
+          }
+        }
+        if (OB_FAIL(ret)) {
+        } else if (OB_FAIL(evaluate_white_filter(cur_obj, filter, result))) {
+          LOG_WARN("Failed on trying to filter the row", K(ret), K(row_id), K(cur_obj));
+        } else if (result && OB_FAIL(result_bitmap.set(row_id))) {
+          LOG_WARN("Failed to set result bitmap", K(ret), K(row_id));
+        }
+      }
+    }
+  }
+  return ret;
+}
+
 } // end namespace blocksstable
 } // end namespace oceanbase
@@ -57,7 +57,39 @@ public:
   virtual ObColumnHeader::Type get_type() const { return type_; }
 
   bool is_inited() const { return NULL != header_; }
+
+  virtual int pushdown_operator(
+      const sql::ObPushdownFilterExecutor *parent,
+      const ObColumnDecoderCtx &col_ctx,
+      const sql::ObWhiteFilterExecutor &filter,
+      const char* meta_data,
+      const ObIRowIndex* row_index,
+      ObBitmap &result_bitmap) const override;
 private:
+  bool fast_filter_valid(
+      const ObColumnDecoderCtx &col_ctx,
+      const sql::ObWhiteFilterExecutor &filter) const;
+
+  int locate_cell(
+      const ObColumnDecoderCtx &col_ctx,
+      const ObIRowIndex *row_index,
+      const int64_t row_id,
+      const char *&cell_data) const;
+
+  int equal_operator(
+      const sql::ObPushdownFilterExecutor *parent,
+      const ObColumnDecoderCtx &col_ctx,
+      const ObIRowIndex* row_index,
+      const sql::ObWhiteFilterExecutor &filter,
+      ObBitmap &result_bitmap) const;
+
+  int traverse_all_data(
+      const sql::ObPushdownFilterExecutor *parent,
+      const ObColumnDecoderCtx &col_ctx,
+      const ObIRowIndex* row_index,
+      const sql::ObWhiteFilterExecutor &filter,
+      ObBitmap &result_bitmap) const;
+
   const ObStringDiffHeader *header_;
 };
 
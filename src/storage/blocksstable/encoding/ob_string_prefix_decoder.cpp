@@ -247,5 +247,283 @@ int ObStringPrefixDecoder::get_null_count(
   return ret;
 }
 
+/**
+ * Filter pushdown for string prefix encoding. Rows are evaluated from the encoded prefix
+ * reference and suffix without calling decode() per row, so no row data or bitstream is
+ * materialized outside of the micro block.
+ * EQ/NE on binary collation compares every shared prefix with the filter value at most once
+ * for the whole micro block, other operators rebuild the string into one reused buffer.
+ */
+int ObStringPrefixDecoder::pushdown_operator(
+    const sql::ObPushdownFilterExecutor *parent,
+    const ObColumnDecoderCtx &col_ctx,
+    const sql::ObWhiteFilterExecutor &filter,
+    const char* meta_data,
+    const ObIRowIndex* row_index,
+    ObBitmap &result_bitmap) const
+{
+  UNUSED(meta_data);
+  int ret = OB_SUCCESS;
+  const sql::ObWhiteFilterOperatorType op_type = filter.get_op_type();
+  if (OB_UNLIKELY(!is_inited())) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("StringPrefix decoder not inited", K(ret), K(filter));
+  } else if (OB_UNLIKELY(nullptr == row_index
+                         || col_ctx.micro_block_header_->row_count_ != result_bitmap.size())) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("Invalid argument for pushdown operator", K(ret), KP(row_index),
+        K(result_bitmap.size()));
+  } else if (OB_UNLIKELY(op_type >= sql::WHITE_OP_MAX)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("Invalid op type for pushed down white filter", K(ret), K(op_type));
+  } else if (OB_FAIL(get_is_null_bitmap_from_var_column(col_ctx, row_index, result_bitmap))) {
+    LOG_WARN("Failed to get isnull bitmap", K(ret), K(col_ctx));
+  } else {
+    switch (op_type) {
+    case sql::WHITE_OP_NU: {
+      break;
+    }
+    case sql::WHITE_OP_NN: {
+      if (OB_FAIL(result_bitmap.bit_not())) {
+        LOG_WARN("Failed to flip bits for result bitmap",
+            K(ret), K(result_bitmap.size()));
+      }
+      break;
+    }
+    case sql::WHITE_OP_EQ:
+    case sql::WHITE_OP_NE:
+    case sql::WHITE_OP_GT:
+    case sql::WHITE_OP_GE:
+    case sql::WHITE_OP_LT:
+    case sql::WHITE_OP_LE:
+    case sql::WHITE_OP_BT:
+    case sql::WHITE_OP_IN: {
+      if (OB_UNLIKELY(filter.get_objs().count() == 0
+                      || (sql::WHITE_OP_BT == op_type && filter.get_objs().count() != 2))) {
+        ret = OB_INVALID_ARGUMENT;
+        LOG_WARN("Invalid filter params", K(ret), K(op_type), K(filter.get_objs()));
+      } else if (fast_filter_valid(col_ctx, filter)) {
+        if (OB_FAIL(equal_operator(parent, col_ctx, row_index, filter, result_bitmap))) {
+          LOG_WARN("Failed on equal operator", K(ret), K(col_ctx));
+        }
+      } else if (OB_FAIL(traverse_all_data(parent, col_ctx, row_index, filter, result_bitmap))) {
+        LOG_WARN("Failed to traverse all data in micro block", K(ret), K(col_ctx));
+      }
+      break;
+    }
+    default: {
+      ret = OB_NOT_SUPPORTED;
+      LOG_WARN("Not supported operation type", K(ret), K(op_type));
+    }
+    } // end of switch
+  }
+  return ret;
+}
+
+// Bytewise equality is only the same as the object comparison for binary collation on
+// types without padding semantics.
+bool ObStringPrefixDecoder::fast_filter_valid(
+    const ObColumnDecoderCtx &col_ctx,
+    const sql::ObWhiteFilterExecutor &filter) const
+{
+  bool valid = false;
+  const sql::ObWhiteFilterOperatorType op_type = filter.get_op_type();
+  if ((sql::WHITE_OP_EQ == op_type || sql::WHITE_OP_NE == op_type)
+      && 1 == filter.get_objs().count()
+      && meta_header_->count_ <= MAX_PREFIX_COUNT) {
+    const ObObj &ref_obj = filter.get_objs().at(0);
+    valid = CS_TYPE_BINARY == col_ctx.obj_meta_.get_collation_type()
+        && !col_ctx.obj_meta_.is_fixed_len_char_type()
+        && ref_obj.get_type() == col_ctx.obj_meta_.get_type()
+        && CS_TYPE_BINARY == ref_obj.get_collation_type();
+  }
+  return valid;
+}
+
+OB_INLINE int ObStringPrefixDecoder::locate_string(
+    const ObColumnDecoderCtx &col_ctx,
+    const ObIRowIndex *row_index,
+    const ObIntegerArrayGenerator &meta_gen,
+    const int64_t row_id,
+    const ObStringPrefixCellHeader *&cell_header,
+    const char *&prefix_str,
+    const char *&suffix_data,
+    int64_t &suffix_len) const
+{
+  int ret = OB_SUCCESS;
+  const char *row_data = nullptr;
+  int64_t row_len = 0;
+  const char *cell_data = nullptr;
+  int64_t cell_len = 0;
+  if (OB_FAIL(locate_row_data(col_ctx, row_index, row_id, row_data, row_len))) {
+    LOG_WARN("Failed to locate row data", K(ret), K(row_id));
+  } else if (OB_FAIL(ObRawDecoder::locate_cell_data(cell_data, cell_len, row_data, row_len,
+      *col_ctx.micro_block_header_, *col_ctx.col_header_, *meta_header_))) {
+    LOG_WARN("Failed to locate cell data", K(ret), K(row_id), K(col_ctx));
+  } else {
+    cell_header = reinterpret_cast<const ObStringPrefixCellHeader *>(cell_data);
+    int64_t offset = 0;
+    if (0 != cell_header->get_ref()) {
+      offset = meta_gen.get_array().at(cell_header->get_ref() - 1);
+    }
+    prefix_str = meta_data_ + (meta_header_->count_ - 1) * meta_header_->prefix_index_byte_
+        + offset;
+    suffix_data = cell_data + sizeof(ObStringPrefixCellHeader);
+    suffix_len = cell_len - sizeof(ObStringPrefixCellHeader);
+    if (meta_header_->is_hex_packing()) {
+      suffix_len = suffix_len * 2 - cell_header->get_odd();
+    }
+  }
+  return ret;
+}
+
+int ObStringPrefixDecoder::equal_operator(
+    const sql::ObPushdownFilterExecutor *parent,
+    const ObColumnDecoderCtx &col_ctx,
+    const ObIRowIndex* row_index,
+    const sql::ObWhiteFilterExecutor &filter,
+    ObBitmap &result_bitmap) const
+{
+  int ret = OB_SUCCESS;
+  ObIntegerArrayGenerator meta_gen;
+  if (OB_FAIL(meta_gen.init(meta_data_, meta_header_->prefix_index_byte_))) {
+    LOG_WARN("Failed to init integer array generator", K(ret), KP_(meta_data),
+        "Prefix index byte", meta_header_->prefix_index_byte_);
+  } else {
+    const ObString value = filter.get_objs().at(0).get_string();
+    const bool is_ne = sql::WHITE_OP_NE == filter.get_op_type();
+    const bool null_value_contained = result_bitmap.popcnt() > 0;
+    // Per prefix: length already known equal to the filter value, and the first position
+    // known to differ from it. Prefix bytes are compared lazily and at most once.
+    int64_t matched_len[MAX_PREFIX_COUNT];
+    int64_t mismatch_pos[MAX_PREFIX_COUNT];
+    for (int64_t i = 0; i < MAX_PREFIX_COUNT; ++i) {
+      matched_len[i] = 0;
+      mismatch_pos[i] = INT64_MAX;
+    }
+    const ObStringPrefixCellHeader *cell_header = nullptr;
+    const char *prefix_str = nullptr;
+    const char *suffix_data = nullptr;
+    int64_t suffix_len = 0;
+    for (int64_t row_id = 0;
+         OB_SUCC(ret) && row_id < col_ctx.micro_block_header_->row_count_;
+         ++row_id) {
+      if (nullptr != parent && parent->can_skip_filter(row_id)) {
+        continue;
+      } else if (null_value_contained && result_bitmap.test(row_id)) {
+        if (OB_FAIL(result_bitmap.set(row_id, false))) {
+          LOG_WARN("Failed to set null value to false", K(ret), K(row_id));
+        }
+      } else if (OB_FAIL(locate_string(col_ctx, row_index, meta_gen, row_id,
+          cell_header, prefix_str, suffix_data, suffix_len))) {
+        LOG_WARN("Failed to locate string", K(ret), K(row_id));
+      } else {
+        const int64_t ref = cell_header->get_ref();
+        const int64_t prefix_len = cell_header->len_;
+        bool equal = (prefix_len + suffix_len == value.length());
+        if (!equal || prefix_len <= matched_len[ref]) {
+        } else if (mismatch_pos[ref] < prefix_len) {
+          equal = false;
+        } else {
+          int64_t pos = matched_len[ref];
+          while (pos < prefix_len && prefix_str[pos] == value.ptr()[pos]) {
+            ++pos;
+          }
+          matched_len[ref] = pos;
+          if (pos < prefix_len) {
+            mismatch_pos[ref] = pos;
+            equal = false;
+          }
+        }
+        if (!equal) {
+        } else if (meta_header_->is_hex_packing()) {
+          ObHexStringUnpacker unpacker(meta_header_->hex_char_array_,
+              reinterpret_cast<const unsigned char *>(suffix_data));
+          for (int64_t i = prefix_len; equal && i < value.length(); ++i) {
+            equal = static_cast<char>(unpacker.unpack()) == value.ptr()[i];
+          }
+        } else {
+          equal = 0 == MEMCMP(suffix_data, value.ptr() + prefix_len, suffix_len);
+        }
+        if (equal != is_ne) {
+          if (OB_FAIL(result_bitmap.set(row_id))) {
+            LOG_WARN("Failed to set result bitmap", K(ret), K(row_id));
+          }
+        }
+      }
+    }
+  }
+  return ret;
+}
+
+int ObStringPrefixDecoder::traverse_all_data(
+    const sql::ObPushdownFilterExecutor *parent,
+    const ObColumnDecoderCtx &col_ctx,
+    const ObIRowIndex* row_index,
+    const sql::ObWhiteFilterExecutor &filter,
+    ObBitmap &result_bitmap) const
+{
+  int ret = OB_SUCCESS;
+  ObIntegerArrayGenerator meta_gen;
+  char *buf = nullptr;
+  const static uint32_t min_buf_size = 128;
+  const int64_t buf_size = std::max(meta_header_->max_string_size_, min_buf_size);
+  if (OB_FAIL(meta_gen.init(meta_data_, meta_header_->prefix_index_byte_))) {
+    LOG_WARN("Failed to init integer array generator", K(ret), KP_(meta_data),
+        "Prefix index byte", meta_header_->prefix_index_byte_);
+  } else if (OB_ISNULL(buf = static_cast<char *>(col_ctx.allocator_->alloc(buf_size)))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("Failed to allocate memory", K(ret), K(buf_size));
+  } else {
+    const bool null_value_contained = result_bitmap.popcnt() > 0;
+    ObObj cur_obj;
+    const ObStringPrefixCellHeader *cell_header = nullptr;
+    const char *prefix_str = nullptr;
+    const char *suffix_data = nullptr;
+    int64_t suffix_len = 0;
+    for (int64_t row_id = 0;
+         OB_SUCC(ret) && row_id < col_ctx.micro_block_header_->row_count_;
+         ++row_id) {
+      bool result = false;
+      if (nullptr != parent && parent->can_skip_filter(row_id)) {
+        continue;
+      } else if (null_value_contained && result_bitmap.test(row_id)) {
+        if (OB_FAIL(result_bitmap.set(row_id, false))) {
+          LOG_WARN("Failed to set null value to false", K(ret), K(row_id));
+        }
+      } else if (OB_FAIL(locate_string(col_ctx, row_index, meta_gen, row_id,
+          cell_header, prefix_str, suffix_data, suffix_len))) {
+        LOG_WARN("Failed to locate string", K(ret), K(row_id));
+      } else {
+        const int64_t prefix_len = cell_header->len_;
+        MEMCPY(buf, prefix_str, prefix_len);
+        if (meta_header_->is_hex_packing()) {
+          ObHexStringUnpacker unpacker(meta_header_->hex_char_array_,
+              reinterpret_cast<const unsigned char *>(suffix_data));
+          unpacker.unpack(reinterpret_cast<unsigned char *>(buf + prefix_len), suffix_len);
+        } else {
+          MEMCPY(buf + prefix_len, suffix_data, suffix_len);
+        }
+        cur_obj.copy_meta_type(col_ctx.obj_meta_);
+        cur_obj.v_.string_ = buf;
+        cur_obj.val_len_ = static_cast<int32_t>(prefix_len + suffix_len);
+        if (cur_obj.is_fixed_len_char_type() && nullptr != col_ctx.col_param_) {
+          if (OB_FAIL(storage::pad_column(col_ctx.col_param_->get_accuracy(),
+                                          *col_ctx.allocator_, cur_obj))) {
+            LOG_WARN("Failed to pad column", K(ret));
+          }
+        }
+        if (OB_FAIL(ret)) {
+        } else if (OB_FAIL(evaluate_white_filter(cur_obj, filter, result))) {
+          LOG_WARN("Failed on trying to filter the row", K(ret), K(row_id), K(cur_obj));
+        } else if (result && OB_FAIL(result_bitmap.set(row_id))) {
+          LOG_WARN("Failed to set result bitmap", K(ret), K(row_id));
+        }
+      }
+    }
+  }
+  return ret;
+}
+
 } // end namespace blocksstable
 } // end namespace oceanbase
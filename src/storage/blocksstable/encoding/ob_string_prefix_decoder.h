@@ -17,6 +17,7 @@
 #include "ob_encoding_util.h"
 #include "storage/blocksstable/ob_data_buffer.h"
 #include "ob_string_prefix_encoder.h"
+#include "ob_integer_array.h"
 
 namespace oceanbase
 {
@@ -62,7 +63,45 @@ public:
       const int64_t *row_ids,
       const int64_t row_cap,
       int64_t &null_count) const override;
+
+  virtual int pushdown_operator(
+      const sql::ObPushdownFilterExecutor *parent,
+      const ObColumnDecoderCtx &col_ctx,
+      const sql::ObWhiteFilterExecutor &filter,
+      const char* meta_data,
+      const ObIRowIndex* row_index,
+      ObBitmap &result_bitmap) const override;
 private:
+  static const int64_t MAX_PREFIX_COUNT = ObStringPrefixCellHeader::REF_ODD_MASK + 1;
+
+  bool fast_filter_valid(
+      const ObColumnDecoderCtx &col_ctx,
+      const sql::ObWhiteFilterExecutor &filter) const;
+
+  int locate_string(
+      const ObColumnDecoderCtx &col_ctx,
+      const ObIRowIndex *row_index,
+      const ObIntegerArrayGenerator &meta_gen,
+      const int64_t row_id,
+      const ObStringPrefixCellHeader *&cell_header,
+      const char *&prefix_str,
+      const char *&suffix_data,
+      int64_t &suffix_len) const;
+
+  int equal_operator(
+      const sql::ObPushdownFilterExecutor *parent,
+      const ObColumnDecoderCtx &col_ctx,
+      const ObIRowIndex* row_index,
+      const sql::ObWhiteFilterExecutor &filter,
+      ObBitmap &result_bitmap) const;
+
+  int traverse_all_data(
+      const sql::ObPushdownFilterExecutor *parent,
+      const ObColumnDecoderCtx &col_ctx,
+      const ObIRowIndex* row_index,
+      const sql::ObWhiteFilterExecutor &filter,
+      ObBitmap &result_bitmap) const;
+
   const ObStringPrefixMetaHeader *meta_header_;
   const char *meta_data_;
 };
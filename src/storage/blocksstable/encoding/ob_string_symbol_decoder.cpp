@@ -0,0 +1,358 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX STORAGE
+
+#include "ob_string_symbol_decoder.h"
+
+#include "storage/blocksstable/ob_block_sstable_struct.h"
+#include "ob_bit_stream.h"
+#include "ob_raw_decoder.h"
+
+namespace oceanbase
+{
+namespace blocksstable
+{
+using namespace common;
+const ObColumnHeader::Type ObStringSymbolDecoder::type_;
+
+int ObStringSymbolDecoder::decode(ObColumnDecoderCtx &ctx, common::ObObj &cell,
+    const int64_t row_id, const ObBitStream &bs, const char *data, const int64_t len) const
+{
+  UNUSED(row_id);
+  int ret = OB_SUCCESS;
+  uint64_t val = STORED_NOT_EXT;
+  if (OB_UNLIKELY(!is_inited())) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("not init", K(ret));
+  } else if (OB_UNLIKELY(NULL == data || len < 0)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid argument", K(ret), KP(data), K(len));
+  } else if (ctx.has_extend_value()
+      && OB_FAIL(bs.get(ctx.col_header_->extend_value_index_,
+          ctx.micro_block_header_->extend_value_bit_, val))) {
+    LOG_WARN("get extend value failed", K(ret), K(bs), K(ctx));
+  } else if (STORED_NOT_EXT != val) {
+    set_stored_ext_value(cell, static_cast<ObStoredExtValue>(val));
+  } else {
+    if (cell.get_meta() != ctx.obj_meta_) {
+      cell.set_meta_type(ctx.obj_meta_);
+    }
+    const char *cell_data = NULL;
+    int64_t cell_len = 0;
+    char *buf = NULL;
+    if (OB_FAIL(ObRawDecoder::locate_cell_data(cell_data, cell_len, data, len,
+        *ctx.micro_block_header_, *ctx.col_header_, *header_))) {
+      LOG_WARN("locate cell data failed", K(ret), K(len), K(ctx), "header", *header_);
+    } else if (OB_ISNULL(buf = static_cast<char *>(ctx.allocator_->alloc(get_buf_size())))) {
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+      LOG_WARN("fail to allocate memory", K(ret), "buf_size", get_buf_size());
+    } else {
+      cell.val_len_ = static_cast<int32_t>(header_->decompress(
+          reinterpret_cast<const unsigned char *>(cell_data), cell_len, buf));
+      cell.v_.string_ = buf;
+    }
+  }
+  return ret;
+}
+
+int ObStringSymbolDecoder::update_pointer(const char *old_block, const char *cur_block)
+{
+  int ret = OB_SUCCESS;
+  if (!is_inited()) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("not init", K(ret));
+  } else if (OB_ISNULL(old_block) || OB_ISNULL(cur_block)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid argument", K(ret), KP(old_block), KP(cur_block));
+  } else {
+    ObIColumnDecoder::update_pointer(header_, old_block, cur_block);
+  }
+  return ret;
+}
+
+// Internal call, not check parameters for performance
+int ObStringSymbolDecoder::batch_decode(
+    const ObColumnDecoderCtx &ctx,
+    const ObIRowIndex* row_index,
+    const int64_t *row_ids,
+    const char **cell_datas,
+    const int64_t row_cap,
+    common::ObDatum *datums) const
+{
+  UNUSED(cell_datas);
+  int ret = OB_SUCCESS;
+  char *buf = nullptr;
+  const int64_t buf_size = get_buf_size();
+  if (OB_UNLIKELY(!is_inited())) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("Not inited", K(ret));
+  } else if (ctx.has_extend_value()
+      && OB_FAIL(set_null_datums_from_var_column(ctx, row_index, row_ids, row_cap, datums))) {
+    LOG_WARN("Failed to set null datums from var data", K(ret), K(ctx));
+  } else if (OB_ISNULL(buf = static_cast<char *>(ctx.allocator_->alloc(buf_size * row_cap)))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("Failed to allocate memory", K(ret), K(buf_size), K(row_cap));
+  } else {
+    const char *codes = nullptr;
+    int64_t code_len = 0;
+    for (int64_t i = 0; OB_SUCC(ret) && i < row_cap; ++i) {
+      if (ctx.has_extend_value() && datums[i].is_null()) {
+        // Skip
+      } else if (OB_FAIL(locate_codes(ctx, row_index, row_ids[i], codes, code_len))) {
+        LOG_WARN("Failed to locate codes", K(ret), K(i), K(row_ids[i]));
+      } else {
+        char *string = buf + i * buf_size;
+        datums[i].pack_ = static_cast<uint32_t>(header_->decompress(
+            reinterpret_cast<const unsigned char *>(codes), code_len, string));
+        datums[i].ptr_ = string;
+      }
+    }
+  }
+  return ret;
+}
+
+int ObStringSymbolDecoder::get_null_count(
+    const ObColumnDecoderCtx &ctx,
+    const ObIRowIndex *row_index,
+    const int64_t *row_ids,
+    const int64_t row_cap,
+    int64_t &null_count) const
+{
+  int ret = OB_SUCCESS;
+  const char *col_data = reinterpret_cast<const char *>(header_) + ctx.col_header_->length_;
+  if (OB_UNLIKELY(!is_inited())) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("String symbol decoder is not inited", K(ret));
+  } else if (OB_FAIL(ObIColumnDecoder::get_null_count_from_extend_value(
+      ctx, row_index, row_ids, row_cap, col_data, null_count))) {
+    LOG_WARN("Failed to get null count", K(ctx), K(ret));
+  }
+  return ret;
+}
+
+OB_INLINE int ObStringSymbolDecoder::locate_codes(
+    const ObColumnDecoderCtx &col_ctx,
+    const ObIRowIndex *row_index,
+    const int64_t row_id,
+    const char *&codes,
+    int64_t &code_len) const
+{
+  int ret = OB_SUCCESS;
+  const char *row_data = nullptr;
+  int64_t row_len = 0;
+  if (OB_FAIL(locate_row_data(col_ctx, row_index, row_id, row_data, row_len))) {
+    LOG_WARN("Failed to locate row data", K(ret), K(row_id));
+  } else if (OB_FAIL(ObRawDecoder::locate_cell_data(codes, code_len, row_data, row_len,
+      *col_ctx.micro_block_header_, *col_ctx.col_header_, *header_))) {
+    LOG_WARN("Failed to locate cell data", K(ret), K(row_id), K(col_ctx));
+  }
+  return ret;
+}
+
+/**
+ * Filter pushdown for string symbol encoding. Every row is compressed by the same symbol table
+ * greedily, so two strings are equal if and only if their codes are equal.
+ * EQ/NE on binary collation compress the filter value once and compare codes of each row
+ * without decompression, other operators decompress rows into one reused buffer.
+ * Prefix match is not a white filter operator and goes through the black filter path.
+ */
+int ObStringSymbolDecoder::pushdown_operator(
+    const sql::ObPushdownFilterExecutor *parent,
+    const ObColumnDecoderCtx &col_ctx,
+    const sql::ObWhiteFilterExecutor &filter,
+    const char* meta_data,
+    const ObIRowIndex* row_index,
+    ObBitmap &result_bitmap) const
+{
+  UNUSED(meta_data);
+  int ret = OB_SUCCESS;
+  const sql::ObWhiteFilterOperatorType op_type = filter.get_op_type();
+  if (OB_UNLIKELY(!is_inited())) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("String symbol decoder not inited", K(ret), K(filter));
+  } else if (OB_UNLIKELY(nullptr == row_index
+                         || col_ctx.micro_block_header_->row_count_ != result_bitmap.size())) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("Invalid argument for pushdown operator", K(ret), KP(row_index),
+        K(result_bitmap.size()));
+  } else if (OB_UNLIKELY(op_type >= sql::WHITE_OP_MAX)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("Invalid op type for pushed down white filter", K(ret), K(op_type));
+  } else if (OB_FAIL(get_is_null_bitmap_from_var_column(col_ctx, row_index, result_bitmap))) {
+    LOG_WARN("Failed to get isnull bitmap", K(ret), K(col_ctx));
+  } else {
+    switch (op_type) {
+    case sql::WHITE_OP_NU: {
+      break;
+    }
+    case sql::WHITE_OP_NN: {
+      if (OB_FAIL(result_bitmap.bit_not())) {
+        LOG_WARN("Failed to flip bits for result bitmap",
+            K(ret), K(result_bitmap.size()));
+      }
+      break;
+    }
+    case sql::WHITE_OP_EQ:
+    case sql::WHITE_OP_NE:
+    case sql::WHITE_OP_GT:
+    case sql::WHITE_OP_GE:
+    case sql::WHITE_OP_LT:
+    case sql::WHITE_OP_LE:
+    case sql::WHITE_OP_BT:
+    case sql::WHITE_OP_IN: {
+      if (OB_UNLIKELY(filter.get_objs().count() == 0
+                      || (sql::WHITE_OP_BT == op_type && filter.get_objs().count() != 2))) {
+        ret = OB_INVALID_ARGUMENT;
+        LOG_WARN("Invalid filter params", K(ret), K(op_type), K(filter.get_objs()));
+      } else if (fast_filter_valid(col_ctx, filter)) {
+        if (OB_FAIL(equal_operator(parent, col_ctx, row_index, filter, result_bitmap))) {
+          LOG_WARN("Failed on equal operator", K(ret), K(col_ctx));
+        }
+      } else if (OB_FAIL(traverse_all_data(parent, col_ctx, row_index, filter, result_bitmap))) {
+        LOG_WARN("Failed to traverse all data in micro block", K(ret), K(col_ctx));
+      }
+      break;
+    }
+    default: {
+      ret = OB_NOT_SUPPORTED;
+      LOG_WARN("Not supported operation type", K(ret), K(op_type));
+    }
+    } // end of switch
+  }
+  return ret;
+}
+
+// Bytewise equality is only the same as the object comparison for binary collation on
+// types without padding semantics.
+bool ObStringSymbolDecoder::fast_filter_valid(
+    const ObColumnDecoderCtx &col_ctx,
+    const sql::ObWhiteFilterExecutor &filter) const
+{
+  bool valid = false;
+  const sql::ObWhiteFilterOperatorType op_type = filter.get_op_type();
+  if ((sql::WHITE_OP_EQ == op_type || sql::WHITE_OP_NE == op_type)
+      && 1 == filter.get_objs().count()) {
+    const ObObj &ref_obj = filter.get_objs().at(0);
+    valid = CS_TYPE_BINARY == col_ctx.obj_meta_.get_collation_type()
+        && !col_ctx.obj_meta_.is_fixed_len_char_type()
+        && ref_obj.get_type() == col_ctx.obj_meta_.get_type()
+        && CS_TYPE_BINARY == ref_obj.get_collation_type();
+  }
+  return valid;
+}
+
+int ObStringSymbolDecoder::equal_operator(
+    const sql::ObPushdownFilterExecutor *parent,
+    const ObColumnDecoderCtx &col_ctx,
+    const ObIRowIndex* row_index,
+    const sql::ObWhiteFilterExecutor &filter,
+    ObBitmap &result_bitmap) const
+{
+  int ret = OB_SUCCESS;
+  const ObString value = filter.get_objs().at(0).get_string();
+  void *table_buf = nullptr;
+  unsigned char *ref_codes = nullptr;
+  if (OB_ISNULL(table_buf = col_ctx.allocator_->alloc(sizeof(ObStringSymbolTable)))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("Failed to allocate symbol table", K(ret));
+  } else if (OB_ISNULL(ref_codes = static_cast<unsigned char *>(
+      col_ctx.allocator_->alloc(value.length() * 2 + 1)))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("Failed to allocate memory", K(ret), K(value));
+  } else {
+    ObStringSymbolTable *table = new (table_buf) ObStringSymbolTable();
+    table->build(*header_);
+    const int64_t ref_len = table->compress(value.ptr(), value.length(), ref_codes);
+    const bool is_ne = sql::WHITE_OP_NE == filter.get_op_type();
+    const bool null_value_contained = result_bitmap.popcnt() > 0;
+    const char *codes = nullptr;
+    int64_t code_len = 0;
+    for (int64_t row_id = 0;
+         OB_SUCC(ret) && row_id < col_ctx.micro_block_header_->row_count_;
+         ++row_id) {
+      if (nullptr != parent && parent->can_skip_filter(row_id)) {
+        continue;
+      } else if (null_value_contained && result_bitmap.test(row_id)) {
+        if (OB_FAIL(result_bitmap.set(row_id, false))) {
+          LOG_WARN("Failed to set null value to false", K(ret), K(row_id));
+        }
+      } else if (OB_FAIL(locate_codes(col_ctx, row_index, row_id, codes, code_len))) {
+        LOG_WARN("Failed to locate codes", K(ret), K(row_id));
+      } else {
+        const bool equal = code_len == ref_len && 0 == MEMCMP(codes, ref_codes, ref_len);
+        if (equal != is_ne) {
+          if (OB_FAIL(result_bitmap.set(row_id))) {
+            LOG_WARN("Failed to set result bitmap", K(ret), K(row_id));
+          }
+        }
+      }
+    }
+    table->~ObStringSymbolTable();
+  }
+  return ret;
+}
+
+int ObStringSymbolDecoder::traverse_all_data(
+    const sql::ObPushdownFilterExecutor *parent,
+    const ObColumnDecoderCtx &col_ctx,
+    const ObIRowIndex* row_index,
+    const sql::ObWhiteFilterExecutor &filter,
+    ObBitmap &result_bitmap) const
+{
+  int ret = OB_SUCCESS;
+  char *buf = nullptr;
+  if (OB_ISNULL(buf = static_cast<char *>(col_ctx.allocator_->alloc(get_buf_size())))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("Failed to allocate memory", K(ret), "buf_size", get_buf_size());
+  } else {
+    const bool null_value_contained = result_bitmap.popcnt() > 0;
+    ObObj cur_obj;
+    const char *codes = nullptr;
+    int64_t code_len = 0;
+    for (int64_t row_id = 0;
+         OB_SUCC(ret) && row_id < col_ctx.micro_block_header_->row_count_;
+         ++row_id) {
+      bool result = false;
+      if (nullptr != parent && parent->can_skip_filter(row_id)) {
+        continue;
+      } else if (null_value_contained && result_bitmap.test(row_id)) {
+        if (OB_FAIL(result_bitmap.set(row_id, false))) {
+          LOG_WARN("Failed to set null value to false", K(ret), K(row_id));
+        }
+      } else if (OB_FAIL(locate_codes(col_ctx, row_index, row_id, codes, code_len))) {
+        LOG_WARN("Failed to locate codes", K(ret), K(row_id));
+      } else {
+        cur_obj.copy_meta_type(col_ctx.obj_meta_);
+        cur_obj.v_.string_ = buf;
+        cur_obj.val_len_ = static_cast<int32_t>(header_->decompress(
+            reinterpret_cast<const unsigned char *>(codes), code_len, buf));
+        if (cur_obj.is_fixed_len_char_type() && nullptr != col_ctx.col_param_) {
+          if (OB_FAIL(storage::pad_column(col_ctx.col_param_->get_accuracy(),
+                                          *col_ctx.allocator_, cur_obj))) {
+            LOG_WARN("Failed to pad column", K(ret));
+          }
+        }
+        if (OB_FAIL(ret)) {
+        } else if (OB_FAIL(evaluate_white_filter(cur_obj, filter, result))) {
+          LOG_WARN("Failed on trying to filter the row", K(ret), K(row_id), K(cur_obj));
+        } else if (result && OB_FAIL(result_bitmap.set(row_id))) {
+          LOG_WARN("Failed to set result bitmap", K(ret), K(row_id));
+        }
+      }
+    }
+  }
+  return ret;
+}
+
+} // end namespace blocksstable
+} // end namespace oceanbase
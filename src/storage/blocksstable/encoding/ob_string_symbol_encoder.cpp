@@ -0,0 +1,442 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX STORAGE
+
+#include "ob_string_symbol_encoder.h"
+
+#include <algorithm>
+#include "storage/blocksstable/ob_data_buffer.h"
+#include "ob_bit_stream.h"
+
+namespace oceanbase
+{
+namespace blocksstable
+{
+using namespace common;
+
+void ObStringSymbolTable::reset()
+{
+  symbol_cnt_ = 0;
+  MEMSET(max_lens_, 0, sizeof(max_lens_));
+  MEMSET(slots_, 0, sizeof(slots_));
+}
+
+bool ObStringSymbolTable::add(const uint64_t symbol, const int64_t len)
+{
+  bool added = false;
+  if (symbol_cnt_ < ObStringSymbolHeader::MAX_SYMBOL_CNT
+      && len > 0 && len <= ObStringSymbolHeader::MAX_SYMBOL_LEN) {
+    int64_t pos = hash(symbol, len);
+    while (0 != slots_[pos].len_) {
+      pos = (pos + 1) & (SLOT_CNT - 1);
+    }
+    slots_[pos].symbol_ = symbol;
+    slots_[pos].len_ = static_cast<uint8_t>(len);
+    slots_[pos].code_ = static_cast<uint8_t>(symbol_cnt_);
+    symbols_[symbol_cnt_] = symbol;
+    lens_[symbol_cnt_] = static_cast<uint8_t>(len);
+    // symbol is loaded in memory order, the lowest byte is the first character
+    const uint8_t first = static_cast<uint8_t>(symbol & 0xFF);
+    max_lens_[first] = std::max(max_lens_[first], static_cast<uint8_t>(len));
+    ++symbol_cnt_;
+    added = true;
+  }
+  return added;
+}
+
+void ObStringSymbolTable::build(const ObStringSymbolHeader &header)
+{
+  reset();
+  const char *syms = header.symbols();
+  const uint8_t *lens = header.symbol_lens();
+  for (int64_t i = 0; i < header.symbol_cnt_; ++i) {
+    uint64_t symbol = 0;
+    MEMCPY(&symbol, syms + i * sizeof(uint64_t), sizeof(uint64_t));
+    add(symbol, lens[i]);
+  }
+}
+
+int64_t ObStringSymbolTable::compress(
+    const char *str, const int64_t len, unsigned char *out) const
+{
+  const unsigned char *s = reinterpret_cast<const unsigned char *>(str);
+  unsigned char *p = out;
+  uint8_t code = 0;
+  for (int64_t pos = 0; pos < len;) {
+    const int64_t matched = find(s + pos, len - pos, code);
+    if (matched > 0) {
+      *p++ = code;
+      pos += matched;
+    } else {
+      *p++ = ObStringSymbolHeader::ESCAPE_CODE;
+      *p++ = s[pos++];
+    }
+  }
+  return p - out;
+}
+
+int64_t ObStringSymbolTable::compressed_length(const char *str, const int64_t len) const
+{
+  const unsigned char *s = reinterpret_cast<const unsigned char *>(str);
+  int64_t length = 0;
+  uint8_t code = 0;
+  for (int64_t pos = 0; pos < len;) {
+    const int64_t matched = find(s + pos, len - pos, code);
+    if (matched > 0) {
+      length += 1;
+      pos += matched;
+    } else {
+      length += 2;
+      pos += 1;
+    }
+  }
+  return length;
+}
+
+void ObStringSymbolTable::store(ObStringSymbolHeader &header) const
+{
+  header.symbol_cnt_ = static_cast<uint8_t>(symbol_cnt_);
+  MEMCPY(header.payload_, symbols_, symbol_cnt_ * sizeof(uint64_t));
+  MEMCPY(header.payload_ + symbol_cnt_ * sizeof(uint64_t), lens_, symbol_cnt_);
+}
+
+// Open addressing counter of symbol candidates, new candidates are dropped when half full.
+struct ObStringSymbolEncoder::CandidateSet
+{
+  struct Candidate
+  {
+    uint64_t symbol_;
+    int64_t len_;
+    int64_t cnt_;
+    OB_INLINE int64_t gain() const { return cnt_ * len_; }
+  };
+
+  struct GainCmp
+  {
+    bool operator()(const Candidate *l, const Candidate *r) const
+    {
+      // break ties on symbol to keep the table stable for the same input
+      return l->gain() > r->gain()
+          || (l->gain() == r->gain() && (l->len_ > r->len_
+          || (l->len_ == r->len_ && l->symbol_ < r->symbol_)));
+    }
+  };
+
+  CandidateSet() : slots_(NULL), sorted_(NULL), cnt_(0) {}
+
+  void reuse()
+  {
+    MEMSET(slots_, 0, sizeof(Candidate) * CANDIDATE_SLOT_CNT);
+    cnt_ = 0;
+  }
+
+  OB_INLINE void add(const uint64_t symbol, const int64_t len)
+  {
+    int64_t pos = static_cast<int64_t>(((symbol * 0x9E3779B97F4A7C15UL) >> 32) + len)
+        & (CANDIDATE_SLOT_CNT - 1);
+    while (0 != slots_[pos].len_
+        && (slots_[pos].len_ != len || slots_[pos].symbol_ != symbol)) {
+      pos = (pos + 1) & (CANDIDATE_SLOT_CNT - 1);
+    }
+    if (0 != slots_[pos].len_) {
+      slots_[pos].cnt_++;
+    } else if (cnt_ < CANDIDATE_SLOT_CNT / 2) {
+      slots_[pos].symbol_ = symbol;
+      slots_[pos].len_ = len;
+      slots_[pos].cnt_ = 1;
+      sorted_[cnt_++] = &slots_[pos];
+    }
+  }
+
+  Candidate *slots_;
+  Candidate **sorted_;
+  int64_t cnt_;
+};
+
+const ObColumnHeader::Type ObStringSymbolEncoder::type_;
+
+ObStringSymbolEncoder::ObStringSymbolEncoder()
+  : raw_size_(0), compressed_size_(0), null_cnt_(0), nope_cnt_(0),
+    var_lengths_(NULL), header_(NULL), symbol_table_(),
+    allocator_(blocksstable::OB_ENCODING_LABEL_STRING_SYMBOL)
+{
+}
+
+int ObStringSymbolEncoder::init(
+    const ObColumnEncodingCtx &ctx,
+    const int64_t column_index,
+    const ObConstDatumRowArray &rows)
+{
+  int ret = OB_SUCCESS;
+  if (IS_INIT) {
+    ret = OB_INIT_TWICE;
+    LOG_WARN("init twice", K(ret));
+  } else if (OB_FAIL(ObIColumnEncoder::init(ctx, column_index, rows))) {
+    LOG_WARN("init base column encoder failed",
+        K(ret), K(ctx), K(column_index), "row count", rows.count());
+  } else {
+    column_header_.type_ = type_;
+    const ObObjTypeStoreClass sc = get_store_class_map()[
+        ob_obj_type_class(column_type_.get_type())];
+    // text and json may carry lob locator, only compress plain strings
+    if (ObStringSC != sc) {
+      ret = OB_NOT_SUPPORTED;
+      LOG_WARN("not supported type for string symbol", K(ret), K(sc), K_(column_index));
+    }
+  }
+  return ret;
+}
+
+void ObStringSymbolEncoder::reuse()
+{
+  ObIColumnEncoder::reuse();
+  raw_size_ = 0;
+  compressed_size_ = 0;
+  null_cnt_ = 0;
+  nope_cnt_ = 0;
+  var_lengths_ = NULL;
+  header_ = NULL;
+  symbol_table_.reset();
+  allocator_.reuse();
+}
+
+void ObStringSymbolEncoder::count_candidates(
+    CandidateSet &candidates, const ObDatum &datum) const
+{
+  const unsigned char *str = reinterpret_cast<const unsigned char *>(datum.ptr_);
+  const int64_t len = datum.len_;
+  int64_t prev_len = 0;
+  uint8_t code = 0;
+  for (int64_t pos = 0; pos < len;) {
+    int64_t cur_len = symbol_table_.find(str + pos, len - pos, code);
+    if (0 == cur_len) {
+      // escaped byte is a candidate of its own
+      cur_len = 1;
+    }
+    candidates.add(ObStringSymbolTable::load(str + pos, cur_len), cur_len);
+    if (prev_len > 0 && prev_len + cur_len <= ObStringSymbolHeader::MAX_SYMBOL_LEN) {
+      candidates.add(ObStringSymbolTable::load(str + pos - prev_len, prev_len + cur_len),
+          prev_len + cur_len);
+    }
+    prev_len = cur_len;
+    pos += cur_len;
+  }
+}
+
+// Build the symbol table in a few generations like FSST: compress a sample with the table of
+// last generation, count every matched symbol and every concatenation of two neighbouring
+// symbols, then keep the candidates saving the most bytes.
+int ObStringSymbolEncoder::build_symbol_table()
+{
+  int ret = OB_SUCCESS;
+  CandidateSet candidates;
+  const ObColDatums &datums = *ctx_->col_datums_;
+  symbol_table_.reset();
+  if (OB_ISNULL(candidates.slots_ = static_cast<CandidateSet::Candidate *>(
+      allocator_.alloc(sizeof(CandidateSet::Candidate) * CANDIDATE_SLOT_CNT)))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("alloc candidate slots failed", K(ret));
+  } else if (OB_ISNULL(candidates.sorted_ = static_cast<CandidateSet::Candidate **>(
+      allocator_.alloc(sizeof(CandidateSet::Candidate *) * CANDIDATE_SLOT_CNT)))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("alloc sorted candidates failed", K(ret));
+  } else {
+    // sample rows evenly over the micro block
+    const int64_t step = std::max(1L, raw_size_ / MAX_SAMPLE_SIZE);
+    for (int64_t gen = 0; gen < MAX_GENERATION; ++gen) {
+      candidates.reuse();
+      for (int64_t i = 0; i < datums.count(); i += step) {
+        const ObDatum &datum = datums.at(i);
+        if (!datum.is_null() && !datum.is_nop()) {
+          count_candidates(candidates, datum);
+        }
+      }
+      std::sort(candidates.sorted_, candidates.sorted_ + candidates.cnt_,
+          CandidateSet::GainCmp());
+      symbol_table_.reset();
+      for (int64_t i = 0; i < candidates.cnt_; ++i) {
+        if (!symbol_table_.add(candidates.sorted_[i]->symbol_, candidates.sorted_[i]->len_)) {
+          break;
+        }
+      }
+    }
+    LOG_DEBUG("string symbol table built", K_(column_index), K(step),
+        "symbol count", symbol_table_.count(), "candidate count", candidates.cnt_);
+  }
+  return ret;
+}
+
+int ObStringSymbolEncoder::traverse(bool &suitable)
+{
+  int ret = OB_SUCCESS;
+  suitable = false;
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("not init", K(ret));
+  } else {
+    const ObColDatums &datums = *ctx_->col_datums_;
+    for (int64_t i = 0; OB_SUCC(ret) && i < datums.count(); ++i) {
+      const ObDatum &datum = datums.at(i);
+      if (datum.is_null()) {
+        null_cnt_++;
+      } else if (datum.is_nop()) {
+        nope_cnt_++;
+      } else if (datum.is_ext()) {
+        ret = OB_NOT_SUPPORTED;
+        LOG_WARN("not supported extend object type",
+            K(ret), K(datum), K_(column_type), K_(column_index));
+      } else {
+        raw_size_ += datum.len_;
+      }
+    }
+
+    if (OB_FAIL(ret) || datums.count() - null_cnt_ - nope_cnt_ <= 1 || 0 == raw_size_) {
+    } else if (OB_FAIL(build_symbol_table())) {
+      LOG_WARN("build symbol table failed", K(ret), K_(column_index));
+    } else if (OB_ISNULL(var_lengths_ = static_cast<int32_t *>(
+        allocator_.alloc(sizeof(int32_t) * datums.count())))) {
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+      LOG_WARN("alloc var lengths failed", K(ret), "count", datums.count());
+    } else {
+      for (int64_t i = 0; i < datums.count(); ++i) {
+        const ObDatum &datum = datums.at(i);
+        if (datum.is_null() || datum.is_nop()) {
+          var_lengths_[i] = 0;
+        } else {
+          var_lengths_[i] = static_cast<int32_t>(
+              symbol_table_.compressed_length(datum.ptr_, datum.len_));
+          compressed_size_ += var_lengths_[i];
+        }
+      }
+      const int64_t meta_size = ObStringSymbolHeader::get_meta_size(symbol_table_.count());
+      LOG_DEBUG("string symbol size", K_(column_index), K_(raw_size), K_(compressed_size),
+          K(meta_size));
+      if (compressed_size_ + meta_size < raw_size_) {
+        suitable = true;
+        desc_.is_var_data_ = true;
+        desc_.need_data_store_ = true;
+        desc_.has_null_ = null_cnt_ > 0;
+        desc_.has_nope_ = nope_cnt_ > 0;
+        desc_.need_extend_value_bit_store_ = desc_.has_null_ || desc_.has_nope_;
+        if (desc_.need_extend_value_bit_store_) {
+          column_header_.set_has_extend_value_attr();
+        }
+      }
+    }
+  }
+  return ret;
+}
+
+int ObStringSymbolEncoder::store_meta(ObBufferWriter &buf_writer)
+{
+  int ret = OB_SUCCESS;
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("not init", K(ret));
+  } else {
+    header_ = reinterpret_cast<ObStringSymbolHeader *>(buf_writer.current());
+    const int64_t size = ObStringSymbolHeader::get_meta_size(symbol_table_.count());
+    if (OB_FAIL(buf_writer.advance_zero(size))) {
+      LOG_WARN("advance meta store size failed", K(ret), K(size));
+    } else {
+      header_->version_ = ObStringSymbolHeader::OB_STRING_SYMBOL_HEADER_V1;
+      header_->max_string_size_ = static_cast<uint32_t>(ctx_->max_string_size_);
+      symbol_table_.store(*header_);
+      LOG_DEBUG("string symbol meta", K(*header_));
+    }
+  }
+  return ret;
+}
+
+int ObStringSymbolEncoder::set_data_pos(const int64_t offset, const int64_t length)
+{
+  int ret = OB_SUCCESS;
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("not init", K(ret));
+  } else if (OB_ISNULL(header_)) {
+    ret = OB_INNER_STAT_ERROR;
+    LOG_WARN("call set data pos before store meta", K(ret));
+  } else if (offset < 0 || length < 0) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid data position",
+        K(ret), K(offset), K(length), K(desc_), K_(column_header));
+  } else {
+    header_->offset_ = static_cast<uint32_t>(offset);
+    header_->length_ = static_cast<uint32_t>(length);
+  }
+  return ret;
+}
+
+int ObStringSymbolEncoder::get_var_length(const int64_t row_id, int64_t &length)
+{
+  int ret = OB_SUCCESS;
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("not init", K(ret));
+  } else if (OB_UNLIKELY(row_id < 0 || row_id >= rows_->count() || NULL == var_lengths_)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid argument", K(ret), K(row_id), KP_(var_lengths));
+  } else {
+    length = var_lengths_[row_id];
+  }
+  return ret;
+}
+
+int ObStringSymbolEncoder::store_data(
+    const int64_t row_id, ObBitStream &bs, char *buf, const int64_t len)
+{
+  int ret = OB_SUCCESS;
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("not init", K(ret));
+  } else if (OB_UNLIKELY(row_id < 0 || row_id >= rows_->count() || len < 0)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid argument", K(ret), K(row_id), K(len));
+  } else {
+    const ObDatum &datum = ctx_->col_datums_->at(row_id);
+    const ObStoredExtValue ext_val = get_stored_ext_value(datum);
+    if (STORED_NOT_EXT != ext_val) {
+      if (OB_FAIL(bs.set(column_header_.extend_value_index_,
+          extend_value_bit_, static_cast<int64_t>(ext_val)))) {
+        LOG_WARN("store extend value bit failed",
+            K(ret), K_(column_header), K_(extend_value_bit), K(ext_val));
+      }
+    } else if (OB_UNLIKELY(len != var_lengths_[row_id])) {
+      ret = OB_ERR_UNEXPECTED;
+      LOG_WARN("unexpected var length", K(ret), K(row_id), K(len), "expect", var_lengths_[row_id]);
+    } else {
+      symbol_table_.compress(datum.ptr_, datum.len_, reinterpret_cast<unsigned char *>(buf));
+    }
+  }
+  return ret;
+}
+
+int64_t ObStringSymbolEncoder::calc_size() const
+{
+  int64_t size = INT64_MAX;
+  if (is_inited_) {
+    size = ObStringSymbolHeader::get_meta_size(symbol_table_.count())
+        + DEF_VAR_INDEX_BYTE * rows_->count() + compressed_size_;
+  }
+  return size;
+}
+
+int ObStringSymbolEncoder::store_fix_data(ObBufferWriter &buf_writer)
+{
+  UNUSED(buf_writer);
+  return OB_NOT_SUPPORTED;
+}
+
+} // end namespace blocksstable
+} // end namespace oceanbase
@@ -0,0 +1,188 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#ifndef OCEANBASE_ENCODING_OB_STRING_SYMBOL_ENCODER_H_
+#define OCEANBASE_ENCODING_OB_STRING_SYMBOL_ENCODER_H_
+
+#include "lib/allocator/page_arena.h"
+#include "ob_icolumn_encoder.h"
+#include "ob_encoding_util.h"
+#include "ob_bit_stream.h"
+
+namespace oceanbase
+{
+namespace blocksstable
+{
+
+// String symbol encoding, compress every cell of a micro block by one static symbol table:
+// each byte of the stored cell is the code of a symbol of 1 ~ 8 bytes, or ESCAPE_CODE
+// followed by one literal byte. Cells are stored as var data, so one row can be decoded
+// without touching others.
+//
+// Meta layout: | header | symbols (8 bytes each) | symbol lengths (1 byte each) |
+struct ObStringSymbolHeader
+{
+  static constexpr uint8_t OB_STRING_SYMBOL_HEADER_V1 = 0;
+  static constexpr int64_t MAX_SYMBOL_CNT = 255;
+  static constexpr int64_t MAX_SYMBOL_LEN = sizeof(uint64_t);
+  static constexpr uint8_t ESCAPE_CODE = 255;
+
+  uint8_t version_;
+  uint8_t symbol_cnt_;
+  uint32_t offset_;
+  uint32_t length_;
+  uint32_t max_string_size_;
+  char payload_[0];
+
+  void reset() { memset(this, 0, sizeof(*this)); }
+  static int64_t get_meta_size(const int64_t symbol_cnt)
+  {
+    return sizeof(ObStringSymbolHeader) + symbol_cnt * (sizeof(uint64_t) + sizeof(uint8_t));
+  }
+  OB_INLINE const char *symbols() const { return payload_; }
+  OB_INLINE const uint8_t *symbol_lens() const
+  {
+    return reinterpret_cast<const uint8_t *>(payload_ + symbol_cnt_ * sizeof(uint64_t));
+  }
+
+  // @out should have MAX_SYMBOL_LEN bytes slack after the decompressed string
+  OB_INLINE int64_t decompress(const unsigned char *codes, const int64_t code_len, char *out) const
+  {
+    const char *syms = symbols();
+    const uint8_t *lens = symbol_lens();
+    char *p = out;
+    for (int64_t i = 0; i < code_len; ++i) {
+      const uint8_t code = codes[i];
+      if (ESCAPE_CODE == code) {
+        *p++ = static_cast<char>(codes[++i]);
+      } else {
+        MEMCPY(p, syms + code * sizeof(uint64_t), sizeof(uint64_t));
+        p += lens[code];
+      }
+    }
+    return p - out;
+  }
+
+  TO_STRING_KV(K_(version), K_(symbol_cnt), K_(offset), K_(length), K_(max_string_size));
+} __attribute__((packed));
+
+// Symbol table used for compression, greedy longest match by hashing every candidate length.
+class ObStringSymbolTable
+{
+public:
+  ObStringSymbolTable() { reset(); }
+  void reset();
+  int64_t count() const { return symbol_cnt_; }
+  bool add(const uint64_t symbol, const int64_t len);
+  // rebuild the table from stored meta, codes are the same as the encoder's
+  void build(const ObStringSymbolHeader &header);
+
+  // return matched symbol length, 0 for no symbol matched (need escape)
+  OB_INLINE int64_t find(const unsigned char *str, const int64_t len, uint8_t &code) const
+  {
+    int64_t matched = 0;
+    int64_t l = std::min(len, static_cast<int64_t>(max_lens_[str[0]]));
+    for (; 0 == matched && l > 0; --l) {
+      const uint64_t symbol = load(str, l);
+      for (int64_t pos = hash(symbol, l); 0 != slots_[pos].len_; pos = (pos + 1) & (SLOT_CNT - 1)) {
+        if (slots_[pos].len_ == l && slots_[pos].symbol_ == symbol) {
+          code = slots_[pos].code_;
+          matched = l;
+          break;
+        }
+      }
+    }
+    return matched;
+  }
+  // @out should have 2 * @len bytes at least
+  int64_t compress(const char *str, const int64_t len, unsigned char *out) const;
+  int64_t compressed_length(const char *str, const int64_t len) const;
+  void store(ObStringSymbolHeader &header) const;
+
+  OB_INLINE static uint64_t load(const unsigned char *str, const int64_t len)
+  {
+    uint64_t v = 0;
+    MEMCPY(&v, str, len);
+    return v;
+  }
+
+private:
+  static const int64_t SLOT_CNT = 1024;
+  struct Slot
+  {
+    uint64_t symbol_;
+    uint8_t len_;
+    uint8_t code_;
+  };
+  OB_INLINE static int64_t hash(const uint64_t symbol, const int64_t len)
+  {
+    return static_cast<int64_t>(((symbol * 0x9E3779B97F4A7C15UL) >> 32) + len) & (SLOT_CNT - 1);
+  }
+
+  uint64_t symbols_[ObStringSymbolHeader::MAX_SYMBOL_CNT];
+  uint8_t lens_[ObStringSymbolHeader::MAX_SYMBOL_CNT];
+  // max symbol length started with the byte, bound the probes of find()
+  uint8_t max_lens_[1 << CHAR_BIT];
+  int64_t symbol_cnt_;
+  Slot slots_[SLOT_CNT];
+};
+
+class ObStringSymbolEncoder : public ObIColumnEncoder
+{
+public:
+  static const ObColumnHeader::Type type_ = ObColumnHeader::STRING_SYMBOL;
+  ObStringSymbolEncoder();
+  virtual ~ObStringSymbolEncoder() {}
+
+  virtual int init(
+      const ObColumnEncodingCtx &ctx,
+      const int64_t column_index,
+      const ObConstDatumRowArray &rows) override;
+
+  virtual int set_data_pos(const int64_t offset, const int64_t length) override;
+  virtual int get_var_length(const int64_t row_id, int64_t &length) override;
+  virtual int store_meta(ObBufferWriter &buf_writer) override;
+  virtual int store_data(
+      const int64_t row_id, ObBitStream &bs, char *buf, const int64_t len) override;
+
+  virtual int traverse(bool &suitable) override;
+  virtual int64_t calc_size() const override;
+  virtual ObColumnHeader::Type get_type() const override { return type_; }
+
+  virtual void reuse() override;
+  virtual int store_fix_data(ObBufferWriter &buf_writer) override;
+
+private:
+  struct CandidateSet;
+  int build_symbol_table();
+  void count_candidates(CandidateSet &candidates, const common::ObDatum &datum) const;
+
+private:
+  // sample size and iteration count to build symbol table, the same as FSST paper
+  static const int64_t MAX_SAMPLE_SIZE = 16 << 10;
+  static const int64_t MAX_GENERATION = 5;
+  static const int64_t CANDIDATE_SLOT_CNT = 8192;
+
+  int64_t raw_size_;
+  int64_t compressed_size_;
+  int64_t null_cnt_;
+  int64_t nope_cnt_;
+  int32_t *var_lengths_;
+  ObStringSymbolHeader *header_;
+  ObStringSymbolTable symbol_table_;
+  common::ObArenaAllocator allocator_;
+};
+
+} // end namespace blocksstable
+} // end namespace oceanbase
+
+#endif // OCEANBASE_ENCODING_OB_STRING_SYMBOL_ENCODER_H_
@@ -37,9 +37,11 @@ namespace blocksstable
 const char *BLOCK_SSTBALE_DIR_NAME = "sstable";
 const char *BLOCK_SSTBALE_FILE_NAME = "block_file";
 
-const bool ObMicroBlockEncoderOpt::ENCODINGS_DEFAULT[ObColumnHeader::MAX_TYPE] = {true, true, true, true, true, true, true, true, true, true};
-const bool ObMicroBlockEncoderOpt::ENCODINGS_NONE[ObColumnHeader::MAX_TYPE] = {false, false, false, false, false, false, false, false, false, false};
-const bool ObMicroBlockEncoderOpt::ENCODINGS_FOR_PERFORMANCE[ObColumnHeader::MAX_TYPE] = {true, true, false, true, false, false, false, false, false, false};
+// encodings appended after COLUMN_SUBSTR are also gated by the major working cluster version
+// in ObMicroBlockEncoder::is_encoding_supported
+const bool ObMicroBlockEncoderOpt::ENCODINGS_DEFAULT[ObColumnHeader::MAX_TYPE] = {true, true, true, true, true, true, true, true, true, true, true, true, true};
+const bool ObMicroBlockEncoderOpt::ENCODINGS_NONE[ObColumnHeader::MAX_TYPE] = {false, false, false, false, false, false, false, false, false, false, false, false, false};
+const bool ObMicroBlockEncoderOpt::ENCODINGS_FOR_PERFORMANCE[ObColumnHeader::MAX_TYPE] = {true, true, false, true, false, false, false, false, false, false, false, false, false};
 
 //================================ObStorageEnv======================================
 bool ObStorageEnv::is_valid() const
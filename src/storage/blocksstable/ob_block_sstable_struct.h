@@ -290,6 +290,9 @@ struct ObColumnHeader
     STRING_PREFIX,
     COLUMN_EQUAL,
     COLUMN_SUBSTR,
+    INTEGER_STRIDE_DIFF,
+    FLOAT_DECIMAL,
+    STRING_SYMBOL,
     MAX_TYPE
   };
 
@@ -388,6 +391,9 @@ struct ObMicroBlockEncoderOpt
   bool &enable_rle() { return enable(ObColumnHeader::RLE); }
   bool &enable_const() { return enable(ObColumnHeader::CONST); }
   bool &enable_str_prefix() { return enable(ObColumnHeader::STRING_PREFIX); }
+  bool &enable_int_stride_diff() { return enable(ObColumnHeader::INTEGER_STRIDE_DIFF); }
+  bool &enable_float_decimal() { return enable(ObColumnHeader::FLOAT_DECIMAL); }
+  bool &enable_str_symbol() { return enable(ObColumnHeader::STRING_SYMBOL); }
 
   const bool &enable_raw() const { return enable(ObColumnHeader::RAW); }
   const bool &enable_dict() const { return enable(ObColumnHeader::DICT); }
@@ -397,6 +403,9 @@ struct ObMicroBlockEncoderOpt
   const bool &enable_rle() const { return enable(ObColumnHeader::RLE); }
   const bool &enable_const() const { return enable(ObColumnHeader::CONST); }
   const bool &enable_str_prefix() const { return enable(ObColumnHeader::STRING_PREFIX); }
+  const bool &enable_int_stride_diff() const { return enable(ObColumnHeader::INTEGER_STRIDE_DIFF); }
+  const bool &enable_float_decimal() const { return enable(ObColumnHeader::FLOAT_DECIMAL); }
+  const bool &enable_str_symbol() const { return enable(ObColumnHeader::STRING_SYMBOL); }
 
   ObMicroBlockEncoderOpt() { set_store_type(ENCODING_ROW_STORE); }
 
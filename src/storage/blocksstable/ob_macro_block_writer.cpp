@@ -27,6 +27,7 @@
 #include "storage/ob_i_store.h"
 #include "storage/ob_sstable_struct.h"
 #include "storage/blocksstable/ob_logic_macro_id.h"
+#include "storage/compaction/ob_tenant_tablet_scheduler.h"
 
 namespace oceanbase
 {
@@ -1108,6 +1109,15 @@ int ObMacroBlockWriter::write_micro_block(ObMicroBlockDesc &micro_block_desc)
   return ret;
 }
 
+void ObMacroBlockWriter::throttle_compaction_io()
+{
+  storage::ObTenantTabletScheduler *scheduler = nullptr;
+  if (compaction::ObCompactionGovernor::need_throttle_io(data_store_desc_->merge_type_)
+      && OB_NOT_NULL(scheduler = MTL(storage::ObTenantTabletScheduler *))) {
+    scheduler->get_compaction_governor().throttle_io(data_store_desc_->macro_block_size_);
+  }
+}
+
 int ObMacroBlockWriter::flush_macro_block(ObMacroBlock &macro_block)
 {
   int ret = OB_SUCCESS;
@@ -1129,6 +1139,7 @@ int ObMacroBlockWriter::flush_macro_block(ObMacroBlock &macro_block)
   } else if (OB_NOT_NULL(builder_)
       && OB_FAIL(builder_->generate_macro_row(macro_block, macro_handle.get_macro_id()))) {
     STORAGE_LOG(WARN, "fail to generate macro row", K(ret), K_(current_macro_seq));
+  } else if (FALSE_IT(throttle_compaction_io())) {
   } else if (OB_FAIL(macro_block.flush(macro_handle, block_write_ctx_))) {
     STORAGE_LOG(WARN, "macro block writer fail to flush macro block.", K(ret));
   } else if (OB_NOT_NULL(callback_) && OB_FAIL(callback_->write(macro_handle,
@@ -1259,14 +1270,20 @@ int ObMacroBlockWriter::check_micro_block_need_merge(
     ret = OB_INVALID_ARGUMENT;
     STORAGE_LOG(WARN, "invalid micro_block", K(micro_block), K(ret));
   } else {
-    if (micro_writer_->get_row_count() <= 0
-        && micro_block.header_.data_length_ > data_store_desc_->micro_block_size_ / 2) {
-      need_merge = false;
-    } else if (micro_writer_->get_block_size() > data_store_desc_->micro_block_size_ / 2
-        && micro_block.header_.data_length_ > data_store_desc_->micro_block_size_ / 2) {
+    // Only small micro blocks are worth decoding. A well sized micro block behind some
+    // pending rewritten rows (the rows of a neighbour intersecting the increments) is still
+    // reused as is unless both fit into one micro block, the pending rows are flushed as a
+    // smaller micro block which will be merged by the next major merge.
+    const int64_t micro_block_size = data_store_desc_->micro_block_size_;
+    const int64_t data_length = micro_block.header_.data_length_;
+    if (data_length <= micro_block_size / 2) {
+      need_merge = true;
+    } else if (micro_writer_->get_row_count() <= 0) {
       need_merge = false;
-    } else {
+    } else if (micro_writer_->get_block_size() + data_length <= micro_block_size) {
       need_merge = true;
+    } else {
+      need_merge = false;
     }
     STORAGE_LOG(DEBUG, "check micro block need merge", K(micro_writer_->get_row_count()), K(micro_block.data_.get_buf_size()),
         K(micro_writer_->get_block_size()), K(data_store_desc_->micro_block_size_), K(need_merge));
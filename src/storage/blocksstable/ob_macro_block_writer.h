@@ -171,6 +171,7 @@ private:
   int write_micro_block(ObMicroBlockDesc &micro_block_desc);
   int check_micro_block_need_merge(const ObMicroBlock &micro_block, bool &need_merge);
   int merge_micro_block(const ObMicroBlock &micro_block);
+  void throttle_compaction_io();
   int flush_macro_block(ObMacroBlock &macro_block);
   int wait_io_finish(ObMacroBlockHandle &macro_handle);
   int alloc_block();
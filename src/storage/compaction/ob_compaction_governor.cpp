@@ -0,0 +1,235 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX STORAGE
+#include "ob_compaction_governor.h"
+#include "share/io/ob_io_manager.h"
+#include "share/rc/ob_tenant_base.h"
+#include "lib/utility/utility.h"
+
+namespace oceanbase
+{
+using namespace common;
+using namespace share;
+
+namespace compaction
+{
+
+const int64_t ObCompactionGovernor::ADJUST_INTERVAL;
+const int64_t ObCompactionGovernor::RT_BUCKET_CNT;
+const int64_t ObCompactionGovernor::MIN_REQUEST_CNT;
+const int64_t ObCompactionGovernor::MIN_CONCURRENCY_PCT;
+const int64_t ObCompactionGovernor::MIN_IO_BANDWIDTH_LIMIT;
+const int64_t ObCompactionGovernor::MAX_IO_WAIT_SLICE;
+
+ObCompactionGovernor::ObCompactionGovernor()
+  : target_rt_(0),
+    io_bandwidth_baseline_(0),
+    io_bandwidth_limit_(0),
+    io_bytes_(0),
+    last_io_bytes_(0),
+    last_adjust_ts_(0),
+    io_throttle_ts_(0),
+    throttle_info_()
+{
+  MEMSET(rt_buckets_, 0, sizeof(rt_buckets_));
+}
+
+void ObCompactionGovernor::reset()
+{
+  target_rt_ = 0;
+  io_bandwidth_baseline_ = 0;
+  io_bandwidth_limit_ = 0;
+  io_bytes_ = 0;
+  last_io_bytes_ = 0;
+  last_adjust_ts_ = 0;
+  io_throttle_ts_ = 0;
+  throttle_info_.reset();
+  MEMSET(rt_buckets_, 0, sizeof(rt_buckets_));
+}
+
+void ObCompactionGovernor::reload_config(const int64_t target_rt)
+{
+  const int64_t old_target_rt = ATOMIC_TAS(&target_rt_, target_rt);
+  if (old_target_rt != target_rt) {
+    LOG_INFO("reload compaction throttle target rt", K(old_target_rt), K(target_rt));
+  }
+}
+
+void ObCompactionGovernor::record_request_rt(const int64_t rt_us)
+{
+  if (is_enabled() && rt_us >= 0) {
+    ATOMIC_INC(&rt_buckets_[get_rt_bucket_idx(rt_us)]);
+  }
+}
+
+bool ObCompactionGovernor::need_throttle_io(const storage::ObMergeType merge_type)
+{
+  // the same merges as the COMPACTION_MID/LOW dags, mini merge has to keep dumping memtables
+  return storage::MINI_MINOR_MERGE == merge_type
+      || storage::HISTORY_MINI_MINOR_MERGE == merge_type
+      || storage::MINOR_MERGE == merge_type
+      || storage::MAJOR_MERGE == merge_type;
+}
+
+void ObCompactionGovernor::throttle_io(const int64_t size)
+{
+  ATOMIC_AAF(&io_bytes_, size);
+  int64_t limit = ATOMIC_LOAD(&io_bandwidth_limit_);
+  if (limit > 0 && size > 0) {
+    const int64_t cur_ts = ObTimeUtility::current_time();
+    int64_t old_ts = 0;
+    int64_t start_ts = 0;
+    do {
+      old_ts = ATOMIC_LOAD(&io_throttle_ts_);
+      start_ts = MAX(cur_ts, old_ts);
+    } while (!ATOMIC_BCAS(&io_throttle_ts_, old_ts, start_ts + size * 1000000L / limit));
+    int64_t wait_us = start_ts - cur_ts;
+    while (wait_us > 0 && limit > 0) {
+      const int64_t sleep_us = MIN(wait_us, MAX_IO_WAIT_SLICE);
+      ob_usleep(static_cast<uint32_t>(sleep_us));
+      wait_us -= sleep_us;
+      limit = ATOMIC_LOAD(&io_bandwidth_limit_);
+    }
+  }
+}
+
+// bucket [4 * (msb - 1) + sub] holds [(4 + sub) << (msb - 2), (5 + sub) << (msb - 2))
+int64_t ObCompactionGovernor::get_rt_bucket_idx(const int64_t rt_us)
+{
+  int64_t idx = 0;
+  if (rt_us < 4) {
+    idx = MAX(0, rt_us);
+  } else {
+    const int64_t msb = 63 - __builtin_clzll(rt_us);
+    const int64_t sub = (rt_us >> (msb - 2)) & 3;
+    idx = MIN(RT_BUCKET_CNT - 1, (msb - 1) * 4 + sub);
+  }
+  return idx;
+}
+
+int64_t ObCompactionGovernor::get_rt_bucket_upper_bound(const int64_t idx)
+{
+  int64_t upper_bound = 0;
+  if (idx < 4) {
+    upper_bound = idx + 1;
+  } else {
+    const int64_t msb = idx / 4 + 1;
+    const int64_t sub = idx % 4;
+    upper_bound = (5 + sub) << (msb - 2);
+  }
+  return upper_bound;
+}
+
+int64_t ObCompactionGovernor::calc_rt_percentile(
+    const int64_t *buckets,
+    const int64_t total_cnt,
+    const int64_t percentile)
+{
+  int64_t rt = 0;
+  if (OB_NOT_NULL(buckets) && total_cnt > 0) {
+    const int64_t target_cnt = (total_cnt * percentile + 99) / 100;
+    int64_t cnt = 0;
+    for (int64_t i = 0; i < RT_BUCKET_CNT; ++i) {
+      cnt += buckets[i];
+      if (cnt >= target_cnt) {
+        rt = get_rt_bucket_upper_bound(i);
+        break;
+      }
+    }
+  }
+  return rt;
+}
+
+void ObCompactionGovernor::calc_next_throttle(
+    const int64_t target_rt,
+    const int64_t io_bandwidth,
+    int64_t &io_bandwidth_baseline,
+    ObCompactionThrottleInfo &throttle_info)
+{
+  if (target_rt <= 0) {
+    const int64_t fg_rt_us = throttle_info.fg_rt_us_;
+    const int64_t fg_request_cnt = throttle_info.fg_request_cnt_;
+    const int64_t user_io_depth = throttle_info.user_io_depth_;
+    throttle_info.reset();
+    throttle_info.fg_rt_us_ = fg_rt_us;
+    throttle_info.fg_request_cnt_ = fg_request_cnt;
+    throttle_info.user_io_depth_ = user_io_depth;
+  } else {
+    const bool enough_requests = throttle_info.fg_request_cnt_ >= MIN_REQUEST_CNT;
+    const bool overloaded = (enough_requests && throttle_info.fg_rt_us_ > target_rt)
+        || throttle_info.user_io_depth_ > MAX_USER_IO_DEPTH;
+    const bool relaxed = !overloaded
+        && (!enough_requests || throttle_info.fg_rt_us_ * 100 <= target_rt * RECOVER_RT_PCT);
+    int64_t &concurrency_pct = throttle_info.concurrency_pct_;
+    if (overloaded) {
+      if (!throttle_info.is_throttled()) {
+        io_bandwidth_baseline = io_bandwidth;
+      }
+      concurrency_pct = MAX(MIN_CONCURRENCY_PCT, concurrency_pct / 2);
+    } else if (relaxed) {
+      concurrency_pct = MIN(ObCompactionThrottleInfo::MAX_CONCURRENCY_PCT, concurrency_pct + CONCURRENCY_PCT_STEP);
+    }
+    if (ObCompactionThrottleInfo::MAX_CONCURRENCY_PCT == concurrency_pct || io_bandwidth_baseline <= 0) {
+      // no compaction io to throttle when the throttle started
+      throttle_info.io_bandwidth_limit_ = 0;
+    } else {
+      throttle_info.io_bandwidth_limit_ = MAX(MIN_IO_BANDWIDTH_LIMIT,
+          io_bandwidth_baseline * concurrency_pct / ObCompactionThrottleInfo::MAX_CONCURRENCY_PCT);
+    }
+  }
+}
+
+int ObCompactionGovernor::adjust()
+{
+  int ret = OB_SUCCESS;
+  int64_t buckets[RT_BUCKET_CNT];
+  int64_t request_cnt = 0;
+  for (int64_t i = 0; i < RT_BUCKET_CNT; ++i) {
+    buckets[i] = ATOMIC_TAS(&rt_buckets_[i], 0);
+    request_cnt += buckets[i];
+  }
+  ObCompactionThrottleInfo throttle_info = throttle_info_;
+  throttle_info.fg_request_cnt_ = request_cnt;
+  throttle_info.fg_rt_us_ = calc_rt_percentile(buckets, request_cnt, RT_PERCENTILE);
+
+  const int64_t cur_ts = ObTimeUtility::current_time();
+  const int64_t io_bytes = ATOMIC_LOAD(&io_bytes_);
+  const int64_t io_bandwidth = (last_adjust_ts_ > 0 && cur_ts > last_adjust_ts_)
+      ? (io_bytes - last_io_bytes_) * 1000000L / (cur_ts - last_adjust_ts_) : 0;
+  last_io_bytes_ = io_bytes;
+  last_adjust_ts_ = cur_ts;
+  ObRefHolder<ObTenantIOManager> tenant_holder;
+  if (OB_FAIL(OB_IO_MANAGER.get_tenant_io_manager(MTL_ID(), tenant_holder))) {
+    LOG_WARN("failed to get tenant io manager", K(ret));
+  } else {
+    throttle_info.user_io_depth_ = tenant_holder.get_ptr()->get_io_usage().get_doing_request_count(ObIOCategory::USER_IO);
+  }
+
+  if (OB_SUCC(ret)) {
+    calc_next_throttle(ATOMIC_LOAD(&target_rt_), io_bandwidth, io_bandwidth_baseline_, throttle_info);
+    if (throttle_info.is_throttled() != throttle_info_.is_throttled()) {
+      LOG_INFO("compaction throttle state changed", "old_info", throttle_info_, "new_info", throttle_info,
+          K(io_bandwidth), K_(io_bandwidth_baseline), K_(target_rt));
+    }
+    if (OB_FAIL(MTL(ObTenantDagScheduler *)->set_compaction_throttle(throttle_info))) {
+      LOG_WARN("failed to set compaction throttle", K(ret), K(throttle_info));
+    } else {
+      ATOMIC_STORE(&io_bandwidth_limit_, throttle_info.io_bandwidth_limit_);
+      throttle_info_ = throttle_info;
+    }
+  }
+  return ret;
+}
+
+} // namespace compaction
+} // namespace oceanbase
@@ -0,0 +1,89 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#ifndef SRC_STORAGE_COMPACTION_OB_COMPACTION_GOVERNOR_H_
+#define SRC_STORAGE_COMPACTION_OB_COMPACTION_GOVERNOR_H_
+
+#include "lib/utility/ob_print_utils.h"
+#include "share/scheduler/ob_dag_scheduler.h"
+#include "storage/ob_i_store.h"
+
+namespace oceanbase
+{
+namespace compaction
+{
+
+// Throttles minor/major merge of the tenant by the latency of its foreground requests.
+//
+// Tenant workers report the response time of every request, and adjust() runs once per
+// ADJUST_INTERVAL to compute the p99 of the last round. When the p99 exceeds the target or
+// too many user io requests are in flight, the concurrency of minor/major merge dags and the
+// write bandwidth of minor/major merge are halved, and they are restored step by step once the
+// p99 falls clearly below the target. The bandwidth is enforced by the macro block writers of
+// those merges through throttle_io(), so mini merge and the SYS_IO of slog and checkpoints,
+// which share the io category with them, are never slowed down.
+class ObCompactionGovernor
+{
+public:
+  static const int64_t ADJUST_INTERVAL = 1000L * 1000L; // 1s
+  static const int64_t RT_BUCKET_CNT = 120; // four buckets per power of 2, up to 2^30 us
+  static const int64_t MIN_REQUEST_CNT = 100; // too few requests to tell the p99
+  static const int64_t RT_PERCENTILE = 99;
+  static const int64_t RECOVER_RT_PCT = 80; // restore merge after p99 < 80% of the target
+  static const int64_t MIN_CONCURRENCY_PCT = 10;
+  static const int64_t CONCURRENCY_PCT_STEP = 10;
+  static const int64_t MAX_USER_IO_DEPTH = 64;
+  static const int64_t MIN_IO_BANDWIDTH_LIMIT = 2L << 20; // one macro block per second
+  static const int64_t MAX_IO_WAIT_SLICE = 100L * 1000L; // 100ms, to notice a lifted throttle
+
+  ObCompactionGovernor();
+  ~ObCompactionGovernor() {}
+  void reset();
+  void reload_config(const int64_t target_rt);
+  OB_INLINE bool is_enabled() const { return ATOMIC_LOAD(&target_rt_) > 0; }
+  // called by tenant workers when a request finishes, @rt_us includes the queueing time
+  void record_request_rt(const int64_t rt_us);
+  int adjust();
+  static bool need_throttle_io(const storage::ObMergeType merge_type);
+  // called by minor/major merge before writing @size bytes, waits while the write bandwidth
+  // of throttled merges exceeds the limit
+  void throttle_io(const int64_t size);
+  void get_throttle_info(share::ObCompactionThrottleInfo &throttle_info) const { throttle_info = throttle_info_; }
+
+  static int64_t get_rt_bucket_idx(const int64_t rt_us);
+  static int64_t get_rt_bucket_upper_bound(const int64_t idx);
+  static int64_t calc_rt_percentile(const int64_t *buckets, const int64_t total_cnt, const int64_t percentile);
+  // @throttle_info holds the load observed in last round, and is updated to the throttle of next round
+  static void calc_next_throttle(
+      const int64_t target_rt,
+      const int64_t io_bandwidth,
+      int64_t &io_bandwidth_baseline,
+      share::ObCompactionThrottleInfo &throttle_info);
+  TO_STRING_KV(K_(target_rt), K_(io_bandwidth_baseline), K_(io_bandwidth_limit), K_(throttle_info));
+
+private:
+  int64_t target_rt_;
+  int64_t io_bandwidth_baseline_; // write bandwidth of minor/major merge when the throttle starts
+  int64_t io_bandwidth_limit_;    // bytes per second, 0 means unlimited
+  int64_t io_bytes_;              // bytes written by minor/major merge
+  int64_t last_io_bytes_;
+  int64_t last_adjust_ts_;
+  int64_t io_throttle_ts_;        // when the next throttled write can start
+  share::ObCompactionThrottleInfo throttle_info_;
+  int64_t rt_buckets_[RT_BUCKET_CNT];
+  DISALLOW_COPY_AND_ASSIGN(ObCompactionGovernor);
+};
+
+} // namespace compaction
+} // namespace oceanbase
+
+#endif // SRC_STORAGE_COMPACTION_OB_COMPACTION_GOVERNOR_H_
@@ -128,6 +128,49 @@ int ObTransStatusFilter::filter(
   return ret;
 }
 
+int ObTTLCompactionFilter::init(
+    const schema::ObTableTTLParam &ttl_param,
+    const int64_t snapshot_version,
+    const bool is_full_merge)
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(!ttl_param.is_valid() || snapshot_version <= 0)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid argument", K(ret), K(ttl_param), K(snapshot_version));
+  } else if (IS_INIT) {
+    ret = OB_INIT_TWICE;
+    LOG_WARN("is inited", K(ret), K(ttl_param), K(snapshot_version));
+  } else {
+    // every replica removes the same rows as the major snapshot is the same, and reuses the
+    // same macro blocks unless some base rows are expired and every block is rewritten
+    is_full_merge_ = is_full_merge;
+    ttl_param_ = ttl_param;
+    snapshot_version_ = snapshot_version;
+    is_inited_ = true;
+  }
+  return ret;
+}
+
+int ObTTLCompactionFilter::filter(
+    const blocksstable::ObDatumRow &row,
+    ObFilterRet &filter_ret)
+{
+  int ret = OB_SUCCESS;
+  filter_ret = FILTER_RET_MAX;
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("not init", K(ret));
+  } else if (OB_UNLIKELY(row.count_ <= ttl_param_.col_idx_)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("ttl column not in row", K(ret), K(row), K_(ttl_param));
+  } else if (ttl_param_.is_expired(row.storage_datums_[ttl_param_.col_idx_], snapshot_version_)) {
+    filter_ret = FILTER_RET_REMOVE;
+    LOG_DEBUG("filter expired row", K(ret), K(row), K_(snapshot_version));
+  } else {
+    filter_ret = FILTER_RET_NOT_CHANGE;
+  }
+  return ret;
+}
 
 } // namespace compaction
 } // namespace oceanbase
@@ -117,6 +117,42 @@ private:
   share::SCN max_filtered_end_scn_;
 };
 
+// remove rows expired at the snapshot of major merge, see ObTableTTLParam
+class ObTTLCompactionFilter : public ObICompactionFilter
+{
+public:
+  ObTTLCompactionFilter()
+    : ObICompactionFilter(true),
+      is_inited_(false),
+      ttl_param_(),
+      snapshot_version_(0)
+  {
+  }
+  ~ObTTLCompactionFilter() {}
+  // @is_full_merge: rewrite every macro block as some rows of the base sstable are expired
+  int init(
+      const share::schema::ObTableTTLParam &ttl_param,
+      const int64_t snapshot_version,
+      const bool is_full_merge);
+  OB_INLINE virtual void reset() override
+  {
+    ObICompactionFilter::reset();
+    ttl_param_.reset();
+    snapshot_version_ = 0;
+    is_inited_ = false;
+  }
+
+  virtual int filter(const blocksstable::ObDatumRow &row, ObFilterRet &filter_ret) override;
+
+  INHERIT_TO_STRING_KV("ObICompactionFilter", ObICompactionFilter, "filter_name", "ObTTLCompactionFilter",
+      K_(ttl_param), K_(snapshot_version));
+
+private:
+  bool is_inited_;
+  share::schema::ObTableTTLParam ttl_param_;
+  int64_t snapshot_version_;
+};
+
 } // namespace compaction
 } // namespace oceanbase
 
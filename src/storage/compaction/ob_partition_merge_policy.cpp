@@ -39,6 +39,8 @@ namespace oceanbase
 namespace compaction
 {
 
+const int64_t ObPartitionMergePolicy::MIN_TIERED_SSTABLE_SIZE;
+
 // keep order with ObMergeType
 ObPartitionMergePolicy::GetMergeTables ObPartitionMergePolicy::get_merge_tables[MERGE_TYPE_MAX]
   = { ObPartitionMergePolicy::get_mini_minor_merge_tables,
@@ -403,7 +405,10 @@ int ObPartitionMergePolicy::find_mini_minor_merge_tables(
 
   if (OB_SUCC(ret)) {
     result.suggest_merge_type_ = param.merge_type_;
-    if (OB_FAIL(refine_mini_minor_merge_result(result))) {
+    const bool is_tiered = HISTORY_MINI_MINOR_MERGE != param.merge_type_ && use_tiered_compaction(tablet);
+    if (is_tiered && OB_FAIL(refine_tiered_minor_merge_result(result))) {
+      LOG_WARN("failed to refine tiered minor merge result", K(ret));
+    } else if (!is_tiered && OB_FAIL(refine_mini_minor_merge_result(result))) {
       LOG_WARN("failed to refine_minor_merge_result", K(ret));
     } else {
       result.version_range_.multi_version_start_ = tablet.get_multi_version_start();
@@ -657,6 +662,8 @@ int ObPartitionMergePolicy::check_need_mini_minor_merge(
   const ObTabletID &tablet_id = tablet.get_tablet_meta().tablet_id_;
   int64_t delay_merge_schedule_interval = 0;
   ObTablesHandleArray minor_tables;
+  const bool is_tiered = use_tiered_compaction(tablet);
+  ObSEArray<int64_t, MAX_SSTABLE_CNT_IN_STORAGE> table_sizes;
   {
     omt::ObTenantConfigGuard tenant_config(TENANT_CONF(MTL_ID()));
     if (tenant_config.is_valid()) {
@@ -692,7 +699,12 @@ int ObPartitionMergePolicy::check_need_mini_minor_merge(
       }
       found_greater = true;
       minor_sstable_count++;
-      if (table->is_mini_sstable()) {
+      if (is_tiered) {
+        // L1 sstables are merged by size tiers, never chaos
+        if (OB_FAIL(table_sizes.push_back(get_tiered_sstable_size(*table)))) {
+          LOG_WARN("failed to push back table size", K(ret));
+        }
+      } else if (table->is_mini_sstable()) {
         if (mini_minor_threshold == need_merge_mini_count++) {
           minor_check_snapshot_version = table->get_max_merged_trans_version();
         }
@@ -713,6 +725,13 @@ int ObPartitionMergePolicy::check_need_mini_minor_merge(
       } else if (table_store.get_table_count() >= MAX_SSTABLE_CNT_IN_STORAGE - RESERVED_STORE_CNT_IN_STORAGE) {
         need_merge = true;
         LOG_INFO("table store has too many sstables, need to compaction", K(table_store));
+      } else if (is_tiered) {
+        int64_t min_table_cnt = 0;
+        int64_t size_ratio = 0;
+        int64_t start_idx = 0;
+        int64_t end_idx = 0;
+        get_tiered_compaction_config(min_table_cnt, size_ratio);
+        need_merge = find_tiered_merge_window(table_sizes, min_table_cnt, size_ratio, start_idx, end_idx);
       } else if (need_merge_mini_count <= mini_minor_threshold) {
         // no need merge
       } else {
@@ -1012,6 +1031,75 @@ int ObPartitionMergePolicy::diagnose_table_count_unsafe(
   return ret;
 }
 
+bool ObPartitionMergePolicy::is_tiered_compaction(const ObTablet &tablet)
+{
+  return TABLE_MODE_TIERED == tablet.get_storage_schema().get_table_mode_flag();
+}
+
+// fall back to the leveled policy to reduce the sstables when the tiers can't keep up
+bool ObPartitionMergePolicy::use_tiered_compaction(const ObTablet &tablet)
+{
+  return is_tiered_compaction(tablet)
+      && !tablet.is_ls_tx_data_tablet()
+      && tablet.get_table_store().get_table_count() < OB_UNSAFE_TABLE_CNT;
+}
+
+void ObPartitionMergePolicy::get_tiered_compaction_config(int64_t &min_table_cnt, int64_t &size_ratio)
+{
+  int64_t minor_compact_trigger = DEFAULT_MINOR_COMPACT_TRIGGER;
+  size_ratio = DEFAULT_TIERED_SIZE_RATIO;
+  {
+    omt::ObTenantConfigGuard tenant_config(TENANT_CONF(MTL_ID()));
+    if (tenant_config.is_valid()) {
+      minor_compact_trigger = tenant_config->minor_compact_trigger;
+      size_ratio = tenant_config->_tiered_compaction_size_ratio;
+    }
+  } // end of ObTenantConfigGuard
+  // minor_compact_trigger is the number of sstables one tier can hold
+  min_table_cnt = MAX(2, minor_compact_trigger + 1);
+}
+
+int64_t ObPartitionMergePolicy::get_tiered_sstable_size(const ObSSTable &table)
+{
+  return MAX(MIN_TIERED_SSTABLE_SIZE, table.get_meta().get_basic_meta().occupy_size_);
+}
+
+bool ObPartitionMergePolicy::find_tiered_merge_window(
+    const ObIArray<int64_t> &table_sizes,
+    const int64_t min_table_cnt,
+    const int64_t size_ratio,
+    int64_t &start_idx,
+    int64_t &end_idx)
+{
+  bool found = false;
+  int64_t best_cnt = 0;
+  int64_t best_size = INT64_MAX;
+  start_idx = 0;
+  end_idx = 0;
+  for (int64_t i = 0; i < table_sizes.count(); ++i) {
+    int64_t min_size = table_sizes.at(i);
+    int64_t max_size = table_sizes.at(i);
+    int64_t total_size = 0;
+    for (int64_t j = i; j < table_sizes.count(); ++j) {
+      min_size = MIN(min_size, table_sizes.at(j));
+      max_size = MAX(max_size, table_sizes.at(j));
+      if (max_size > min_size * size_ratio) {
+        break;
+      }
+      total_size += table_sizes.at(j);
+      const int64_t cnt = j - i + 1;
+      if (cnt >= min_table_cnt && (cnt > best_cnt || (cnt == best_cnt && total_size < best_size))) {
+        found = true;
+        best_cnt = cnt;
+        best_size = total_size;
+        start_idx = i;
+        end_idx = j + 1;
+      }
+    }
+  }
+  return found;
+}
+
 bool ObPartitionMergePolicy::check_table_count_safe(const ObTabletTableStore &table_store)
 {
   return table_store.get_table_count() < OB_EMERGENCY_TABLE_CNT;
@@ -1142,6 +1230,57 @@ int ObPartitionMergePolicy::refine_mini_minor_merge_result(ObGetMergeTablesResul
   return ret;
 }
 
+// Merge the sstables of the same size tier into one minor sstable. Unlike the leveled policy, the large
+// L1 sstables are left alone until enough sstables of their size show up, so the data of an append-only
+// table is rewritten about log(N)/log(size_ratio) times before major merge.
+int ObPartitionMergePolicy::refine_tiered_minor_merge_result(ObGetMergeTablesResult &result)
+{
+  int ret = OB_SUCCESS;
+  ObSEArray<ObITable *, MAX_SSTABLE_CNT_IN_STORAGE> tables;
+  ObSEArray<int64_t, MAX_SSTABLE_CNT_IN_STORAGE> table_sizes;
+  ObITable *table = nullptr;
+  int64_t min_table_cnt = 0;
+  int64_t size_ratio = 0;
+  int64_t start_idx = 0;
+  int64_t end_idx = 0;
+  get_tiered_compaction_config(min_table_cnt, size_ratio);
+
+  for (int64_t i = 0; OB_SUCC(ret) && i < result.handle_.get_count(); ++i) {
+    if (OB_ISNULL(table = result.handle_.get_table(i)) || !table->is_multi_version_minor_sstable()) {
+      ret = OB_ERR_SYS;
+      LOG_ERROR("get unexpected table", KP(table), K(ret));
+    } else if (OB_FAIL(tables.push_back(table))) {
+      LOG_WARN("failed to push back table", K(ret));
+    } else if (OB_FAIL(table_sizes.push_back(get_tiered_sstable_size(*static_cast<ObSSTable *>(table))))) {
+      LOG_WARN("failed to push back table size", K(ret));
+    }
+  }
+  if (OB_FAIL(ret) || result.handle_.empty()) {
+  } else if (!find_tiered_merge_window(table_sizes, min_table_cnt, size_ratio, start_idx, end_idx)) {
+    LOG_INFO("tiered refine, no tier has enough sstables", K(min_table_cnt), K(size_ratio), K(table_sizes), K(result));
+    result.handle_.reset();
+  } else {
+    result.reset_handle_and_range();
+    result.suggest_merge_type_ = MINOR_MERGE;
+    for (int64_t i = start_idx; OB_SUCC(ret) && i < end_idx; ++i) {
+      table = tables.at(i);
+      if (OB_FAIL(result.handle_.add_table(table))) {
+        LOG_WARN("Failed to add table to minor merge result", KPC(table), K(ret));
+      } else {
+        if (start_idx == i) {
+          result.scn_range_.start_scn_ = table->get_start_scn();
+        }
+        result.scn_range_.end_scn_ = table->get_end_scn();
+      }
+    }
+    if (OB_SUCC(ret)) {
+      LOG_INFO("tiered refine, merge sstables of the same tier", K(start_idx), K(end_idx), K(size_ratio),
+               K(table_sizes), K(result));
+    }
+  }
+  return ret;
+}
+
 ObITable *ObPartitionMergePolicy::get_latest_sstable(const ObTabletTableStore &table_store)
 {
   ObITable *major_table = table_store.get_major_sstables().get_boundary_table(true/*last*/);
@@ -18,6 +18,10 @@
 
 namespace oceanbase
 {
+namespace blocksstable
+{
+class ObSSTable;
+}
 namespace storage
 {
 class ObITable;
@@ -93,6 +97,18 @@ public:
   static int diagnose_table_count_unsafe(
       const storage::ObMergeType &merge_type,
       const storage::ObTablet &tablet);
+
+  // tables in TABLE_MODE_TIERED merge minor sstables of similar size instead of keeping one L1 sstable
+  static bool is_tiered_compaction(const storage::ObTablet &tablet);
+  // find the continuous sstables [start_idx, end_idx) to merge together, the largest one of which is
+  // at most @size_ratio times the smallest one. Prefer the window with the most sstables, and the
+  // smaller one on ties. Return false if no window has @min_table_cnt sstables.
+  static bool find_tiered_merge_window(
+      const common::ObIArray<int64_t> &table_sizes,
+      const int64_t min_table_cnt,
+      const int64_t size_ratio,
+      int64_t &start_idx,
+      int64_t &end_idx);
 private:
   static int find_mini_merge_tables(
       const storage::ObGetMergeTablesParam &param,
@@ -122,6 +138,10 @@ private:
       const storage::ObTablet &tablet,
       storage::ObGetMergeTablesResult &result);
   static int refine_mini_minor_merge_result(storage::ObGetMergeTablesResult &result);
+  static int refine_tiered_minor_merge_result(storage::ObGetMergeTablesResult &result);
+  static bool use_tiered_compaction(const storage::ObTablet &tablet);
+  static void get_tiered_compaction_config(int64_t &min_table_cnt, int64_t &size_ratio);
+  static int64_t get_tiered_sstable_size(const blocksstable::ObSSTable &table);
 
   static int deal_with_minor_result(
       const storage::ObMergeType &merge_type,
@@ -160,6 +180,8 @@ public:
   static const int64_t OB_UNSAFE_TABLE_CNT = 32;
   static const int64_t OB_EMERGENCY_TABLE_CNT = 56;
   static const int64_t DEFAULT_MINOR_COMPACT_TRIGGER = 2;
+  static const int64_t DEFAULT_TIERED_SIZE_RATIO = 4;
+  static const int64_t MIN_TIERED_SSTABLE_SIZE = 2L * 1024L * 1024L; // smaller sstables are in the same tier
 
   typedef int (*GetMergeTables)(const storage::ObGetMergeTablesParam&,
                                 const int64_t,
@@ -370,6 +370,33 @@ int ObPartitionMerger::prepare_merge_partition(ObMergeParameter &merge_param,
   return ret;
 }
 
+int ObPartitionMerger::open_next_merge_range(ObMergeParameter &merge_param,
+                                             ObPartitionMergeHelper &merge_helper)
+{
+  int ret = OB_SUCCESS;
+  int64_t range_idx = 0;
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+    STORAGE_LOG(WARN, "ObPartitionMerger is not inited", K(ret));
+  } else if (OB_FAIL(merge_ctx_->parallel_merge_ctx_.get_next_range_idx(task_idx_, range_idx))) {
+    if (OB_ITER_END != ret) {
+      STORAGE_LOG(WARN, "Failed to get next merge range idx", K(ret), K_(task_idx));
+    }
+  } else if (OB_FAIL(merge_ctx_->get_merge_range(range_idx, merge_param.merge_range_))) {
+    STORAGE_LOG(WARN, "Failed to get merge range", K(ret), K(range_idx));
+  } else {
+    // the rows of the next range are appended to the same macro writer
+    base_iter_ = nullptr;
+    merge_helper.reset();
+    if (OB_FAIL(merge_helper.init(*partition_fuser_, merge_param, data_store_desc_.row_store_type_))) {
+      STORAGE_LOG(WARN, "Failed to init merge helper", K(ret), K(range_idx));
+    } else {
+      STORAGE_LOG(DEBUG, "open next merge range", K_(task_idx), K(range_idx), K(merge_param.merge_range_));
+    }
+  }
+  return ret;
+}
+
 void ObPartitionMerger::set_base_iter(const MERGE_ITER_ARRAY &minimum_iters)
 {
   int64_t count = minimum_iters.count();
@@ -414,7 +441,8 @@ template <typename T> T *ObPartitionMerger::alloc_merge_helper()
  */
 ObPartitionMajorMerger::ObPartitionMajorMerger()
   : rewrite_block_cnt_(0),
-    need_rewrite_block_cnt_(0)
+    need_rewrite_block_cnt_(0),
+    is_progressive_rewrite_(false)
 {
 }
 
@@ -443,6 +471,7 @@ int ObPartitionMajorMerger::open(ObTabletMergeCtx &ctx, const int64_t idx)
     data_store_desc_.sstable_index_builder_ = ctx.get_merge_info().get_index_builder();
     rewrite_block_cnt_ = 0;
     need_rewrite_block_cnt_ = 0;
+    is_progressive_rewrite_ = false;
     is_inited_ = true;
   }
 
@@ -692,9 +721,11 @@ int ObPartitionMajorMerger::try_rewrite_macro_block(const ObMacroBlockDesc &macr
   if (IS_NOT_INIT) {
       ret = OB_NOT_INIT;
       STORAGE_LOG(WARN, "ObPartitionMajorMerger is not inited", K(ret), K(*this));
+  } else if (FALSE_IT(is_progressive_rewrite_ = false)) {
   } else if (rewrite_block_cnt_ < need_rewrite_block_cnt_ &&
     merge_ctx_->need_rewrite_macro_block(macro_desc)) {
     rewrite = true;
+    is_progressive_rewrite_ = true;
     ++rewrite_block_cnt_;
   } else if (OB_FAIL(ObPartitionMerger::try_rewrite_macro_block(macro_desc, rewrite))) {
     STORAGE_LOG(WARN, "fail to try_rewrite_macro_block", K(ret));
@@ -714,8 +745,12 @@ int ObPartitionMajorMerger::rewrite_macro_block(MERGE_ITER_ARRAY &minimum_iters)
     ret = OB_ERR_UNEXPECTED;
     STORAGE_LOG(WARN, "Unexpected partition fuser", KPC(partition_fuser_), K(ret));
   } else if (FALSE_IT(iter = minimum_iters.at(0))) {
-  } else if (OB_FAIL(iter->open_curr_range(true /* rewrite */))) {
+  } else if (OB_FAIL(iter->open_curr_range(is_progressive_rewrite_ /* rewrite */))) {
     STORAGE_LOG(WARN, "Failed to open the curr macro block", K(ret));
+  } else if (nullptr == iter->get_curr_row()) {
+    // small macro block opened by the micro merge iter, its micro blocks are appended to the
+    // current macro block by merge_micro_block_iter without being decoded
+    STORAGE_LOG(DEBUG, "Rewrite macro block with micro block reuse", KPC(iter));
   } else {
     STORAGE_LOG(DEBUG, "Rewrite macro block", KPC(iter));
     // TODO maybe we need use macro_block_ctx to decide wheather the result row came from the same macro block
@@ -1040,13 +1075,28 @@ int ObPartitionMinorMerger::merge_partition(ObTabletMergeCtx &ctx, const int64_t
     STORAGE_LOG(WARN, "Failed to prepare merge partition", K(ret));
   } else {
     int64_t reuse_row_cnt = 0;
+    int64_t finished_row_cnt = 0;
     MERGE_ITER_ARRAY rowkey_minimum_iters;
 
     while (OB_SUCC(ret)) {
       share::dag_yield();
       //find minimum merge iter
       if (merge_helper.is_iter_end()) {
-        ret = OB_ITER_END;
+        // go on with the next range of the run, OB_ITER_END if the run is finished
+        if (!ctx.parallel_merge_ctx_.is_dynamic_split()) {
+          ret = OB_ITER_END;
+        } else if (OB_FAIL(merge_helper.check_iter_end())) {
+          STORAGE_LOG(WARN, "Merge range did not end normally", K(ret));
+        } else {
+          const int64_t range_row_cnt = merge_helper.get_iters_row_count();
+          if (OB_FAIL(open_next_merge_range(merge_param, merge_helper))) {
+            if (OB_ITER_END != ret) {
+              STORAGE_LOG(WARN, "Failed to open next merge range", K(ret));
+            }
+          } else {
+            finished_row_cnt += range_row_cnt;
+          }
+        }
       } else if (OB_FAIL(merge_helper.find_rowkey_minimum_iters(rowkey_minimum_iters))) {
         STORAGE_LOG(WARN, "Failed to find minimum iters", K(ret), K(merge_helper));
       } else if (rowkey_minimum_iters.empty()) {
@@ -1071,8 +1121,9 @@ int ObPartitionMinorMerger::merge_partition(ObTabletMergeCtx &ctx, const int64_t
       if (REACH_TENANT_TIME_INTERVAL(ObPartitionMergeProgress::UPDATE_INTERVAL)) {
         if (OB_NOT_NULL(merge_progress_) && (OB_SUCC(ret) || ret == OB_ITER_END)) {
           int tmp_ret = OB_SUCCESS;
-          if (OB_SUCCESS != (tmp_ret = merge_progress_->update_merge_progress(idx, reuse_row_cnt + merge_helper.get_iters_row_count(),
-            macro_writer_->get_macro_block_write_ctx().get_macro_block_count()))) {
+          if (OB_SUCCESS != (tmp_ret = merge_progress_->update_merge_progress(idx,
+              reuse_row_cnt + finished_row_cnt + merge_helper.get_iters_row_count(),
+              macro_writer_->get_macro_block_write_ctx().get_macro_block_count()))) {
             STORAGE_LOG(WARN, "failed to update merge progress", K(tmp_ret));
           }
         }
@@ -65,6 +65,9 @@ protected:
   int open_macro_writer(ObMergeParameter &merge_param);
   int prepare_merge_partition(ObMergeParameter &merge_param,
                               ObPartitionMergeHelper &merge_helper);
+  // reopen @merge_helper on the next range of the run when the ranges are split dynamically
+  int open_next_merge_range(ObMergeParameter &merge_param,
+                            ObPartitionMergeHelper &merge_helper);
   int check_row_columns(const blocksstable::ObDatumRow &row);
   int try_filter_row(const blocksstable::ObDatumRow &row, ObICompactionFilter::ObFilterRet &filter_ret);
   int get_base_iter_curr_macro_block(const blocksstable::ObMacroBlockDesc *&macro_desc);
@@ -107,6 +110,7 @@ private:
 private:
   int64_t rewrite_block_cnt_;
   int64_t need_rewrite_block_cnt_;
+  bool is_progressive_rewrite_; // progressive rewrite re-encodes every row of the macro block
 };
 
 class ObPartitionMinorMerger : public ObPartitionMerger
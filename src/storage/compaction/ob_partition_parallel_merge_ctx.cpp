@@ -32,6 +32,9 @@ ObParallelMergeCtx::ObParallelMergeCtx()
   : parallel_type_(INVALID_PARALLEL_TYPE),
     range_array_(),
     concurrent_cnt_(0),
+    task_cnt_(0),
+    run_array_(),
+    lock_(),
     allocator_("paralMergeCtx", OB_MALLOC_NORMAL_BLOCK_SIZE),
     is_inited_(false)
 {
@@ -47,6 +50,8 @@ void ObParallelMergeCtx::reset()
   parallel_type_ = INVALID_PARALLEL_TYPE;
   range_array_.reset();
   concurrent_cnt_ = 0;
+  task_cnt_ = 0;
+  run_array_.reset();
   allocator_.reset();
   is_inited_ = false;
 }
@@ -60,6 +65,8 @@ bool ObParallelMergeCtx::is_valid() const
     bret = false;
   } else if (concurrent_cnt_ > 1 && SERIALIZE_MERGE == parallel_type_) {
     bret = false;
+  } else if (task_cnt_ <= 0 || task_cnt_ > concurrent_cnt_) {
+    bret = false;
   }
   return bret;
 }
@@ -138,16 +145,103 @@ int ObParallelMergeCtx::get_merge_range(const int64_t parallel_idx, ObDatumRange
   return ret;
 }
 
+int ObParallelMergeCtx::get_next_task_idx(const int64_t task_idx, int64_t &next_task_idx) const
+{
+  int ret = OB_SUCCESS;
+  next_task_idx = -1;
+  if (!is_valid()) {
+    ret = OB_NOT_INIT;
+    STORAGE_LOG(WARN, "ObParallelMergeCtx is not inited", K(ret), K(*this));
+  } else if (OB_UNLIKELY(task_idx < 0 || task_idx >= concurrent_cnt_)) {
+    ret = OB_INVALID_ARGUMENT;
+    STORAGE_LOG(WARN, "Invalid argument to get next task idx", K(ret), K(task_idx), K_(concurrent_cnt));
+  } else if (!is_dynamic_split()) {
+    next_task_idx = task_idx + 1;
+  } else {
+    // the first ranges of the initial runs are fixed by init_range_runs
+    const int64_t next_task = (task_idx * task_cnt_ + concurrent_cnt_ - 1) / concurrent_cnt_ + 1;
+    next_task_idx = next_task * concurrent_cnt_ / task_cnt_;
+    if (next_task >= task_cnt_) {
+      next_task_idx = concurrent_cnt_;
+    }
+  }
+  if (OB_SUCC(ret) && next_task_idx >= concurrent_cnt_) {
+    ret = OB_ITER_END;
+  }
+  return ret;
+}
+
+int ObParallelMergeCtx::get_next_range_idx(const int64_t run_idx, int64_t &range_idx)
+{
+  int ret = OB_SUCCESS;
+  range_idx = -1;
+  if (!is_valid()) {
+    ret = OB_NOT_INIT;
+    STORAGE_LOG(WARN, "ObParallelMergeCtx is not inited", K(ret), K(*this));
+  } else if (OB_UNLIKELY(run_idx < 0 || run_idx >= concurrent_cnt_)) {
+    ret = OB_INVALID_ARGUMENT;
+    STORAGE_LOG(WARN, "Invalid argument to get next range idx", K(ret), K(run_idx), K_(concurrent_cnt));
+  } else if (!is_dynamic_split()) {
+    ret = OB_ITER_END;
+  } else {
+    ObSpinLockGuard guard(lock_);
+    ObMergeRangeRun &run = run_array_.at(run_idx);
+    if (run.next_idx_ >= run.end_idx_) {
+      ret = OB_ITER_END;
+    } else {
+      range_idx = run.next_idx_++;
+    }
+  }
+  return ret;
+}
+
+int ObParallelMergeCtx::steal_ranges(int64_t &run_idx)
+{
+  int ret = OB_SUCCESS;
+  if (!is_valid()) {
+    ret = OB_NOT_INIT;
+    STORAGE_LOG(WARN, "ObParallelMergeCtx is not inited", K(ret), K(*this));
+  } else if (!is_dynamic_split()) {
+    ret = OB_ITER_END;
+  } else {
+    ObSpinLockGuard guard(lock_);
+    int64_t victim_idx = -1;
+    int64_t max_left_cnt = 0;
+    for (int64_t i = 0; i < run_array_.count(); ++i) {
+      const ObMergeRangeRun &run = run_array_.at(i);
+      if (run.end_idx_ - run.next_idx_ > max_left_cnt) {
+        max_left_cnt = run.end_idx_ - run.next_idx_;
+        victim_idx = i;
+      }
+    }
+    if (victim_idx < 0) {
+      ret = OB_ITER_END;
+    } else {
+      // the victim keeps the front half, which is merged right after its current range
+      ObMergeRangeRun &victim = run_array_.at(victim_idx);
+      const int64_t split_idx = victim.next_idx_ + max_left_cnt / 2;
+      run_array_.at(split_idx) = ObMergeRangeRun(split_idx + 1, victim.end_idx_);
+      victim.end_idx_ = split_idx;
+      run_idx = split_idx;
+      STORAGE_LOG(INFO, "steal ranges of parallel merge", K(victim_idx), K(run_idx), K(max_left_cnt),
+          "end_idx", run_array_.at(split_idx).end_idx_);
+    }
+  }
+  return ret;
+}
+
 int ObParallelMergeCtx::init_serial_merge()
 {
   int ret = OB_SUCCESS;
   ObDatumRange merge_range;
   merge_range.set_whole_range();
   range_array_.reset();
+  run_array_.reset();
   if (OB_FAIL(range_array_.push_back(merge_range))) {
     STORAGE_LOG(WARN, "Failed to push back merge range to array", K(ret), K(merge_range));
   } else {
     concurrent_cnt_ = 1;
+    task_cnt_ = 1;
     parallel_type_ = SERIALIZE_MERGE;
   }
 
@@ -181,6 +275,7 @@ int ObParallelMergeCtx::init_parallel_major_merge(compaction::ObTabletMergeCtx &
       STORAGE_LOG(WARN, "Failed to get concurrent cnt from first sstable",
           K(ret), K(tablet_size), K_(concurrent_cnt));
     } else {
+      task_cnt_ = concurrent_cnt_;
       parallel_type_ = PARALLEL_MAJOR;
     }
   }
@@ -259,34 +354,33 @@ int ObParallelMergeCtx::init_parallel_mini_merge(compaction::ObTabletMergeCtx &m
       } else {
         ObArray<ObStoreRange> store_ranges;
         mini_merge_thread = MAX(mini_merge_thread, PARALLEL_MERGE_TARGET_TASK_CNT);
-        concurrent_cnt_ = MIN((total_bytes + tablet_size - 1) / tablet_size, mini_merge_thread);
-        if (concurrent_cnt_ <= 1) {
+        const int64_t task_cnt = MIN((total_bytes + tablet_size - 1) / tablet_size, mini_merge_thread);
+        concurrent_cnt_ = MIN(task_cnt * RANGE_CNT_PER_TASK, MAX_DYNAMIC_RANGE_CNT);
+        if (task_cnt > 1
+            && OB_FAIL(memtable->get_split_ranges(nullptr, nullptr, concurrent_cnt_, store_ranges))
+            && OB_ENTRY_NOT_EXIST == ret) {
+          // too few keys to split into fine grained ranges, one range for each task
+          store_ranges.reset();
+          concurrent_cnt_ = task_cnt;
+          ret = memtable->get_split_ranges(nullptr, nullptr, concurrent_cnt_, store_ranges);
+        }
+        if (task_cnt <= 1 || OB_ENTRY_NOT_EXIST == ret) {
           if (OB_FAIL(init_serial_merge())) {
             STORAGE_LOG(WARN, "Failed to init serialize merge", K(ret));
           }
-        } else if (OB_FAIL(memtable->get_split_ranges(nullptr, nullptr, concurrent_cnt_, store_ranges))) {
-          if (OB_ENTRY_NOT_EXIST == ret) {
-            if (OB_FAIL(init_serial_merge())) {
-              STORAGE_LOG(WARN, "Failed to init serialize merge", K(ret));
-            }
-          } else {
-            STORAGE_LOG(WARN, "Failed to get split ranges from memtable", K(ret));
-          }
+        } else if (OB_FAIL(ret)) {
+          STORAGE_LOG(WARN, "Failed to get split ranges from memtable", K(ret));
         } else if (OB_UNLIKELY(store_ranges.count() != concurrent_cnt_)) {
           ret = OB_ERR_UNEXPECTED;
           STORAGE_LOG(WARN, "Unexpected range array and concurrent_cnt", K(ret), K_(concurrent_cnt),
                       K(store_ranges));
+        } else if (OB_FAIL(init_range_array(store_ranges))) {
+          STORAGE_LOG(WARN, "Failed to init range array", K(ret));
+        } else if (OB_FAIL(init_range_runs(task_cnt))) {
+          STORAGE_LOG(WARN, "Failed to init range runs", K(ret), K(task_cnt));
         } else {
-          for (int64_t i = 0; OB_SUCC(ret) && i < store_ranges.count(); i++) {
-            ObDatumRange datum_range;
-            if (OB_FAIL(datum_range.from_range(store_ranges.at(i), allocator_))) {
-              STORAGE_LOG(WARN, "Failed to transfer store range to datum range", K(ret), K(i), K(store_ranges.at(i)));
-            } else if (OB_FAIL(range_array_.push_back(datum_range))) {
-              STORAGE_LOG(WARN, "Failed to push back merge range to array", K(ret), K(datum_range));
-            }
-          }
           parallel_type_ = PARALLEL_MINI;
-          STORAGE_LOG(INFO, "Succ to get parallel mini merge ranges", K_(concurrent_cnt), K_(range_array));
+          STORAGE_LOG(INFO, "Succ to get parallel mini merge ranges", K_(concurrent_cnt), K_(task_cnt), K_(range_array));
         }
       }
     }
@@ -310,6 +404,7 @@ int ObParallelMergeCtx::init_parallel_mini_minor_merge(compaction::ObTabletMerge
     ObSEArray<ObStoreRange, 16> store_ranges;
     ObPartitionRangeSpliter range_spliter;
     ObStoreRange whole_range;
+    int64_t task_cnt = 0;
     whole_range.set_whole_range();
     if (OB_FAIL(merge_ctx.tables_handle_.get_all_minor_sstables(tables))) {
       STORAGE_LOG(WARN, "Failed to get all sstables from merge ctx", K(ret), K(merge_ctx));
@@ -329,6 +424,9 @@ int ObParallelMergeCtx::init_parallel_mini_minor_merge(compaction::ObTabletMerge
       if (OB_FAIL(init_serial_merge())) {
         STORAGE_LOG(WARN, "Failed to init serialize merge", K(ret));
       }
+    } else if (FALSE_IT(task_cnt = range_info.parallel_target_count_)) {
+    } else if (FALSE_IT(range_info.parallel_target_count_ =
+        MIN(task_cnt * RANGE_CNT_PER_TASK, MAX_DYNAMIC_RANGE_CNT))) {
     } else if (OB_FAIL(range_spliter.split_ranges(range_info, allocator_, true, store_ranges))) {
       STORAGE_LOG(WARN, "Failed to split parallel ranges", K(ret));
     } else if (OB_UNLIKELY(store_ranges.count() <= 1)) {
@@ -339,19 +437,54 @@ int ObParallelMergeCtx::init_parallel_mini_minor_merge(compaction::ObTabletMerge
       } else {
         STORAGE_LOG(INFO, "parallel minor merge back to serialize merge");
       }
+    } else if (FALSE_IT(concurrent_cnt_ = store_ranges.count())) {
+    } else if (OB_FAIL(init_range_array(store_ranges))) {
+      STORAGE_LOG(WARN, "Failed to init range array", K(ret));
+    } else if (OB_FAIL(init_range_runs(MIN(task_cnt, concurrent_cnt_)))) {
+      STORAGE_LOG(WARN, "Failed to init range runs", K(ret), K(task_cnt));
     } else {
-      concurrent_cnt_ = store_ranges.count();
       parallel_type_ = PARALLEL_MINI_MINOR;
-      for (int64_t i = 0; OB_SUCC(ret) && i < store_ranges.count(); i++) {
-        ObDatumRange datum_range;
-        if (OB_FAIL(datum_range.from_range(store_ranges.at(i), allocator_))) {
-          STORAGE_LOG(WARN, "Failed to transfer store range to datum range", K(ret), K(i), K(store_ranges.at(i)));
-        } else if (OB_FAIL(range_array_.push_back(datum_range))) {
-          STORAGE_LOG(WARN, "Failed to push back merge range to array", K(ret), K(datum_range));
-        }
-      }
-      STORAGE_LOG(INFO, "Succ to get parallel mini minor merge ranges", K_(concurrent_cnt), K_(range_array));
+      STORAGE_LOG(INFO, "Succ to get parallel mini minor merge ranges", K_(concurrent_cnt), K_(task_cnt), K_(range_array));
+    }
+  }
+  return ret;
+}
+
+int ObParallelMergeCtx::init_range_array(const ObIArray<ObStoreRange> &store_ranges)
+{
+  int ret = OB_SUCCESS;
+  for (int64_t i = 0; OB_SUCC(ret) && i < store_ranges.count(); i++) {
+    ObDatumRange datum_range;
+    if (OB_FAIL(datum_range.from_range(store_ranges.at(i), allocator_))) {
+      STORAGE_LOG(WARN, "Failed to transfer store range to datum range", K(ret), K(i), K(store_ranges.at(i)));
+    } else if (OB_FAIL(range_array_.push_back(datum_range))) {
+      STORAGE_LOG(WARN, "Failed to push back merge range to array", K(ret), K(datum_range));
+    }
+  }
+  return ret;
+}
+
+int ObParallelMergeCtx::init_range_runs(const int64_t task_cnt)
+{
+  int ret = OB_SUCCESS;
+  run_array_.reset();
+  if (OB_UNLIKELY(task_cnt <= 0 || task_cnt > concurrent_cnt_ || range_array_.count() != concurrent_cnt_)) {
+    ret = OB_INVALID_ARGUMENT;
+    STORAGE_LOG(WARN, "Invalid argument to init range runs", K(ret), K(task_cnt), K_(concurrent_cnt),
+        K(range_array_.count()));
+  } else if (task_cnt == concurrent_cnt_) {
+    // one range for each task, nothing to steal
+    task_cnt_ = task_cnt;
+  } else if (OB_FAIL(run_array_.prepare_allocate(concurrent_cnt_))) {
+    STORAGE_LOG(WARN, "Failed to prepare allocate run array", K(ret), K_(concurrent_cnt));
+  } else {
+    // task i starts with ranges [i * cnt / task_cnt, (i + 1) * cnt / task_cnt), the first one claimed
+    for (int64_t i = 0; i < task_cnt; ++i) {
+      const int64_t start_idx = i * concurrent_cnt_ / task_cnt;
+      const int64_t end_idx = (i + 1) * concurrent_cnt_ / task_cnt;
+      run_array_.at(start_idx) = ObMergeRangeRun(start_idx + 1, end_idx);
     }
+    task_cnt_ = task_cnt;
   }
   return ret;
 }
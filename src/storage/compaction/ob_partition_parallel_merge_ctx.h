@@ -16,6 +16,7 @@
 #include "storage/ob_storage_struct.h"
 #include "lib/utility/ob_print_utils.h"
 #include "lib/container/ob_heap.h"
+#include "lib/lock/ob_spin_lock.h"
 #include "common/rowkey/ob_rowkey.h"
 #include "storage/blocksstable/ob_datum_range.h"
 
@@ -34,10 +35,18 @@ class ObSSTable;
 namespace storage
 {
 
+// Parallel mini/minor merge splits the merge range into RANGE_CNT_PER_TASK times more ranges
+// than merge tasks, and each task starts with a run of contiguous ranges which it merges in
+// order into one output. A task which finishes its run takes the back half of the ranges not
+// started yet from the largest run left, so a skewed range does not keep the rest of the dag
+// waiting. The output of a run is indexed by its first range, the index builder stitches the
+// outputs in key order.
 class ObParallelMergeCtx
 {
 public:
   static const int64_t MAX_MERGE_THREAD = 64;
+  static const int64_t RANGE_CNT_PER_TASK = 4;
+  static const int64_t MAX_DYNAMIC_RANGE_CNT = 512;
   enum ParallelMergeType {
     PARALLEL_MAJOR = 0,
     PARALLEL_MINI = 1,
@@ -51,9 +60,24 @@ public:
   bool is_valid() const;
   int init(compaction::ObTabletMergeCtx &merge_ctx);
   OB_INLINE int64_t get_concurrent_cnt() const { return concurrent_cnt_; }
+  OB_INLINE bool is_dynamic_split() const { return !run_array_.empty(); }
   int get_merge_range(const int64_t parallel_idx, blocksstable::ObDatumRange &merge_range);
-  TO_STRING_KV(K_(parallel_type), K_(range_array), K_(concurrent_cnt), K_(is_inited));
+  // the first range of the run of the merge task after @task_idx
+  int get_next_task_idx(const int64_t task_idx, int64_t &next_task_idx) const;
+  // claim the next range of the run started at @run_idx, OB_ITER_END if the run is finished
+  int get_next_range_idx(const int64_t run_idx, int64_t &range_idx);
+  // split the largest run left, @run_idx is set to the first range of the stolen ranges
+  int steal_ranges(int64_t &run_idx);
+  TO_STRING_KV(K_(parallel_type), K_(range_array), K_(concurrent_cnt), K_(task_cnt), K_(is_inited));
 private:
+  struct ObMergeRangeRun
+  {
+    ObMergeRangeRun() : next_idx_(0), end_idx_(0) {}
+    ObMergeRangeRun(const int64_t next_idx, const int64_t end_idx) : next_idx_(next_idx), end_idx_(end_idx) {}
+    TO_STRING_KV(K_(next_idx), K_(end_idx));
+    int64_t next_idx_; // ranges before next_idx_ have been claimed
+    int64_t end_idx_;
+  };
   static const int64_t MIN_PARALLEL_MINI_MINOR_MERGE_THREASHOLD = 2;
   static const int64_t MIN_PARALLEL_MERGE_BLOCKS = 32;
   static const int64_t PARALLEL_MERGE_TARGET_TASK_CNT = 20;
@@ -75,10 +99,16 @@ private:
       const blocksstable::ObSSTable *first_major_sstable,
       const int64_t tablet_size,
       const ObTableReadInfo &index_read_info);
+  int init_range_array(const common::ObIArray<ObStoreRange> &store_ranges);
+  int init_range_runs(const int64_t task_cnt);
 private:
   ParallelMergeType parallel_type_;
   common::ObSEArray<blocksstable::ObDatumRange, 16> range_array_;
   int64_t concurrent_cnt_;
+  int64_t task_cnt_;
+  // indexed by the first range of each run, empty if the ranges are not split dynamically
+  common::ObSEArray<ObMergeRangeRun, 16> run_array_;
+  common::ObSpinLock lock_;
   common::ObArenaAllocator allocator_;
   bool is_inited_;
 };
@@ -524,6 +524,7 @@ ObTabletMergeCtx::ObTabletMergeCtx(
     merge_dag_(nullptr),
     merge_progress_(nullptr),
     compaction_filter_(nullptr),
+    ttl_filter_(),
     time_guard_(),
     rebuild_seq_(-1)
 {
@@ -692,6 +693,155 @@ int ObTabletMergeCtx::inner_init_for_major()
   } else if (OB_FAIL(cal_major_merge_param(get_merge_table_result))) {
     LOG_WARN("fail to cal minor merge param", K(ret), KPC(this));
   } else if (FALSE_IT(time_guard_.click(ObCompactionTimeGuard::CALC_PROGRESSIVE_PARAM))) {
+  } else if (OB_FAIL(init_ttl_filter())) {
+    LOG_WARN("fail to init ttl filter", K(ret), KPC(this));
+  }
+  return ret;
+}
+
+// Expired rows are only removed by major merge. Minor merge keeps them, as removing the
+// newest version of a row from a minor sstable would expose its older versions.
+int ObTabletMergeCtx::init_ttl_filter()
+{
+  int ret = OB_SUCCESS;
+  const ObTableSchema *table_schema = schema_ctx_.table_schema_;
+  uint64_t ttl_column_id = OB_INVALID_ID;
+  ObTableTTLParam ttl_param;
+  bool has_expired_base_row = false;
+  ObSEArray<ObColDesc, OB_ROW_DEFAULT_COLUMNS_COUNT> col_descs;
+  if (OB_ISNULL(table_schema) || table_schema->get_expire_info().empty()) {
+    // no ttl
+  } else if (OB_ISNULL(schema_ctx_.merge_schema_)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("merge schema is null", K(ret));
+  } else if (OB_FAIL(ObTableTTLParam::get_ttl_column(*table_schema, ttl_column_id, ttl_param.ttl_us_))) {
+    LOG_WARN("failed to get ttl column", K(ret), K(table_schema->get_expire_info()));
+  } else if (OB_FAIL(schema_ctx_.merge_schema_->get_multi_version_column_descs(col_descs))) {
+    LOG_WARN("failed to get multi version column descs", K(ret));
+  } else {
+    for (int64_t i = 0; OB_INVALID_INDEX == ttl_param.col_idx_ && i < col_descs.count(); ++i) {
+      if (ttl_column_id == col_descs.at(i).col_id_) {
+        ttl_param.col_idx_ = i;
+      }
+    }
+    // rows merged row by row are always filtered, the reused blocks of the base sstable are only
+    // rewritten when some of their rows are expired
+    if (!is_full_merge_
+        && OB_FAIL(check_base_row_expired(ttl_param, col_descs, has_expired_base_row))) {
+      LOG_WARN("failed to check expired rows in base sstable", K(ret), K(ttl_param));
+    } else if (OB_FAIL(ttl_filter_.init(ttl_param, sstable_version_range_.snapshot_version_,
+        has_expired_base_row))) {
+      LOG_WARN("failed to init ttl filter", K(ret), K(ttl_param), K_(sstable_version_range));
+    } else {
+      compaction_filter_ = &ttl_filter_;
+      FLOG_INFO("init ttl filter for major merge", K(ttl_param), K_(sstable_version_range),
+          K(has_expired_base_row), "tablet_id", param_.tablet_id_);
+    }
+  }
+  return ret;
+}
+
+// Scan the rowkey and ttl columns of the base major sstable until the first row expired at the
+// major snapshot. Every replica scans the same sstable and gets the same result.
+int ObTabletMergeCtx::check_base_row_expired(
+    const ObTableTTLParam &ttl_param,
+    const ObIArray<ObColDesc> &col_descs,
+    bool &has_expired)
+{
+  int ret = OB_SUCCESS;
+  ObSSTable *base_sstable = nullptr;
+  has_expired = false;
+  if (OB_UNLIKELY(!ttl_param.is_valid() || ttl_param.col_idx_ >= col_descs.count())) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid argument", K(ret), K(ttl_param), K(col_descs));
+  } else if (tables_handle_.empty() || !tables_handle_.get_table(0)->is_major_sstable()) {
+    // no base sstable
+  } else if (FALSE_IT(base_sstable = static_cast<ObSSTable *>(tables_handle_.get_table(0)))) {
+  } else if (base_sstable->get_meta().is_empty()) {
+  } else {
+    const int64_t schema_rowkey_cnt = schema_ctx_.merge_schema_->get_rowkey_column_num();
+    const int64_t extra_rowkey_cnt = ObMultiVersionRowkeyHelpper::get_extra_rowkey_col_cnt();
+    ObArenaAllocator allocator("TTLCheck", OB_MALLOC_NORMAL_BLOCK_SIZE, MTL_ID());
+    ObSEArray<ObColDesc, OB_ROW_DEFAULT_COLUMNS_COUNT> read_col_descs;
+    ObSEArray<int32_t, OB_ROW_DEFAULT_COLUMNS_COUNT> read_cols_index;
+    ObTableReadInfo read_info;
+    ObTableAccessParam access_param;
+    ObTableAccessContext access_ctx;
+    ObStoreCtx store_ctx;
+    ObDatumRange range;
+    ObStoreRowIterator *row_iter = nullptr;
+    const ObDatumRow *row = nullptr;
+    int64_t ttl_datum_idx = ttl_param.col_idx_;
+    SCN snapshot_scn;
+    ObQueryFlag query_flag(ObQueryFlag::Forward,
+                           true  /*daily_merge*/,
+                           true  /*optimize*/,
+                           true  /*whole_macro_scan*/,
+                           false /*full_row*/,
+                           false /*index_back*/,
+                           false /*query_stat*/);
+    range.set_whole_range();
+    for (int32_t i = 0; OB_SUCC(ret) && i < schema_rowkey_cnt; ++i) {
+      if (OB_FAIL(read_col_descs.push_back(col_descs.at(i)))) {
+        LOG_WARN("failed to push back col desc", K(ret), K(i));
+      } else if (OB_FAIL(read_cols_index.push_back(i))) {
+        LOG_WARN("failed to push back col index", K(ret), K(i));
+      }
+    }
+    if (OB_FAIL(ret) || ttl_param.col_idx_ < schema_rowkey_cnt) {
+      // the ttl column is a rowkey column
+    } else if (OB_FAIL(read_col_descs.push_back(col_descs.at(ttl_param.col_idx_)))) {
+      LOG_WARN("failed to push back ttl col desc", K(ret), K(ttl_param));
+    } else if (OB_FAIL(read_cols_index.push_back(
+        static_cast<int32_t>(ttl_param.col_idx_ - extra_rowkey_cnt)))) {
+      LOG_WARN("failed to push back ttl col index", K(ret), K(ttl_param));
+    } else {
+      ttl_datum_idx = schema_rowkey_cnt;
+    }
+
+    if (OB_FAIL(ret)) {
+    } else if (OB_FAIL(read_info.init(allocator,
+                                      schema_ctx_.merge_schema_->get_column_count(),
+                                      schema_rowkey_cnt,
+                                      lib::is_oracle_mode(),
+                                      read_col_descs,
+                                      false,
+                                      &read_cols_index))) {
+      LOG_WARN("failed to init read info", K(ret), K(read_col_descs));
+    } else if (OB_FAIL(access_param.init_merge_param(param_.tablet_id_.id(), param_.tablet_id_, read_info))) {
+      LOG_WARN("failed to init access param", K(ret));
+    } else if (OB_FAIL(snapshot_scn.convert_for_tx(base_sstable->get_snapshot_version()))) {
+      LOG_WARN("failed to convert snapshot", K(ret), KPC(base_sstable));
+    } else if (OB_FAIL(store_ctx.init_for_read(param_.ls_id_, INT64_MAX, -1, snapshot_scn))) {
+      LOG_WARN("failed to init store ctx", K(ret), K_(param));
+    } else if (OB_FAIL(access_ctx.init(query_flag, store_ctx, allocator, allocator, sstable_version_range_))) {
+      LOG_WARN("failed to init access context", K(ret), K(query_flag));
+    } else if (OB_FAIL(base_sstable->scan(access_param.iter_param_, access_ctx, range, row_iter))) {
+      LOG_WARN("failed to scan base sstable", K(ret), KPC(base_sstable));
+    } else if (OB_ISNULL(row_iter)) {
+      ret = OB_ERR_UNEXPECTED;
+      LOG_WARN("row iter is null", K(ret));
+    }
+    while (OB_SUCC(ret) && !has_expired) {
+      if (OB_FAIL(row_iter->get_next_row(row))) {
+        if (OB_ITER_END != ret) {
+          LOG_WARN("failed to get next row", K(ret));
+        }
+      } else if (OB_UNLIKELY(row->count_ <= ttl_datum_idx)) {
+        ret = OB_ERR_UNEXPECTED;
+        LOG_WARN("ttl column not in row", K(ret), KPC(row), K(ttl_datum_idx));
+      } else {
+        has_expired = ttl_param.is_expired(row->storage_datums_[ttl_datum_idx],
+                                           sstable_version_range_.snapshot_version_);
+      }
+    }
+    if (OB_ITER_END == ret) {
+      ret = OB_SUCCESS;
+    }
+    if (nullptr != row_iter) {
+      row_iter->~ObStoreRowIterator();
+      row_iter = nullptr;
+    }
   }
   return ret;
 }
@@ -1248,6 +1398,14 @@ void ObTabletMergeCtx::collect_running_info()
   if (OB_TMP_FAIL(MTL(storage::ObTenantSSTableMergeInfoMgr*)->add_sstable_merge_info(sstable_merge_info))) {
     LOG_WARN("failed to add sstable merge info ", K(tmp_ret), K(sstable_merge_info));
   }
+
+  if (tablet_handle_.is_valid()) {
+    const ObCompactionWriteStat::PolicyType policy_type =
+        ObPartitionMergePolicy::is_tiered_compaction(*tablet_handle_.get_obj()) ?
+            ObCompactionWriteStat::TIERED : ObCompactionWriteStat::LEVELED;
+    MTL(ObTenantDagScheduler *)->add_compaction_write_bytes(
+        policy_type, is_mini_merge(param_.merge_type_), sstable_merge_info.new_flush_occupy_size_);
+  }
 }
 
 } // namespace compaction
@@ -18,6 +18,7 @@
 #include "ob_partition_parallel_merge_ctx.h"
 #include "storage/compaction/ob_partition_merger.h"
 #include "storage/compaction/ob_partition_merge_progress.h"
+#include "storage/compaction/ob_i_compaction_filter.h"
 #include "storage/compaction/ob_tablet_merge_task.h"
 #include "storage/tx_storage/ob_ls_map.h"
 #include "storage/tx_storage/ob_ls_handle.h"
@@ -181,6 +182,11 @@ struct ObTabletMergeCtx
   int get_basic_info_from_result(const ObGetMergeTablesResult &get_merge_table_result);
   int cal_minor_merge_param();
   int cal_major_merge_param(const ObGetMergeTablesResult &get_merge_table_result);
+  int init_ttl_filter();
+  int check_base_row_expired(
+      const share::schema::ObTableTTLParam &ttl_param,
+      const common::ObIArray<share::schema::ObColDesc> &col_descs,
+      bool &has_expired);
   int init_merge_info();
   int cal_progressive_merge_param(const bool is_schema_changed);
   int generate_participant_table_info(char *buf, const int64_t buf_len) const;
@@ -241,6 +247,7 @@ struct ObTabletMergeCtx
   ObBasicTabletMergeDag *merge_dag_;
   compaction::ObPartitionMergeProgress *merge_progress_;
   compaction::ObICompactionFilter *compaction_filter_;
+  compaction::ObTTLCompactionFilter ttl_filter_; // used by major merge of the tables with expire info
   ObCompactionTimeGuard time_guard_;
   int64_t rebuild_seq_;
 
@@ -1180,11 +1180,14 @@ int ObTabletMergeTask::generate_next_task(ObITask *&next_task)
 {
   int ret = OB_SUCCESS;
 
+  int64_t next_idx = 0;
   if (!is_inited_) {
     ret = OB_NOT_INIT;
     LOG_WARN("not init", K(ret));
-  } else if (idx_ + 1 == ctx_->get_concurrent_cnt()) {
-    ret = OB_ITER_END;
+  } else if (OB_FAIL(ctx_->parallel_merge_ctx_.get_next_task_idx(idx_, next_idx))) {
+    if (OB_ITER_END != ret) {
+      LOG_WARN("failed to get next task idx", K(ret), K_(idx));
+    }
   } else if (!is_merge_dag(dag_->get_type())) {
     ret = OB_ERR_SYS;
     LOG_ERROR("dag type not match", K(ret), KPC(dag_));
@@ -1194,7 +1197,7 @@ int ObTabletMergeTask::generate_next_task(ObITask *&next_task)
 
     if (OB_FAIL(merge_dag->alloc_task(merge_task))) {
       LOG_WARN("fail to alloc task", K(ret));
-    } else if (OB_FAIL(merge_task->init(idx_ + 1, *ctx_))) {
+    } else if (OB_FAIL(merge_task->init(next_idx, *ctx_))) {
       LOG_WARN("fail to init task", K(ret));
     } else {
       next_task = merge_task;
@@ -1223,12 +1226,26 @@ int ObTabletMergeTask::process()
     ret = OB_ERR_SYS;
     STORAGE_LOG(WARN, "Unexpected null partition merger", K(ret));
   } else {
-    if (OB_FAIL(merger_->merge_partition(*ctx_, idx_))) {
-      STORAGE_LOG(WARN, "failed to merge partition", K(ret));
-    } else {
-      FLOG_INFO("merge macro blocks ok", K(idx_), "task", *this);
+    // when the ranges are split dynamically, go on with the ranges stolen from other tasks
+    int64_t run_idx = idx_;
+    bool finished = false;
+    while (OB_SUCC(ret) && !finished) {
+      if (OB_FAIL(merger_->merge_partition(*ctx_, run_idx))) {
+        STORAGE_LOG(WARN, "failed to merge partition", K(ret), K(run_idx));
+      } else {
+        FLOG_INFO("merge macro blocks ok", K(idx_), K(run_idx), "task", *this);
+      }
+      merger_->reset();
+      if (OB_FAIL(ret)) {
+      } else if (OB_FAIL(ctx_->parallel_merge_ctx_.steal_ranges(run_idx))) {
+        if (OB_ITER_END == ret) {
+          ret = OB_SUCCESS;
+          finished = true;
+        } else {
+          STORAGE_LOG(WARN, "failed to steal merge ranges", K(ret), K(idx_));
+        }
+      }
     }
-    merger_->reset();
   }
 
   if (OB_FAIL(ret)) {
@@ -132,6 +132,14 @@ void ObTenantTabletScheduler::SSTableGCTask::runTimerTask()
   LOG_INFO("SSTableGCTask", K(cost_ts));
 }
 
+void ObTenantTabletScheduler::CompactionGovernorTask::runTimerTask()
+{
+  int ret = OB_SUCCESS;
+  if (OB_FAIL(MTL(ObTenantTabletScheduler *)->get_compaction_governor().adjust())) {
+    LOG_WARN("Fail to adjust compaction throttle", K(ret));
+  }
+}
+
 constexpr ObMergeType ObTenantTabletScheduler::MERGE_TYPES[];
 
 ObTenantTabletScheduler::ObTenantTabletScheduler()
@@ -140,6 +148,7 @@ ObTenantTabletScheduler::ObTenantTabletScheduler()
    is_stop_(true),
    merge_loop_tg_id_(0),
    sstable_gc_tg_id_(0),
+   compaction_governor_tg_id_(0),
    schedule_interval_(0),
    bf_queue_(),
    frozen_version_lock_(),
@@ -148,7 +157,9 @@ ObTenantTabletScheduler::ObTenantTabletScheduler()
    schedule_stats_(),
    merge_loop_task_(),
    sstable_gc_task_(),
-   fast_freeze_checker_()
+   compaction_governor_task_(),
+   fast_freeze_checker_(),
+   compaction_governor_()
 {
   STATIC_ASSERT(static_cast<int64_t>(NO_MAJOR_MERGE_TYPE_CNT) == ARRAYSIZEOF(MERGE_TYPES), "merge type array len is mismatch");
 }
@@ -164,13 +175,16 @@ void ObTenantTabletScheduler::destroy()
   wait();
   TG_DESTROY(merge_loop_tg_id_);
   TG_DESTROY(sstable_gc_tg_id_);
+  TG_DESTROY(compaction_governor_tg_id_);
   bf_queue_.destroy();
   frozen_version_ = 0;
   merged_version_ = 0;
   schedule_stats_.reset();
   merge_loop_tg_id_ = 0;
   sstable_gc_tg_id_ = 0;
+  compaction_governor_tg_id_ = 0;
   schedule_interval_ = 0;
+  compaction_governor_.reset();
   is_inited_ = false;
   LOG_INFO("The ObTenantTabletScheduler destroy");
 }
@@ -184,6 +198,7 @@ int ObTenantTabletScheduler::init()
     if (tenant_config.is_valid()) {
       schedule_interval = tenant_config->ob_compaction_schedule_interval;
       fast_freeze_checker_.reload_config(tenant_config->_ob_enable_fast_freeze);
+      compaction_governor_.reload_config(tenant_config->_compaction_throttle_target_rt);
     }
   } // end of ObTenantConfigGuard
   if (IS_INIT) {
@@ -227,6 +242,13 @@ int ObTenantTabletScheduler::start()
     LOG_WARN("failed to start sstable gc thread", K(ret));
   } else if (OB_FAIL(TG_SCHEDULE(sstable_gc_tg_id_, sstable_gc_task_, SSTABLE_GC_INTERVAL, repeat))) {
     LOG_WARN("Fail to schedule sstable gc task", K(ret));
+  } else if (OB_FAIL(TG_CREATE_TENANT(lib::TGDefIDs::CompactionGovernor, compaction_governor_tg_id_))) {
+    LOG_WARN("failed to create compaction governor thread", K(ret));
+  } else if (OB_FAIL(TG_START(compaction_governor_tg_id_))) {
+    LOG_WARN("failed to start compaction governor thread", K(ret));
+  } else if (OB_FAIL(TG_SCHEDULE(compaction_governor_tg_id_, compaction_governor_task_,
+      ObCompactionGovernor::ADJUST_INTERVAL, repeat))) {
+    LOG_WARN("Fail to schedule compaction governor task", K(ret));
   }
   return ret;
 }
@@ -240,6 +262,7 @@ int ObTenantTabletScheduler::reload_tenant_config()
     if (tenant_config.is_valid()) {
       merge_schedule_interval = tenant_config->ob_compaction_schedule_interval;
       fast_freeze_checker_.reload_config(tenant_config->_ob_enable_fast_freeze);
+      compaction_governor_.reload_config(tenant_config->_compaction_throttle_target_rt);
     }
   } // end of ObTenantConfigGuard
   if (IS_NOT_INIT) {
@@ -265,6 +288,7 @@ void ObTenantTabletScheduler::stop()
   is_stop_ = true;
   TG_STOP(merge_loop_tg_id_);
   TG_STOP(sstable_gc_tg_id_);
+  TG_STOP(compaction_governor_tg_id_);
   stop_major_merge();
 }
 
@@ -272,6 +296,7 @@ void ObTenantTabletScheduler::wait()
 {
   TG_WAIT(merge_loop_tg_id_);
   TG_WAIT(sstable_gc_tg_id_);
+  TG_WAIT(compaction_governor_tg_id_);
 }
 
 int ObTenantTabletScheduler::try_remove_old_table(ObLS &ls)
@@ -17,6 +17,7 @@
 #include "lib/queue/ob_dedup_queue.h"
 #include "share/ob_ls_id.h"
 #include "storage/ob_i_store.h"
+#include "storage/compaction/ob_compaction_governor.h"
 
 namespace oceanbase
 {
@@ -109,6 +110,7 @@ public:
   int64_t get_frozen_version() const;
   int64_t get_merged_version() const { return merged_version_; }
   int64_t get_bf_queue_size() const { return bf_queue_.task_count(); }
+  compaction::ObCompactionGovernor &get_compaction_governor() { return compaction_governor_; }
   int merge_all();
   int schedule_merge(const int64_t broadcast_version);
   int update_upper_trans_version_and_gc_sstable();
@@ -174,6 +176,13 @@ private:
     virtual ~SSTableGCTask() = default;
     virtual void runTimerTask() override;
   };
+  class CompactionGovernorTask : public common::ObTimerTask
+  {
+  public:
+    CompactionGovernorTask() = default;
+    virtual ~CompactionGovernorTask() = default;
+    virtual void runTimerTask() override;
+  };
 public:
   static const int64_t INIT_COMPACTION_SCN = 1;
 
@@ -199,6 +208,7 @@ private:
   bool is_stop_;
   int merge_loop_tg_id_; // thread
   int sstable_gc_tg_id_; // thread
+  int compaction_governor_tg_id_; // thread
   int64_t schedule_interval_;
 
   common::ObDedupQueue bf_queue_;
@@ -208,7 +218,9 @@ private:
   ObScheduleStatistics schedule_stats_;
   MergeLoopTask merge_loop_task_;
   SSTableGCTask sstable_gc_task_;
+  CompactionGovernorTask compaction_governor_task_;
   ObFastFreezeChecker fast_freeze_checker_;
+  compaction::ObCompactionGovernor compaction_governor_;
 };
 
 } // namespace storage
@@ -26,6 +26,7 @@
 #include "share/ob_disk_usage_table_operator.h"
 #include "share/ob_rpc_struct.h"
 #include "share/rc/ob_tenant_base.h"
+#include "share/schema/ob_table_dml_param.h"
 #include "share/schema/ob_table_param.h"
 #include "share/schema/ob_tenant_schema_service.h"
 #include "share/ob_ddl_common.h"
@@ -2303,7 +2304,14 @@ int ObLSTabletService::insert_row(
                                     duplicated_rows))) {
       LOG_WARN("failed to get conflict row(s)", K(ret), K(duplicated_column_ids), K(row));
       } else if (nullptr == duplicated_rows) {
-        if (OB_FAIL(insert_row_to_tablet(tablet_handle, run_ctx, tbl_row))) {
+        bool is_duplicate = false;
+        if (data_table.get_schema_param()->get_ttl_param().is_valid()
+            && OB_FAIL(check_expired_row_conflict(tablet_handle, run_ctx, tbl_row, is_duplicate))) {
+          LOG_WARN("failed to check expired row conflict", K(ret), K(row));
+        } else if (OB_UNLIKELY(is_duplicate)) {
+          ret = OB_ERR_PRIMARY_KEY_DUPLICATE;
+          LOG_WARN("rowkey already exists", K(ret), K(row));
+        } else if (OB_FAIL(insert_row_to_tablet(tablet_handle, run_ctx, tbl_row))) {
           if (OB_TRY_LOCK_ROW_CONFLICT != ret) {
             LOG_WARN("failed to write row", K(ret));
           }
@@ -3420,12 +3428,31 @@ int ObLSTabletService::insert_tablet_rows(
 {
   int ret = OB_SUCCESS;
   ObRelativeTable &table = run_ctx.relative_table_;
+  ObDatumRowkeyHelper rowkey_helper(run_ctx.allocator_); // holds the duplicate rowkey of ttl table
   bool exists = false;
   const bool check_exists = !table.is_storage_index_table()
                             || table.is_unique_index();
   if (check_exists && OB_FAIL(tablet_handle.get_obj()->rowkeys_exists(
       run_ctx.store_ctx_, table, rows_info, exists))) {
     LOG_WARN("fail to check the existence of rows", K(ret), K(rows_info), K(exists));
+  } else if (exists && table.get_schema_param()->get_ttl_param().is_valid()) {
+    // the existing rows may be expired, check every row again
+    exists = false;
+    for (int64_t k = 0; OB_SUCC(ret) && !exists && k < row_count; k++) {
+      ObStoreRowkey rowkey;
+      if (OB_FAIL(check_expired_row_conflict(tablet_handle, run_ctx, rows[k], exists))) {
+        LOG_WARN("failed to check expired row conflict", K(ret), K(rows[k]));
+      } else if (!exists) {
+      } else if (OB_FAIL(rowkey.assign(rows[k].row_val_.cells_, table.get_rowkey_column_num()))) {
+        LOG_WARN("failed to assign rowkey", K(ret), K(rows[k]));
+      } else if (OB_FAIL(rowkey_helper.convert_datum_rowkey(rowkey.get_rowkey(),
+          rows_info.get_duplicate_rowkey()))) {
+        LOG_WARN("failed to transfer datum rowkey", K(ret), K(rowkey));
+      } else {
+        ret = OB_ERR_PRIMARY_KEY_DUPLICATE;
+        LOG_WARN("rowkeys already exist", K(ret), K(table), K(rows[k]));
+      }
+    }
   } else if (exists) {
     ret = OB_ERR_PRIMARY_KEY_DUPLICATE;
     LOG_WARN("rowkeys already exist", K(ret), K(table), K(rows_info));
@@ -4600,6 +4627,56 @@ int ObLSTabletService::insert_row_to_tablet(
   return ret;
 }
 
+// Rows expired at the snapshot of the dml are masked by reads, but stay in memtables and
+// sstables until the next major merge removes them. A new row with the rowkey of an expired
+// row overwrites it: the row is written as an update of all columns, as the memtable rejects
+// an insert over a committed row.
+int ObLSTabletService::check_expired_row_conflict(
+    ObTabletHandle &tablet_handle,
+    ObDMLRunningCtx &run_ctx,
+    ObStoreRow &tbl_row,
+    bool &is_duplicate)
+{
+  int ret = OB_SUCCESS;
+  ObRelativeTable &data_table = run_ctx.relative_table_;
+  bool exists = false;
+  is_duplicate = false;
+  if (OB_FAIL(tablet_handle.get_obj()->rowkey_exists(
+      data_table, run_ctx.store_ctx_, tbl_row.row_val_, exists))) {
+    LOG_WARN("failed to check whether row exists", K(ret), K(tbl_row));
+  } else if (exists) {
+    ObArenaAllocator scan_allocator(ObModIds::OB_TABLE_SCAN_ITER);
+    ObSingleRowGetter single_row_getter(scan_allocator, *tablet_handle.get_obj());
+    ObSEArray<uint64_t, 8> rowkey_col_ids;
+    ObDatumRowkeyHelper rowkey_helper(scan_allocator);
+    ObDatumRowkey datum_rowkey;
+    ObStoreRowkey rowkey;
+    ObNewRow *row = nullptr;
+    if (OB_FAIL(data_table.get_rowkey_column_ids(rowkey_col_ids))) {
+      LOG_WARN("failed to get rowkey column ids", K(ret));
+    } else if (OB_FAIL(rowkey.assign(tbl_row.row_val_.cells_, data_table.get_rowkey_column_num()))) {
+      LOG_WARN("failed to assign rowkey", K(ret), K(tbl_row));
+    } else if (OB_FAIL(rowkey_helper.convert_datum_rowkey(rowkey.get_rowkey(), datum_rowkey))) {
+      LOG_WARN("failed to transfer datum rowkey", K(ret), K(rowkey));
+    } else if (OB_FAIL(init_single_row_getter(single_row_getter, run_ctx, rowkey_col_ids, data_table, true))) {
+      LOG_WARN("failed to init single row getter", K(ret));
+    } else if (OB_FAIL(single_row_getter.open(datum_rowkey))) {
+      LOG_WARN("failed to open single row getter", K(ret), K(datum_rowkey));
+    } else if (OB_FAIL(single_row_getter.get_next_row(row))) {
+      if (OB_ITER_END == ret) {
+        ret = OB_SUCCESS;
+        tbl_row.flag_.set_flag(ObDmlFlag::DF_UPDATE);
+        LOG_DEBUG("overwrite expired row", K(tbl_row));
+      } else {
+        LOG_WARN("failed to get next row from single row getter", K(ret));
+      }
+    } else {
+      is_duplicate = true;
+    }
+  }
+  return ret;
+}
+
 int ObLSTabletService::process_old_row_lob_col(
     ObTabletHandle &data_tablet_handle,
     ObDMLRunningCtx &run_ctx,
@@ -736,6 +736,11 @@ private:
       ObTabletHandle &tablet_handle,
       ObDMLRunningCtx &run_ctx,
       ObStoreRow &tbl_row);
+  static int check_expired_row_conflict(
+      ObTabletHandle &tablet_handle,
+      ObDMLRunningCtx &run_ctx,
+      ObStoreRow &tbl_row,
+      bool &is_duplicate);
   static int process_old_row_lob_col(
       ObTabletHandle &data_tablet_handle,
       ObDMLRunningCtx &run_ctx,
@@ -16,7 +16,7 @@
 #include "ob_gts_define.h"
 #include "share/ob_errno.h"
 #include "lib/utility/utility.h"
-#include "lib/queue/ob_link_queue.h"
+#include "lib/queue/ob_ring_queue.h"
 #include "lib/hash/ob_link_hashmap.h"
 
 namespace oceanbase
@@ -44,7 +44,8 @@ private:
 private:
   bool is_inited_;
   ObGTSCacheTaskType task_type_;
-  common::ObLinkQueue queue_;
+  // every transaction waiting for gts of the tenant queues a task here
+  common::ObLinkRingQueue<1024> queue_;
 };
 
 } // transaction
@@ -0,0 +1,107 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+
+#include "observer/omt/ob_tenant.h"
+#include "observer/omt/ob_th_worker.h"
+#include "share/resource_manager/ob_cgroup_ctrl.h"
+#include "observer/ob_server_struct.h"
+
+using namespace oceanbase::common;
+using namespace oceanbase::share;
+using namespace oceanbase::omt;
+using namespace oceanbase::observer;
+
+class TestWorkerBlockCompensation
+    : public ::testing::Test
+{
+public:
+  TestWorkerBlockCompensation()
+      : cgroup_ctrl_(),
+        tenant_(1001, 10, cgroup_ctrl_)
+  {}
+
+  virtual void SetUp()
+  {
+    tenant_.set_unit_max_cpu(2);
+    tenant_.set_unit_min_cpu(2);
+    tenant_.set_sug_token(2);
+    worker_.set_tenant(&tenant_);
+    worker_.set_worker_level(0);
+    worker_.set_disable_wait_flag(true);
+  }
+
+protected:
+  ObGlobalContext gctx_;
+  ObCgroupCtrl cgroup_ctrl_;
+  ObTenant tenant_;
+  ObThWorker worker_;
+};
+
+TEST_F(TestWorkerBlockCompensation, disabled)
+{
+  // without the flag the worker is not counted and the tokens stay as suggested
+  ASSERT_FALSE(worker_.has_block_compensation());
+  ASSERT_TRUE(worker_.sched_wait());
+  ASSERT_EQ(0, tenant_.get_blocked_worker_cnt());
+  tenant_.calibrate_token_count();
+  ASSERT_EQ(2, tenant_.token_cnt());
+  ASSERT_TRUE(worker_.sched_run());
+  ASSERT_EQ(0, tenant_.get_blocked_worker_cnt());
+}
+
+TEST_F(TestWorkerBlockCompensation, compensate_blocked_worker)
+{
+  tenant_.set_block_compensation(true);
+  worker_.set_block_compensation(true);
+
+  // nested waits only count once
+  ASSERT_TRUE(worker_.sched_wait());
+  ASSERT_TRUE(worker_.sched_wait());
+  ASSERT_EQ(1, tenant_.get_blocked_worker_cnt());
+  tenant_.calibrate_token_count();
+  ASSERT_EQ(3, tenant_.token_cnt());
+
+  ASSERT_TRUE(worker_.sched_run());
+  ASSERT_EQ(1, tenant_.get_blocked_worker_cnt());
+  ASSERT_TRUE(worker_.sched_run());
+  ASSERT_EQ(0, tenant_.get_blocked_worker_cnt());
+  tenant_.calibrate_token_count();
+  ASSERT_EQ(2, tenant_.token_cnt());
+
+  // unpaired sched_run does not drive the count negative
+  ASSERT_TRUE(worker_.sched_run());
+  ASSERT_EQ(0, tenant_.get_blocked_worker_cnt());
+}
+
+TEST_F(TestWorkerBlockCompensation, bounded_by_worker_count)
+{
+  tenant_.set_block_compensation(true);
+  for (int64_t i = 0; i < 101; i++) {
+    tenant_.inc_blocked_worker();
+  }
+  tenant_.calibrate_token_count();
+  // unit_max_cpu * times_of_workers
+  ASSERT_EQ(20, tenant_.token_cnt());
+  for (int64_t i = 0; i < 101; i++) {
+    tenant_.dec_blocked_worker();
+  }
+  tenant_.calibrate_token_count();
+  ASSERT_EQ(2, tenant_.token_cnt());
+}
+
+int main(int argc, char *argv[])
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
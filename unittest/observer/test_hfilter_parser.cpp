@@ -12,6 +12,7 @@
 
 #include "observer/table/ob_htable_filter_parser.h"
 #include "observer/table/ob_htable_filters.h"
+#include "observer/table/ob_htable_utils.h"
 #include <gtest/gtest.h>
 #include "lib/utility/ob_test_util.h"
 #include "lib/json/ob_json_print_utils.h"  // for SJ
@@ -136,6 +137,164 @@ TEST_F(TestHFilterParser, basic_test)
   is_equal_content(tmp_file, result_file);
 }
 
+TEST_F(TestHFilterParser, row_key_prefix)
+{
+  ObArenaAllocator allocator;
+  ObHTableFilterParser parser;
+  ASSERT_EQ(OB_SUCCESS, parser.init(&allocator));
+  hfilter::Filter *filter = NULL;
+  ObString prefix;
+  bool has_prefix = false;
+  // binary prefix with EQUAL bounds the row key
+  ASSERT_EQ(OB_SUCCESS, parser.parse_filter(ObString::make_string("RowFilter(=, 'binaryprefix:abc')"), filter));
+  hfilter::RowFilter *row_filter = dynamic_cast<hfilter::RowFilter*>(filter);
+  ASSERT_TRUE(NULL != row_filter);
+  ASSERT_EQ(OB_SUCCESS, row_filter->get_row_key_prefix(prefix, has_prefix));
+  ASSERT_TRUE(has_prefix);
+  ASSERT_EQ(0, prefix.compare(ObString::make_string("abc")));
+  // exact binary match is a prefix as well
+  ASSERT_EQ(OB_SUCCESS, parser.parse_filter(ObString::make_string("RowFilter(=, 'binary:abcd')"), filter));
+  row_filter = dynamic_cast<hfilter::RowFilter*>(filter);
+  ASSERT_TRUE(NULL != row_filter);
+  ASSERT_EQ(OB_SUCCESS, row_filter->get_row_key_prefix(prefix, has_prefix));
+  ASSERT_TRUE(has_prefix);
+  ASSERT_EQ(0, prefix.compare(ObString::make_string("abcd")));
+  // other operators and comparators do not
+  ASSERT_EQ(OB_SUCCESS, parser.parse_filter(ObString::make_string("RowFilter(!=, 'binaryprefix:abc')"), filter));
+  row_filter = dynamic_cast<hfilter::RowFilter*>(filter);
+  ASSERT_TRUE(NULL != row_filter);
+  ASSERT_EQ(OB_SUCCESS, row_filter->get_row_key_prefix(prefix, has_prefix));
+  ASSERT_FALSE(has_prefix);
+  ASSERT_EQ(OB_SUCCESS, parser.parse_filter(ObString::make_string("RowFilter(=, 'substring:abc')"), filter));
+  row_filter = dynamic_cast<hfilter::RowFilter*>(filter);
+  ASSERT_TRUE(NULL != row_filter);
+  ASSERT_EQ(OB_SUCCESS, row_filter->get_row_key_prefix(prefix, has_prefix));
+  ASSERT_FALSE(has_prefix);
+  parser.destroy();
+}
+
+TEST_F(TestHFilterParser, restrict_key_ranges_by_prefix)
+{
+  ObArenaAllocator allocator;
+  const int64_t rowkey_cnt = 3;
+  ObObj start_objs[rowkey_cnt];
+  ObObj end_objs[rowkey_cnt];
+  ObSEArray<ObNewRange, 4> key_ranges;
+  ObNewRange range;
+  // [b, d] is narrowed to [bc, bd)
+  start_objs[0].set_varbinary(ObString::make_string("b"));
+  end_objs[0].set_varbinary(ObString::make_string("d"));
+  for (int64_t i = 1; i < rowkey_cnt; ++i) {
+    start_objs[i] = ObObj::make_min_obj();
+    end_objs[i] = ObObj::make_max_obj();
+  }
+  range.table_id_ = 1;
+  range.start_key_.assign(start_objs, rowkey_cnt);
+  range.end_key_.assign(end_objs, rowkey_cnt);
+  range.border_flag_.set_inclusive_start();
+  range.border_flag_.set_inclusive_end();
+  ASSERT_EQ(OB_SUCCESS, key_ranges.push_back(range));
+  ASSERT_EQ(OB_SUCCESS, ObHTableUtils::restrict_key_ranges_by_prefix(allocator, rowkey_cnt,
+                                                                     ObString::make_string("bc"), key_ranges));
+  ASSERT_EQ(1, key_ranges.count());
+  ASSERT_EQ(0, key_ranges.at(0).start_key_.get_obj_ptr()[0].get_string().compare(ObString::make_string("bc")));
+  ASSERT_EQ(0, key_ranges.at(0).end_key_.get_obj_ptr()[0].get_string().compare(ObString::make_string("bd")));
+  ASSERT_TRUE(key_ranges.at(0).border_flag_.inclusive_start());
+  ASSERT_FALSE(key_ranges.at(0).border_flag_.inclusive_end());
+
+  // every range is disjoint from the prefix, a false range is returned
+  key_ranges.reuse();
+  ASSERT_EQ(OB_SUCCESS, key_ranges.push_back(range));
+  ASSERT_EQ(OB_SUCCESS, ObHTableUtils::restrict_key_ranges_by_prefix(allocator, rowkey_cnt,
+                                                                     ObString::make_string("x"), key_ranges));
+  ASSERT_EQ(1, key_ranges.count());
+  ASSERT_TRUE(key_ranges.at(0).start_key_.is_max_row());
+  ASSERT_TRUE(key_ranges.at(0).end_key_.is_min_row());
+  ASSERT_EQ(1, key_ranges.at(0).table_id_);
+
+  // a prefix of all 0xFF has no upper bound
+  key_ranges.reuse();
+  range.start_key_.set_min_row();
+  range.end_key_.set_max_row();
+  ASSERT_EQ(OB_SUCCESS, key_ranges.push_back(range));
+  ASSERT_EQ(OB_SUCCESS, ObHTableUtils::restrict_key_ranges_by_prefix(allocator, rowkey_cnt,
+                                                                     ObString::make_string("\xff"), key_ranges));
+  ASSERT_EQ(1, key_ranges.count());
+  ASSERT_EQ(0, key_ranges.at(0).start_key_.get_obj_ptr()[0].get_string().compare(ObString::make_string("\xff")));
+  ASSERT_TRUE(key_ranges.at(0).end_key_.is_max_row());
+}
+
+TEST_F(TestHFilterParser, split_key_ranges_by_qualifiers)
+{
+  ObArenaAllocator allocator;
+  const int64_t rowkey_cnt = 3;
+  ObObj start_objs[rowkey_cnt];
+  ObObj end_objs[rowkey_cnt];
+  ObSEArray<ObNewRange, 4> key_ranges;
+  ObSEArray<ObString, 4> qualifiers;
+  ObNewRange range;
+  // a get of row k
+  start_objs[0].set_varbinary(ObString::make_string("k"));
+  end_objs[0].set_varbinary(ObString::make_string("k"));
+  for (int64_t i = 1; i < rowkey_cnt; ++i) {
+    start_objs[i] = ObObj::make_min_obj();
+    end_objs[i] = ObObj::make_max_obj();
+  }
+  range.table_id_ = 1;
+  range.start_key_.assign(start_objs, rowkey_cnt);
+  range.end_key_.assign(end_objs, rowkey_cnt);
+  range.border_flag_.set_inclusive_start();
+  range.border_flag_.set_inclusive_end();
+  ASSERT_EQ(OB_SUCCESS, qualifiers.push_back(ObString::make_string("q2")));
+  ASSERT_EQ(OB_SUCCESS, qualifiers.push_back(ObString::make_string("q1")));
+  ASSERT_EQ(OB_SUCCESS, qualifiers.push_back(ObString::make_string("q2")));
+
+  // no qualifier, the range is kept
+  ObSEArray<ObString, 4> no_qualifiers;
+  ASSERT_EQ(OB_SUCCESS, key_ranges.push_back(range));
+  ASSERT_EQ(OB_SUCCESS, ObHTableUtils::split_key_ranges_by_qualifiers(allocator, rowkey_cnt,
+                                                                      no_qualifiers, 10, 20, key_ranges));
+  ASSERT_EQ(1, key_ranges.count());
+  ASSERT_TRUE(key_ranges.at(0).start_key_.get_obj_ptr()[1].is_min_value());
+
+  // one range per distinct qualifier in qualifier order, T in (-20, -10]
+  ASSERT_EQ(OB_SUCCESS, ObHTableUtils::split_key_ranges_by_qualifiers(allocator, rowkey_cnt,
+                                                                      qualifiers, 10, 20, key_ranges));
+  ASSERT_EQ(2, key_ranges.count());
+  const char *expected[] = {"q1", "q2"};
+  for (int64_t i = 0; i < 2; ++i) {
+    const ObNewRange &r = key_ranges.at(i);
+    ASSERT_EQ(1, r.table_id_);
+    ASSERT_EQ(0, r.start_key_.get_obj_ptr()[0].get_string().compare(ObString::make_string("k")));
+    ASSERT_EQ(0, r.end_key_.get_obj_ptr()[0].get_string().compare(ObString::make_string("k")));
+    ASSERT_EQ(0, r.start_key_.get_obj_ptr()[1].get_string().compare(ObString::make_string(expected[i])));
+    ASSERT_EQ(0, r.end_key_.get_obj_ptr()[1].get_string().compare(ObString::make_string(expected[i])));
+    ASSERT_EQ(-20, r.start_key_.get_obj_ptr()[2].get_int());
+    ASSERT_EQ(-10, r.end_key_.get_obj_ptr()[2].get_int());
+    ASSERT_FALSE(r.border_flag_.inclusive_start());
+    ASSERT_TRUE(r.border_flag_.inclusive_end());
+  }
+
+  // all time, T is not bounded
+  key_ranges.reuse();
+  ASSERT_EQ(OB_SUCCESS, key_ranges.push_back(range));
+  ASSERT_EQ(OB_SUCCESS, ObHTableUtils::split_key_ranges_by_qualifiers(allocator, rowkey_cnt,
+                                                                      qualifiers, -1, -1, key_ranges));
+  ASSERT_EQ(2, key_ranges.count());
+  ASSERT_TRUE(key_ranges.at(0).start_key_.get_obj_ptr()[2].is_min_value());
+  ASSERT_TRUE(key_ranges.at(0).end_key_.get_obj_ptr()[2].is_max_value());
+  ASSERT_TRUE(key_ranges.at(0).border_flag_.inclusive_start());
+
+  // a scan over several rows is kept
+  key_ranges.reuse();
+  end_objs[0].set_varbinary(ObString::make_string("m"));
+  ASSERT_EQ(OB_SUCCESS, key_ranges.push_back(range));
+  ASSERT_EQ(OB_SUCCESS, ObHTableUtils::split_key_ranges_by_qualifiers(allocator, rowkey_cnt,
+                                                                      qualifiers, 10, 20, key_ranges));
+  ASSERT_EQ(1, key_ranges.count());
+  ASSERT_EQ(0, key_ranges.at(0).end_key_.get_obj_ptr()[0].get_string().compare(ObString::make_string("m")));
+}
+
 int main(int argc, char **argv)
 {
   OB_LOGGER.set_log_level("INFO");
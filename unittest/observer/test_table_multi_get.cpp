@@ -0,0 +1,112 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#define private public
+#include "observer/table/ob_table_service.h"
+#undef private
+
+using namespace oceanbase::common;
+using namespace oceanbase::table;
+using namespace oceanbase::observer;
+
+class TestTableMultiGet : public ::testing::Test
+{
+public:
+  static const int64_t MAX_KEY_CNT = 16;
+  TestTableMultiGet() : key_cnt_(0) {}
+  // every entity gets a (k1, k2) rowkey, the batch only keeps pointers to the entities
+  void add_get(const int64_t k1, const int64_t k2)
+  {
+    ASSERT_LT(key_cnt_, MAX_KEY_CNT);
+    ObTableEntity &entity = entities_[key_cnt_++];
+    ObObj obj;
+    obj.set_int(k1);
+    ASSERT_EQ(OB_SUCCESS, entity.add_rowkey_value(obj));
+    obj.set_int(k2);
+    ASSERT_EQ(OB_SUCCESS, entity.add_rowkey_value(obj));
+    ASSERT_EQ(OB_SUCCESS, batch_.retrieve(entity));
+  }
+  void check_order(const ObIArray<int64_t> &key_order, const int64_t *expected, const int64_t cnt)
+  {
+    ASSERT_EQ(cnt, key_order.count());
+    for (int64_t i = 0; i < cnt; ++i) {
+      EXPECT_EQ(expected[i], key_order.at(i)) << "i=" << i;
+    }
+  }
+protected:
+  ObTableEntity entities_[MAX_KEY_CNT];
+  int64_t key_cnt_;
+  ObTableBatchOperation batch_;
+};
+
+TEST_F(TestTableMultiGet, sorted_keys)
+{
+  add_get(1, 1);
+  add_get(1, 2);
+  add_get(2, 0);
+  add_get(3, 5);
+  ObSEArray<int64_t, 16> key_order;
+  bool need_sort = true;
+  ASSERT_EQ(OB_SUCCESS, ObTableService::sort_multi_get_keys(batch_, key_order, need_sort));
+  ASSERT_FALSE(need_sort);
+  const int64_t expected[] = {0, 1, 2, 3};
+  check_order(key_order, expected, 4);
+}
+
+TEST_F(TestTableMultiGet, unsorted_keys)
+{
+  add_get(3, 0);
+  add_get(1, 2);
+  add_get(2, 9);
+  add_get(1, 1);
+  ObSEArray<int64_t, 16> key_order;
+  bool need_sort = false;
+  ASSERT_EQ(OB_SUCCESS, ObTableService::sort_multi_get_keys(batch_, key_order, need_sort));
+  ASSERT_TRUE(need_sort);
+  // key_order lists the request index of each key in rowkey order
+  const int64_t expected[] = {3, 1, 2, 0};
+  check_order(key_order, expected, 4);
+}
+
+TEST_F(TestTableMultiGet, duplicated_keys)
+{
+  add_get(2, 2);
+  add_get(1, 1);
+  add_get(2, 2);
+  add_get(1, 1);
+  add_get(2, 2);
+  ObSEArray<int64_t, 16> key_order;
+  bool need_sort = false;
+  ASSERT_EQ(OB_SUCCESS, ObTableService::sort_multi_get_keys(batch_, key_order, need_sort));
+  ASSERT_TRUE(need_sort);
+  // equal keys keep the request order
+  const int64_t expected[] = {1, 3, 0, 2, 4};
+  check_order(key_order, expected, 5);
+}
+
+TEST_F(TestTableMultiGet, single_key)
+{
+  add_get(7, 7);
+  ObSEArray<int64_t, 16> key_order;
+  bool need_sort = true;
+  ASSERT_EQ(OB_SUCCESS, ObTableService::sort_multi_get_keys(batch_, key_order, need_sort));
+  ASSERT_FALSE(need_sort);
+  const int64_t expected[] = {0};
+  check_order(key_order, expected, 1);
+}
+
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,144 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#include <string>
+#define private public
+#define protected public
+#include "observer/table/ob_table_query_processor.h"
+#undef protected
+#undef private
+#include "observer/ob_server_struct.h"
+
+using namespace oceanbase::common;
+using namespace oceanbase::table;
+using namespace oceanbase::observer;
+
+// records the order of scans (N), sends (S) and waits (W) of a stream query
+class MockResultIterator : public ObTableQueryResultIterator
+{
+public:
+  MockResultIterator(std::string &trace, const int64_t result_cnt)
+    : trace_(trace), result_cnt_(result_cnt), next_(0), err_idx_(-1), err_(OB_SUCCESS) {}
+  virtual int get_next_result(ObTableQueryResult *&one_result) override
+  {
+    int ret = OB_SUCCESS;
+    trace_ += 'N';
+    if (next_ == err_idx_) {
+      ret = err_;
+    } else if (next_ >= result_cnt_) {
+      ret = OB_ITER_END;
+    } else {
+      one_result = NULL;
+      ++next_;
+    }
+    return ret;
+  }
+  virtual bool has_more_result() const override { return next_ < result_cnt_; }
+  void set_error(const int64_t idx, const int err) { err_idx_ = idx; err_ = err; }
+private:
+  std::string &trace_;
+  int64_t result_cnt_;
+  int64_t next_;
+  int64_t err_idx_;
+  int err_;
+};
+
+class MockTableQueryP : public ObTableQueryP
+{
+public:
+  explicit MockTableQueryP(const ObGlobalContext &gctx)
+    : ObTableQueryP(gctx), send_ret_(OB_SUCCESS), wait_ret_(OB_SUCCESS) {}
+  virtual int send_stream_part() override
+  {
+    trace_ += 'S';
+    return send_ret_;
+  }
+  virtual int wait_stream_next(int64_t wait_timeout) override
+  {
+    UNUSED(wait_timeout);
+    trace_ += 'W';
+    return wait_ret_;
+  }
+  std::string trace_;
+  int send_ret_;
+  int wait_ret_;
+};
+
+class TestTableQueryStream : public ::testing::Test
+{
+public:
+  TestTableQueryStream() : processor_(gctx_) {}
+  int run(MockResultIterator &iter, int32_t &result_count)
+  {
+    result_count = 0;
+    return processor_.pipelined_stream_query(iter, INT64_MAX, result_count);
+  }
+protected:
+  ObGlobalContext gctx_;
+  MockTableQueryP processor_;
+};
+
+TEST_F(TestTableQueryStream, single_packet)
+{
+  MockResultIterator iter(processor_.trace_, 1);
+  int32_t result_count = 0;
+  ASSERT_EQ(OB_SUCCESS, run(iter, result_count));
+  // the last packet is responded by the processor itself
+  ASSERT_EQ("N", processor_.trace_);
+  ASSERT_EQ(1, result_count);
+}
+
+TEST_F(TestTableQueryStream, prefetch_before_wait)
+{
+  MockResultIterator iter(processor_.trace_, 3);
+  int32_t result_count = 0;
+  ASSERT_EQ(OB_SUCCESS, run(iter, result_count));
+  // the next packet is scanned after the current one is sent and before the client asks for it
+  ASSERT_EQ("NSNWSNW", processor_.trace_);
+  ASSERT_EQ(3, result_count);
+}
+
+TEST_F(TestTableQueryStream, prefetch_error_answers_next_request)
+{
+  MockResultIterator iter(processor_.trace_, 3);
+  iter.set_error(1, OB_TIMEOUT);
+  int32_t result_count = 0;
+  ASSERT_EQ(OB_TIMEOUT, run(iter, result_count));
+  // the client still gets the packet sent before the error, then the error as the next answer
+  ASSERT_EQ("NSNW", processor_.trace_);
+}
+
+TEST_F(TestTableQueryStream, client_abort)
+{
+  MockResultIterator iter(processor_.trace_, 3);
+  processor_.wait_ret_ = OB_ITER_END;
+  int32_t result_count = 0;
+  ASSERT_EQ(OB_ITER_END, run(iter, result_count));
+  ASSERT_EQ("NSNW", processor_.trace_);
+}
+
+TEST_F(TestTableQueryStream, send_fail)
+{
+  MockResultIterator iter(processor_.trace_, 3);
+  processor_.send_ret_ = OB_RPC_SEND_ERROR;
+  int32_t result_count = 0;
+  ASSERT_EQ(OB_RPC_SEND_ERROR, run(iter, result_count));
+  // nothing is prefetched once the current packet can not be sent
+  ASSERT_EQ("NS", processor_.trace_);
+}
+
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,63 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#include <thread>
+#include "share/rpc/ob_batch_rpc.h"
+#include "lib/time/ob_time_utility.h"
+
+namespace oceanbase
+{
+using namespace common;
+using namespace obrpc;
+
+TEST(TestSingleWaitCond, timeout)
+{
+  SingleWaitCond cond;
+  const int64_t start_ts = ObTimeUtility::current_time();
+  ASSERT_FALSE(cond.wait(10 * 1000));
+  ASSERT_GE(ObTimeUtility::current_time() - start_ts, 10 * 1000);
+}
+
+TEST(TestSingleWaitCond, signal_before_wait)
+{
+  SingleWaitCond cond;
+  cond.signal();
+  cond.signal();
+  ASSERT_TRUE(cond.wait(10 * 1000 * 1000));
+  // signals are merged and consumed by one wait
+  ASSERT_FALSE(cond.wait(10 * 1000));
+}
+
+TEST(TestSingleWaitCond, signal_while_sleeping)
+{
+  SingleWaitCond cond;
+  std::thread signaler([&]() {
+    ::usleep(20 * 1000);
+    cond.signal();
+  });
+  const int64_t start_ts = ObTimeUtility::current_time();
+  // the wakeup by signal is reported, so the batch rpc thread lingers after it
+  ASSERT_TRUE(cond.wait(10 * 1000 * 1000));
+  ASSERT_LT(ObTimeUtility::current_time() - start_ts, 5 * 1000 * 1000);
+  signaler.join();
+  // and it is consumed, the next wait is not woken up by it again
+  ASSERT_FALSE(cond.wait(10 * 1000));
+}
+
+} // end namespace oceanbase
+
+int main(int argc, char *argv[])
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -84,6 +84,52 @@ TEST_F(TestMultiParser, basic_test)
 
 }
 
+TEST_F(TestMultiParser, homogeneous_dml)
+{
+  bool is_homogeneous = false;
+  ObSEArray<ObString, 4> queries;
+  ASSERT_EQ(OB_SUCCESS, queries.push_back(ObString::make_string("update t1 set c1 = 1 where c2 = 1")));
+  ASSERT_EQ(OB_SUCCESS, ObParser::check_is_homogeneous_dml(queries, is_homogeneous));
+  ASSERT_FALSE(is_homogeneous);
+
+  ASSERT_EQ(OB_SUCCESS, queries.push_back(ObString::make_string("\n UPDATE t1 set c1 = 2 where c2 = 2")));
+  ASSERT_EQ(OB_SUCCESS, ObParser::check_is_homogeneous_dml(queries, is_homogeneous));
+  ASSERT_TRUE(is_homogeneous);
+
+  ASSERT_EQ(OB_SUCCESS, queries.push_back(ObString::make_string("delete from t1 where c2 = 3")));
+  ASSERT_EQ(OB_SUCCESS, ObParser::check_is_homogeneous_dml(queries, is_homogeneous));
+  ASSERT_FALSE(is_homogeneous);
+
+  queries.reuse();
+  ASSERT_EQ(OB_SUCCESS, queries.push_back(ObString::make_string("select 1")));
+  ASSERT_EQ(OB_SUCCESS, queries.push_back(ObString::make_string("select 2")));
+  ASSERT_EQ(OB_SUCCESS, ObParser::check_is_homogeneous_dml(queries, is_homogeneous));
+  ASSERT_FALSE(is_homogeneous);
+
+  // leading comments and hints right after the keyword
+  queries.reuse();
+  ASSERT_EQ(OB_SUCCESS, queries.push_back(ObString::make_string("/* c1 */ insert into t1 values (1)")));
+  ASSERT_EQ(OB_SUCCESS, queries.push_back(ObString::make_string("insert/*+ enable_parallel_dml */ into t1 values (2)")));
+  ASSERT_EQ(OB_SUCCESS, queries.push_back(ObString::make_string("-- c2\n# c3\n INSERT into t1 values (3)")));
+  ASSERT_EQ(OB_SUCCESS, ObParser::check_is_homogeneous_dml(queries, is_homogeneous));
+  ASSERT_TRUE(is_homogeneous);
+
+  ASSERT_EQ(OB_SUCCESS, queries.push_back(ObString::make_string("/* c4 */ update t1 set c1 = 4")));
+  ASSERT_EQ(OB_SUCCESS, ObParser::check_is_homogeneous_dml(queries, is_homogeneous));
+  ASSERT_FALSE(is_homogeneous);
+
+  // unterminated comment and mysql executable comment are left to the normal path
+  queries.reuse();
+  ASSERT_EQ(OB_SUCCESS, queries.push_back(ObString::make_string("delete from t1 where c1 = 1")));
+  ASSERT_EQ(OB_SUCCESS, queries.push_back(ObString::make_string("/* delete from t1 where c1 = 2")));
+  ASSERT_EQ(OB_SUCCESS, ObParser::check_is_homogeneous_dml(queries, is_homogeneous));
+  ASSERT_FALSE(is_homogeneous);
+  queries.pop_back();
+  ASSERT_EQ(OB_SUCCESS, queries.push_back(ObString::make_string("/*! delete */ from t1 where c1 = 2")));
+  ASSERT_EQ(OB_SUCCESS, ObParser::check_is_homogeneous_dml(queries, is_homogeneous));
+  ASSERT_FALSE(is_homogeneous);
+}
+
 
 }
 
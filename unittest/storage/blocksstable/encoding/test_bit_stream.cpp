@@ -13,6 +13,7 @@
 #include <gtest/gtest.h>
 #include <vector>
 #include "storage/blocksstable/encoding/ob_bit_stream.h"
+#include "storage/blocksstable/encoding/ob_integer_base_diff_decoder.h"
 #include "lib/time/ob_time_utility.h"
 
 namespace oceanbase
@@ -227,6 +228,140 @@ TEST(ObBitStream, perf)
   std::cout << "second run: " << end_time - start_time << std::endl;
 }
 
+void random_bit_packed_buf(std::vector<unsigned char> &buf, const int64_t bs_len)
+{
+  buf.resize((bs_len + CHAR_BIT - 1) / CHAR_BIT);
+  FOREACH(b, buf) {
+    *b = static_cast<unsigned char>(lrand48());
+  }
+}
+
+template <int32_t CMP_TYPE>
+void check_bit_packed_filter(
+    const unsigned char *buf,
+    const int64_t offset,
+    const int64_t width,
+    const int64_t cnt,
+    const int64_t bs_len,
+    const uint64_t literal)
+{
+  const int64_t size = sql::ObBitVector::memory_size(cnt);
+  char expect_buf[size];
+  char res_buf[size];
+  sql::ObBitVector *expect = sql::to_bit_vector(expect_buf);
+  sql::ObBitVector *res = sql::to_bit_vector(res_buf);
+  expect->reset(cnt);
+  res->reset(cnt);
+  BitPackedFilterFunc_T<CMP_TYPE>::bit_packed_filter_func(
+      buf, offset, width, cnt, bs_len, literal, *expect);
+  bit_packed_filter_funcs[CMP_TYPE](buf, offset, width, cnt, bs_len, literal, *res);
+  for (int64_t i = 0; i < cnt; ++i) {
+    ASSERT_EQ(expect->at(i), res->at(i))
+        << "op: " << CMP_TYPE << ", width: " << width << ", offset: " << offset
+        << ", cnt: " << cnt << ", row: " << i << std::endl;
+  }
+}
+
+TEST(ObBitStream, batch_unpack)
+{
+  ASSERT_TRUE(bit_packed_funcs_inited);
+  srand48(ObTimeUtility::current_time());
+  const int64_t cnts[] = { 1, 7, 8, 9, 31, 256, 1001 };
+  std::vector<unsigned char> buf;
+  std::vector<uint64_t> values;
+  for (int64_t width = 1; width <= 64; ++width) {
+    for (int64_t offset = 0; offset < 16; offset += 3) {
+      for (int64_t c = 0; c < ARRAYSIZEOF(cnts); ++c) {
+        const int64_t cnt = cnts[c];
+        const int64_t bs_len = offset + width * cnt;
+        const uint64_t base = (lrand48() << 32) | lrand48();
+        random_bit_packed_buf(buf, bs_len);
+        values.resize(cnt);
+        bit_packed_unpack_func(buf.data(), offset, width, cnt, bs_len, base, values.data());
+        for (int64_t i = 0; i < cnt; ++i) {
+          uint64_t v = 0;
+          ASSERT_EQ(OB_SUCCESS, ObBitStream::get(buf.data(), offset + i * width, width, v));
+          ASSERT_EQ(v + base, values.at(i))
+              << "width: " << width << ", offset: " << offset
+              << ", cnt: " << cnt << ", row: " << i << std::endl;
+        }
+
+        // literal in stored values, smaller than all and larger than all
+        const uint64_t literals[] = { values.at(cnt / 2) - base, 0, ObBitStream::get_mask(width) };
+        for (int64_t l = 0; l < ARRAYSIZEOF(literals); ++l) {
+          check_bit_packed_filter<sql::WHITE_OP_EQ>(buf.data(), offset, width, cnt, bs_len, literals[l]);
+          check_bit_packed_filter<sql::WHITE_OP_LE>(buf.data(), offset, width, cnt, bs_len, literals[l]);
+          check_bit_packed_filter<sql::WHITE_OP_LT>(buf.data(), offset, width, cnt, bs_len, literals[l]);
+          check_bit_packed_filter<sql::WHITE_OP_GE>(buf.data(), offset, width, cnt, bs_len, literals[l]);
+          check_bit_packed_filter<sql::WHITE_OP_GT>(buf.data(), offset, width, cnt, bs_len, literals[l]);
+          check_bit_packed_filter<sql::WHITE_OP_NE>(buf.data(), offset, width, cnt, bs_len, literals[l]);
+        }
+      }
+    }
+  }
+}
+
+TEST(ObBitStream, batch_unpack_perf)
+{
+  const int64_t ROW_CNT = 1024;
+  const int64_t LOOP_CNT = 10000;
+  const int64_t widths[] = { 3, 11, 17, 31, 47 };
+  std::vector<unsigned char> buf;
+  uint64_t values[ROW_CNT];
+  const int64_t size = sql::ObBitVector::memory_size(ROW_CNT);
+  char res_buf[size];
+  sql::ObBitVector *res = sql::to_bit_vector(res_buf);
+  for (int64_t w = 0; w < ARRAYSIZEOF(widths); ++w) {
+    const int64_t width = widths[w];
+    const int64_t bs_len = width * ROW_CNT;
+    random_bit_packed_buf(buf, bs_len);
+
+    int64_t start_time = ObTimeUtility::current_time();
+    for (int64_t i = 0; i < LOOP_CNT; ++i) {
+      int64_t value = 0;
+      for (int64_t j = 0; j < ROW_CNT; ++j) {
+        ObBitStream::get<ObBitStream::DEFAULT>(buf.data(), j * width, width, bs_len, value);
+        values[j] = value + i;
+      }
+    }
+    const int64_t get_time = ObTimeUtility::current_time() - start_time;
+
+    start_time = ObTimeUtility::current_time();
+    for (int64_t i = 0; i < LOOP_CNT; ++i) {
+      BitUnpackFunc::bit_unpack_func(buf.data(), 0, width, ROW_CNT, bs_len, i, values);
+    }
+    const int64_t scalar_time = ObTimeUtility::current_time() - start_time;
+
+    start_time = ObTimeUtility::current_time();
+    for (int64_t i = 0; i < LOOP_CNT; ++i) {
+      bit_packed_unpack_func(buf.data(), 0, width, ROW_CNT, bs_len, i, values);
+    }
+    const int64_t unpack_time = ObTimeUtility::current_time() - start_time;
+
+    start_time = ObTimeUtility::current_time();
+    for (int64_t i = 0; i < LOOP_CNT; ++i) {
+      res->reset(ROW_CNT);
+      BitPackedFilterFunc_T<sql::WHITE_OP_GT>::bit_packed_filter_func(
+          buf.data(), 0, width, ROW_CNT, bs_len, i, *res);
+    }
+    const int64_t scalar_filter_time = ObTimeUtility::current_time() - start_time;
+
+    start_time = ObTimeUtility::current_time();
+    for (int64_t i = 0; i < LOOP_CNT; ++i) {
+      res->reset(ROW_CNT);
+      bit_packed_filter_funcs[sql::WHITE_OP_GT](buf.data(), 0, width, ROW_CNT, bs_len, i, *res);
+    }
+    const int64_t filter_time = ObTimeUtility::current_time() - start_time;
+
+    std::cout << "width: " << width
+              << ", bit stream get: " << get_time
+              << ", scalar unpack: " << scalar_time
+              << ", dispatched unpack: " << unpack_time
+              << ", scalar filter: " << scalar_filter_time
+              << ", dispatched filter: " << filter_time << std::endl;
+  }
+}
+
 } // end namespace blocksstable
 } // end namespace oceanbase
 
@@ -81,6 +81,37 @@ public:
 
   void batch_get_row_perf_test();
 
+  void string_filter_collation_test();
+
+  void span_column_filter_pushdown_test();
+
+  void time_series_filter_pushdown_test();
+
+  void time_series_batch_decode_test();
+
+  void build_time_series_block(ObMicroBlockDecoder &decoder);
+
+  void string_symbol_filter_pushdown_test();
+
+  void string_symbol_batch_decode_test();
+
+  void build_string_symbol_block(ObMicroBlockDecoder &decoder);
+
+  void check_string_symbol_fast_filter(
+        ObMicroBlockDecoder &decoder,
+        const int64_t col_idx,
+        const sql::ObWhiteFilterOperatorType op_type,
+        const ObObj &ref_obj,
+        const bool expect_fast);
+
+  void check_filter_count(
+        ObMicroBlockDecoder &decoder,
+        const int64_t col_idx,
+        const sql::ObWhiteFilterOperatorType op_type,
+        const ObObj *ref_objs,
+        const int64_t ref_cnt,
+        const int64_t expect_cnt);
+
   void set_encoding_type(ObColumnHeader::Type type);
 
   void set_column_type_default();
@@ -89,6 +120,30 @@ public:
 
   void set_column_type_string();
 
+  void set_column_type_span();
+
+  void set_column_type_time_series();
+
+  void set_column_type_string_symbol();
+
+  // time series rows, the timestamp is null on every 16th row and the double on the row after
+  static bool is_time_series_null(const int64_t row_id, const int64_t null_shift)
+  { return null_shift == row_id % 16; }
+  static int64_t time_series_timestamp(const int64_t row_id)
+  { return 1600000000000000L + row_id * 1000000L + row_id % 3; }
+  static double time_series_double(const int64_t row_id)
+  { return 10.5 + static_cast<double>(row_id % 8) * 0.25; }
+  // urls sharing substrings, null on every 16th row
+  static const char *string_symbol_url(const int64_t row_id)
+  {
+    static const char *urls[] = {
+        "https://www.oceanbase.com/docs/community/observer-cn/V4.0.0/10000000000981600",
+        "https://www.oceanbase.com/blog/details/community/observer-cn/V4.0.0/109000",
+        "https://open.oceanbase.com/docs/community/observer-cn/V4.0.0/10000000000981600",
+        "https://open.oceanbase.com/quiz/community/observer-cn/V4.0.0/10000000000981600"};
+    return 15 == row_id % 16 ? nullptr : urls[row_id % 4];
+  }
+
 protected:
   ObRowGenerate row_generate_;
   ObMicroBlockEncodingCtx ctx_;
@@ -169,6 +224,47 @@ void TestColumnDecoder::set_column_type_string()
   col_obj_types_[3] = ObHexStringType;
 }
 
+void TestColumnDecoder::set_column_type_span()
+{
+  if (OB_NOT_NULL(col_obj_types_)) {
+    allocator_.free(col_obj_types_);
+  }
+  // the last column references the one before it
+  column_cnt_ = 3;
+  rowkey_cnt_ = 1;
+  col_obj_types_ = reinterpret_cast<ObObjType *>(allocator_.alloc(sizeof(ObObjType) * column_cnt_));
+  col_obj_types_[0] = ObIntType;
+  col_obj_types_[1] = ObVarcharType;
+  col_obj_types_[2] = ObVarcharType;
+}
+
+void TestColumnDecoder::set_column_type_time_series()
+{
+  if (OB_NOT_NULL(col_obj_types_)) {
+    allocator_.free(col_obj_types_);
+  }
+  column_cnt_ = 3;
+  rowkey_cnt_ = 1;
+  col_obj_types_ = reinterpret_cast<ObObjType *>(allocator_.alloc(sizeof(ObObjType) * column_cnt_));
+  col_obj_types_[0] = ObIntType;
+  col_obj_types_[1] = ObTimestampType;
+  col_obj_types_[2] = ObDoubleType;
+}
+
+void TestColumnDecoder::set_column_type_string_symbol()
+{
+  if (OB_NOT_NULL(col_obj_types_)) {
+    allocator_.free(col_obj_types_);
+  }
+  // the first varchar is of general_ci collation and the second one binary
+  column_cnt_ = 3;
+  rowkey_cnt_ = 1;
+  col_obj_types_ = reinterpret_cast<ObObjType *>(allocator_.alloc(sizeof(ObObjType) * column_cnt_));
+  col_obj_types_[0] = ObIntType;
+  col_obj_types_[1] = ObVarcharType;
+  col_obj_types_[2] = ObVarcharType;
+}
+
 void TestColumnDecoder::SetUp()
 {
   if (column_encoding_type_ == ObColumnHeader::Type::INTEGER_BASE_DIFF) {
@@ -177,6 +273,13 @@ void TestColumnDecoder::SetUp()
       || column_encoding_type_ == ObColumnHeader::Type::STRING_DIFF
       || column_encoding_type_ == ObColumnHeader::Type::STRING_PREFIX) {
     set_column_type_string();
+  } else if (ObColumnHeader::is_inter_column_encoder(column_encoding_type_)) {
+    set_column_type_span();
+  } else if (column_encoding_type_ == ObColumnHeader::Type::INTEGER_STRIDE_DIFF
+      || column_encoding_type_ == ObColumnHeader::Type::FLOAT_DECIMAL) {
+    set_column_type_time_series();
+  } else if (column_encoding_type_ == ObColumnHeader::Type::STRING_SYMBOL) {
+    set_column_type_string_symbol();
   } else {
     set_column_type_default();
   }
@@ -220,6 +323,9 @@ void TestColumnDecoder::SetUp()
     } else {
       col.set_collation_type(CS_TYPE_BINARY);
     }
+    if (column_encoding_type_ == ObColumnHeader::Type::STRING_SYMBOL && column_cnt_ - 1 == i) {
+      col.set_collation_type(CS_TYPE_BINARY);
+    }
     if (type == ObIntType) {
       col.set_rowkey_position(1);
     } else if (type == ObUInt64Type) {
@@ -246,6 +352,11 @@ void TestColumnDecoder::SetUp()
   ctx_.column_cnt_ = column_cnt_ + extra_rowkey_cnt_;
   ctx_.col_descs_ = &col_descs_;
   ctx_.row_store_type_ = common::ENCODING_ROW_STORE;
+  if (column_encoding_type_ == ObColumnHeader::Type::INTEGER_STRIDE_DIFF
+      || column_encoding_type_ == ObColumnHeader::Type::FLOAT_DECIMAL
+      || column_encoding_type_ == ObColumnHeader::Type::STRING_SYMBOL) {
+    ctx_.major_working_cluster_version_ = CLUSTER_CURRENT_VERSION;
+  }
 
   if (!is_retro_) {
     int64_t *column_encodings = reinterpret_cast<int64_t *>(allocator_.alloc(sizeof(int64_t) * ctx_.column_cnt_));
@@ -257,6 +368,15 @@ void TestColumnDecoder::SetUp()
       }
       if (ObColumnHeader::Type::INTEGER_BASE_DIFF == column_encoding_type_) {
         ctx_.column_encodings_[i] = column_encoding_type_;
+      } else if (ObColumnHeader::is_inter_column_encoder(column_encoding_type_)) {
+        ctx_.column_encodings_[i] = ctx_.column_cnt_ - 1 == i
+            ? column_encoding_type_ : ObColumnHeader::Type::DICT;
+      } else if (ObColumnHeader::Type::INTEGER_STRIDE_DIFF == column_encoding_type_
+          || ObColumnHeader::Type::FLOAT_DECIMAL == column_encoding_type_) {
+        const ObObjType type = col_descs_.at(i).col_type_.get_type();
+        ctx_.column_encodings_[i] = ObTimestampType == type
+            ? ObColumnHeader::Type::INTEGER_STRIDE_DIFF
+            : (ObDoubleType == type ? ObColumnHeader::Type::FLOAT_DECIMAL : ObColumnHeader::Type::DICT);
       } else if (col_obj_types_[i] == ObIntType) {
         ctx_.column_encodings_[i] = ObColumnHeader::Type::DICT;
       } else {
@@ -927,6 +1047,410 @@ void TestColumnDecoder::batch_decode_to_datum_test(bool is_condensed)
   }
 }
 
+void TestColumnDecoder::check_filter_count(
+    ObMicroBlockDecoder &decoder,
+    const int64_t col_idx,
+    const sql::ObWhiteFilterOperatorType op_type,
+    const ObObj *ref_objs,
+    const int64_t ref_cnt,
+    const int64_t expect_cnt)
+{
+  sql::ObPushdownWhiteFilterNode white_filter(allocator_);
+  ObMalloc mallocer;
+  mallocer.set_label("ColumnDecoder");
+  ObFixedArray<ObObj, ObIAllocator> objs(mallocer, ref_cnt);
+  ASSERT_EQ(OB_SUCCESS, objs.init(ref_cnt));
+  for (int64_t i = 0; i < ref_cnt; ++i) {
+    ASSERT_EQ(OB_SUCCESS, objs.push_back(ref_objs[i]));
+  }
+  white_filter.op_type_ = op_type;
+  ObBitmap result_bitmap(allocator_);
+  ASSERT_EQ(OB_SUCCESS, result_bitmap.init(ROW_CNT));
+  ASSERT_EQ(OB_SUCCESS, test_filter_pushdown(col_idx, is_retro_, decoder, white_filter, result_bitmap, objs));
+  ASSERT_EQ(expect_cnt, result_bitmap.popcnt()) << "col_idx: " << col_idx << " op_type: " << op_type;
+}
+
+// Strings of a non-binary collation can not be compared byte by byte in place, the decoders
+// must fall back to collation aware comparison.
+void TestColumnDecoder::string_filter_collation_test()
+{
+  ObDatumRow row;
+  ASSERT_EQ(OB_SUCCESS, row.init(allocator_, full_column_cnt_));
+  const int64_t col_idx = rowkey_cnt_ + extra_rowkey_cnt_;  // the varchar column
+  ASSERT_EQ(ObVarcharType, col_descs_.at(col_idx).col_type_.get_type());
+  ASSERT_EQ(CS_TYPE_UTF8MB4_GENERAL_CI, col_descs_.at(col_idx).col_type_.get_collation_type());
+  const int64_t seed = 10000;
+  for (int64_t i = 0; i < ROW_CNT; ++i) {
+    ASSERT_EQ(OB_SUCCESS, row_generate_.get_next_row(seed, row));
+    if (i < ROW_CNT - 32) {
+      row.storage_datums_[col_idx].set_string(ObString::make_string("prefix_abc"));
+    } else if (i < ROW_CNT - 16) {
+      row.storage_datums_[col_idx].set_string(ObString::make_string("prefix_abd"));
+    } else {
+      row.storage_datums_[col_idx].set_null();
+    }
+    ASSERT_EQ(OB_SUCCESS, encoder_.append_row(row)) << "i: " << i << std::endl;
+  }
+  char *buf = NULL;
+  int64_t size = 0;
+  ASSERT_EQ(OB_SUCCESS, encoder_.build_block(buf, size));
+  ObMicroBlockDecoder decoder;
+  ObMicroBlockData data(encoder_.get_data().data(), encoder_.get_data().pos());
+  ASSERT_EQ(OB_SUCCESS, decoder.init(data, read_info_));
+  ASSERT_EQ(column_encoding_type_, decoder.decoders_[col_idx].decoder_->get_type());
+
+  ObObj ref_objs[2];
+  ref_objs[0].set_varchar("PREFIX_ABC");
+  ref_objs[0].set_collation_type(CS_TYPE_UTF8MB4_GENERAL_CI);
+  ref_objs[1].set_varchar("Prefix_Abd");
+  ref_objs[1].set_collation_type(CS_TYPE_UTF8MB4_GENERAL_CI);
+  check_filter_count(decoder, col_idx, sql::WHITE_OP_EQ, ref_objs, 1, ROW_CNT - 32);
+  check_filter_count(decoder, col_idx, sql::WHITE_OP_NE, ref_objs, 1, 16);
+  check_filter_count(decoder, col_idx, sql::WHITE_OP_GT, ref_objs, 1, 16);
+  check_filter_count(decoder, col_idx, sql::WHITE_OP_LE, ref_objs, 1, ROW_CNT - 32);
+  check_filter_count(decoder, col_idx, sql::WHITE_OP_IN, ref_objs + 1, 1, 16);
+  check_filter_count(decoder, col_idx, sql::WHITE_OP_BT, ref_objs, 2, ROW_CNT - 16);
+  check_filter_count(decoder, col_idx, sql::WHITE_OP_NU, ref_objs, 1, 16);
+}
+
+// The last column is encoded against the one before it, with exception rows that differ from
+// the referenced column.
+void TestColumnDecoder::span_column_filter_pushdown_test()
+{
+  ObDatumRow row;
+  ASSERT_EQ(OB_SUCCESS, row.init(allocator_, full_column_cnt_));
+  const bool is_column_equal = ObColumnHeader::Type::COLUMN_EQUAL == column_encoding_type_;
+  const int64_t ref_col_idx = full_column_cnt_ - 2;
+  const int64_t col_idx = full_column_cnt_ - 1;
+  const char *ref_a = is_column_equal ? "aaaaaa" : "xx_aaaaaa_yy";
+  const char *ref_b = is_column_equal ? "bbbbbb" : "xx_bbbbbb_yy";
+  for (int64_t i = 0; i < ROW_CNT; ++i) {
+    ASSERT_EQ(OB_SUCCESS, row_generate_.get_next_row(i, row));
+    ObStorageDatum &ref_datum = row.storage_datums_[ref_col_idx];
+    ObStorageDatum &datum = row.storage_datums_[col_idx];
+    if (i < 40) {
+      ref_datum.set_string(ObString::make_string(ref_a));
+      datum.set_string(ObString::make_string("aaaaaa"));
+    } else if (i < 60) {
+      ref_datum.set_string(ObString::make_string(ref_b));
+      datum.set_string(ObString::make_string("bbbbbb"));
+    } else {
+      ref_datum.set_null();
+      datum.set_null();
+    }
+    // exceptions
+    if (i >= 10 && i < 15) {
+      datum.set_string(ObString::make_string("cccccc"));
+    } else if (50 == i) {
+      datum.set_null();
+    }
+    ASSERT_EQ(OB_SUCCESS, encoder_.append_row(row)) << "i: " << i << std::endl;
+  }
+  const int64_t a_cnt = 35;
+  const int64_t b_cnt = 19;
+  const int64_t c_cnt = 5;
+  const int64_t null_cnt = 5;
+
+  char *buf = NULL;
+  int64_t size = 0;
+  ASSERT_EQ(OB_SUCCESS, encoder_.build_block(buf, size));
+  ObMicroBlockDecoder decoder;
+  ObMicroBlockData data(encoder_.get_data().data(), encoder_.get_data().pos());
+  ASSERT_EQ(OB_SUCCESS, decoder.init(data, read_info_));
+  ASSERT_EQ(column_encoding_type_, decoder.decoders_[col_idx].decoder_->get_type());
+
+  ObObj ref_objs[2];
+  ref_objs[0].set_varchar("bbbbbb");
+  ref_objs[0].set_collation_type(CS_TYPE_UTF8MB4_GENERAL_CI);
+  ref_objs[1].set_varchar("CCCCCC");
+  ref_objs[1].set_collation_type(CS_TYPE_UTF8MB4_GENERAL_CI);
+  check_filter_count(decoder, col_idx, sql::WHITE_OP_EQ, ref_objs, 1, b_cnt);
+  check_filter_count(decoder, col_idx, sql::WHITE_OP_NE, ref_objs, 1, a_cnt + c_cnt);
+  check_filter_count(decoder, col_idx, sql::WHITE_OP_GT, ref_objs, 1, c_cnt);
+  check_filter_count(decoder, col_idx, sql::WHITE_OP_LT, ref_objs, 1, a_cnt);
+  check_filter_count(decoder, col_idx, sql::WHITE_OP_GE, ref_objs, 1, b_cnt + c_cnt);
+  check_filter_count(decoder, col_idx, sql::WHITE_OP_IN, ref_objs, 2, b_cnt + c_cnt);
+  check_filter_count(decoder, col_idx, sql::WHITE_OP_BT, ref_objs, 2, b_cnt + c_cnt);
+  check_filter_count(decoder, col_idx, sql::WHITE_OP_NU, ref_objs, 1, null_cnt);
+  check_filter_count(decoder, col_idx, sql::WHITE_OP_NN, ref_objs, 1, ROW_CNT - null_cnt);
+  // exception rows only, matched case-insensitively
+  check_filter_count(decoder, col_idx, sql::WHITE_OP_EQ, ref_objs + 1, 1, c_cnt);
+}
+
+void TestColumnDecoder::build_time_series_block(ObMicroBlockDecoder &decoder)
+{
+  ObDatumRow row;
+  ASSERT_EQ(OB_SUCCESS, row.init(allocator_, full_column_cnt_));
+  const int64_t ts_idx = rowkey_cnt_ + extra_rowkey_cnt_;
+  const int64_t double_idx = ts_idx + 1;
+  ASSERT_EQ(ObTimestampType, col_descs_.at(ts_idx).col_type_.get_type());
+  ASSERT_EQ(ObDoubleType, col_descs_.at(double_idx).col_type_.get_type());
+  for (int64_t i = 0; i < ROW_CNT; ++i) {
+    ASSERT_EQ(OB_SUCCESS, row_generate_.get_next_row(i, row));
+    if (is_time_series_null(i, 0)) {
+      row.storage_datums_[ts_idx].set_null();
+    } else {
+      row.storage_datums_[ts_idx].set_int(time_series_timestamp(i));
+    }
+    if (is_time_series_null(i, 1)) {
+      row.storage_datums_[double_idx].set_null();
+    } else {
+      row.storage_datums_[double_idx].set_double(time_series_double(i));
+    }
+    ASSERT_EQ(OB_SUCCESS, encoder_.append_row(row)) << "i: " << i << std::endl;
+  }
+  char *buf = NULL;
+  int64_t size = 0;
+  ASSERT_EQ(OB_SUCCESS, encoder_.build_block(buf, size));
+  ObMicroBlockData data(encoder_.get_data().data(), encoder_.get_data().pos());
+  ASSERT_EQ(OB_SUCCESS, decoder.init(data, read_info_));
+  ASSERT_EQ(ObColumnHeader::Type::INTEGER_STRIDE_DIFF, decoder.decoders_[ts_idx].decoder_->get_type());
+  ASSERT_EQ(ObColumnHeader::Type::FLOAT_DECIMAL, decoder.decoders_[double_idx].decoder_->get_type());
+}
+
+void TestColumnDecoder::time_series_filter_pushdown_test()
+{
+  ObMicroBlockDecoder decoder;
+  build_time_series_block(decoder);
+  const int64_t ts_idx = rowkey_cnt_ + extra_rowkey_cnt_;
+  const int64_t double_idx = ts_idx + 1;
+  const int64_t null_cnt = ROW_CNT / 16;
+
+  // rows 16, 32 and 48 are null
+  ObObj ts_objs[3];
+  ts_objs[0].set_timestamp(time_series_timestamp(33));
+  ts_objs[1].set_timestamp(time_series_timestamp(10));
+  ts_objs[2].set_timestamp(time_series_timestamp(20));
+  check_filter_count(decoder, ts_idx, sql::WHITE_OP_EQ, ts_objs, 1, 1);
+  check_filter_count(decoder, ts_idx, sql::WHITE_OP_NE, ts_objs, 1, ROW_CNT - null_cnt - 1);
+  check_filter_count(decoder, ts_idx, sql::WHITE_OP_LT, ts_objs, 1, 30);
+  check_filter_count(decoder, ts_idx, sql::WHITE_OP_GE, ts_objs, 1, 30);
+  check_filter_count(decoder, ts_idx, sql::WHITE_OP_GT, ts_objs, 1, 29);
+  check_filter_count(decoder, ts_idx, sql::WHITE_OP_BT, ts_objs + 1, 2, 10);
+  check_filter_count(decoder, ts_idx, sql::WHITE_OP_IN, ts_objs, 3, 3);
+  check_filter_count(decoder, ts_idx, sql::WHITE_OP_NU, ts_objs, 1, null_cnt);
+  check_filter_count(decoder, ts_idx, sql::WHITE_OP_NN, ts_objs, 1, ROW_CNT - null_cnt);
+
+  // every value repeats 8 times, except 10.75 which loses 4 rows to null
+  ObObj double_objs[3];
+  double_objs[0].set_double(11.0);
+  double_objs[1].set_double(11.5);
+  double_objs[2].set_double(99.0);
+  check_filter_count(decoder, double_idx, sql::WHITE_OP_EQ, double_objs, 1, 8);
+  check_filter_count(decoder, double_idx, sql::WHITE_OP_NE, double_objs, 1, ROW_CNT - null_cnt - 8);
+  check_filter_count(decoder, double_idx, sql::WHITE_OP_LT, double_objs, 1, 12);
+  check_filter_count(decoder, double_idx, sql::WHITE_OP_GT, double_objs + 1, 1, 24);
+  check_filter_count(decoder, double_idx, sql::WHITE_OP_BT, double_objs, 2, 24);
+  check_filter_count(decoder, double_idx, sql::WHITE_OP_IN, double_objs, 3, 16);
+  check_filter_count(decoder, double_idx, sql::WHITE_OP_GT, double_objs + 2, 1, 0);
+  check_filter_count(decoder, double_idx, sql::WHITE_OP_NU, double_objs, 1, null_cnt);
+}
+
+void TestColumnDecoder::time_series_batch_decode_test()
+{
+  ObMicroBlockDecoder decoder;
+  build_time_series_block(decoder);
+  const int64_t ts_idx = rowkey_cnt_ + extra_rowkey_cnt_;
+  const int64_t double_idx = ts_idx + 1;
+  const char *cell_datas[ROW_CNT];
+  char *datum_buf = reinterpret_cast<char *>(allocator_.alloc(sizeof(int64_t) * 2 * ROW_CNT));
+  ASSERT_TRUE(nullptr != datum_buf);
+  // decode the odd rows in reverse order, a batch does not have to be sorted or continuous
+  const int64_t batch_cnt = ROW_CNT / 2;
+  int64_t row_ids[ROW_CNT / 2];
+  for (int64_t i = 0; i < batch_cnt; ++i) {
+    row_ids[i] = ROW_CNT - 1 - 2 * i;
+  }
+  for (int64_t col_idx = ts_idx; col_idx <= double_idx; ++col_idx) {
+    ObDatum datums[ROW_CNT / 2];
+    for (int64_t i = 0; i < batch_cnt; ++i) {
+      datums[i].ptr_ = datum_buf + i * sizeof(int64_t) * 2;
+    }
+    ASSERT_EQ(OB_SUCCESS, decoder.decoders_[col_idx].batch_decode(
+        decoder.row_index_, row_ids, cell_datas, batch_cnt, datums));
+    for (int64_t i = 0; i < batch_cnt; ++i) {
+      const int64_t row_id = row_ids[i];
+      if (ts_idx == col_idx) {
+        if (is_time_series_null(row_id, 0)) {
+          ASSERT_TRUE(datums[i].is_null()) << "row_id: " << row_id;
+        } else {
+          ASSERT_EQ(time_series_timestamp(row_id), datums[i].get_int()) << "row_id: " << row_id;
+        }
+      } else if (is_time_series_null(row_id, 1)) {
+        ASSERT_TRUE(datums[i].is_null()) << "row_id: " << row_id;
+      } else {
+        ASSERT_EQ(time_series_double(row_id), datums[i].get_double()) << "row_id: " << row_id;
+      }
+    }
+  }
+}
+
+void TestColumnDecoder::build_string_symbol_block(ObMicroBlockDecoder &decoder)
+{
+  ObDatumRow row;
+  ASSERT_EQ(OB_SUCCESS, row.init(allocator_, full_column_cnt_));
+  const int64_t ci_idx = rowkey_cnt_ + extra_rowkey_cnt_;
+  const int64_t bin_idx = ci_idx + 1;
+  ASSERT_EQ(CS_TYPE_UTF8MB4_GENERAL_CI, col_descs_.at(ci_idx).col_type_.get_collation_type());
+  ASSERT_EQ(CS_TYPE_BINARY, col_descs_.at(bin_idx).col_type_.get_collation_type());
+  for (int64_t i = 0; i < ROW_CNT; ++i) {
+    ASSERT_EQ(OB_SUCCESS, row_generate_.get_next_row(i, row));
+    const char *url = string_symbol_url(i);
+    for (int64_t col_idx = ci_idx; col_idx <= bin_idx; ++col_idx) {
+      if (nullptr == url) {
+        row.storage_datums_[col_idx].set_null();
+      } else {
+        row.storage_datums_[col_idx].set_string(ObString::make_string(url));
+      }
+    }
+    ASSERT_EQ(OB_SUCCESS, encoder_.append_row(row)) << "i: " << i << std::endl;
+  }
+  char *buf = NULL;
+  int64_t size = 0;
+  ASSERT_EQ(OB_SUCCESS, encoder_.build_block(buf, size));
+  ObMicroBlockData data(encoder_.get_data().data(), encoder_.get_data().pos());
+  ASSERT_EQ(OB_SUCCESS, decoder.init(data, read_info_));
+  ASSERT_EQ(ObColumnHeader::Type::STRING_SYMBOL, decoder.decoders_[ci_idx].decoder_->get_type());
+  ASSERT_EQ(ObColumnHeader::Type::STRING_SYMBOL, decoder.decoders_[bin_idx].decoder_->get_type());
+}
+
+// Compare codes in place by equal_operator and decompressed values by traverse_all_data,
+// the two paths must agree whenever the fast one is valid.
+void TestColumnDecoder::check_string_symbol_fast_filter(
+    ObMicroBlockDecoder &decoder,
+    const int64_t col_idx,
+    const sql::ObWhiteFilterOperatorType op_type,
+    const ObObj &ref_obj,
+    const bool expect_fast)
+{
+  sql::ObPushdownWhiteFilterNode white_filter(allocator_);
+  white_filter.op_type_ = op_type;
+  sql::ObExecContext exec_ctx(allocator_);
+  sql::ObEvalCtx eval_ctx(exec_ctx);
+  sql::ObPushdownExprSpec expr_spec(allocator_);
+  sql::ObPushdownOperator op(eval_ctx, expr_spec);
+  sql::ObWhiteFilterExecutor filter(allocator_, white_filter, op);
+  ObMalloc mallocer;
+  mallocer.set_label("ColumnDecoder");
+  ObFixedArray<ObObj, ObIAllocator> objs(mallocer, 1);
+  ASSERT_EQ(OB_SUCCESS, objs.init(1));
+  ASSERT_EQ(OB_SUCCESS, objs.push_back(ref_obj));
+  filter.params_ = objs;
+
+  const ObColumnDecoder &column_decoder = decoder.decoders_[col_idx];
+  const ObStringSymbolDecoder *symbol_decoder =
+      static_cast<const ObStringSymbolDecoder *>(column_decoder.decoder_);
+  ASSERT_EQ(expect_fast, symbol_decoder->fast_filter_valid(*column_decoder.ctx_, filter));
+  if (expect_fast) {
+    ObBitmap fast_bitmap(allocator_);
+    ObBitmap slow_bitmap(allocator_);
+    ASSERT_EQ(OB_SUCCESS, fast_bitmap.init(ROW_CNT));
+    ASSERT_EQ(OB_SUCCESS, slow_bitmap.init(ROW_CNT));
+    ASSERT_EQ(OB_SUCCESS, symbol_decoder->get_is_null_bitmap_from_var_column(
+        *column_decoder.ctx_, decoder.row_index_, fast_bitmap));
+    ASSERT_EQ(OB_SUCCESS, symbol_decoder->get_is_null_bitmap_from_var_column(
+        *column_decoder.ctx_, decoder.row_index_, slow_bitmap));
+    ASSERT_EQ(OB_SUCCESS, symbol_decoder->equal_operator(
+        nullptr, *column_decoder.ctx_, decoder.row_index_, filter, fast_bitmap));
+    ASSERT_EQ(OB_SUCCESS, symbol_decoder->traverse_all_data(
+        nullptr, *column_decoder.ctx_, decoder.row_index_, filter, slow_bitmap));
+    for (int64_t i = 0; i < ROW_CNT; ++i) {
+      ASSERT_EQ(slow_bitmap.test(i), fast_bitmap.test(i)) << "row_id: " << i;
+    }
+  }
+}
+
+void TestColumnDecoder::string_symbol_filter_pushdown_test()
+{
+  ObMicroBlockDecoder decoder;
+  build_string_symbol_block(decoder);
+  const int64_t ci_idx = rowkey_cnt_ + extra_rowkey_cnt_;
+  const int64_t bin_idx = ci_idx + 1;
+  const int64_t null_cnt = ROW_CNT / 16;
+  // urls in order: 2, 3, 1, 0. url 3 loses 4 rows to null
+  const int64_t url_cnts[4] = {16, 16, 16, 12};
+
+  ObObj bin_objs[4];
+  for (int64_t i = 0; i < 4; ++i) {
+    bin_objs[i].set_varchar(string_symbol_url(i));
+    bin_objs[i].set_collation_type(CS_TYPE_BINARY);
+  }
+  ObObj absent_objs[2];
+  absent_objs[0].set_varchar("https://www.oceanbase.com/");
+  absent_objs[0].set_collation_type(CS_TYPE_BINARY);
+  // bytes out of the symbol table are escaped
+  absent_objs[1].set_varchar("\xfe\xff~~");
+  absent_objs[1].set_collation_type(CS_TYPE_BINARY);
+
+  // binary collation: EQ/NE by codes, the other operators by decompressed values
+  check_string_symbol_fast_filter(decoder, bin_idx, sql::WHITE_OP_EQ, bin_objs[1], true);
+  check_string_symbol_fast_filter(decoder, bin_idx, sql::WHITE_OP_NE, bin_objs[3], true);
+  check_string_symbol_fast_filter(decoder, bin_idx, sql::WHITE_OP_EQ, absent_objs[1], true);
+  check_string_symbol_fast_filter(decoder, bin_idx, sql::WHITE_OP_GT, bin_objs[1], false);
+  check_filter_count(decoder, bin_idx, sql::WHITE_OP_EQ, bin_objs + 1, 1, url_cnts[1]);
+  check_filter_count(decoder, bin_idx, sql::WHITE_OP_NE, bin_objs + 3, 1, ROW_CNT - null_cnt - url_cnts[3]);
+  check_filter_count(decoder, bin_idx, sql::WHITE_OP_EQ, absent_objs, 1, 0);
+  check_filter_count(decoder, bin_idx, sql::WHITE_OP_EQ, absent_objs + 1, 1, 0);
+  check_filter_count(decoder, bin_idx, sql::WHITE_OP_NE, absent_objs + 1, 1, ROW_CNT - null_cnt);
+  check_filter_count(decoder, bin_idx, sql::WHITE_OP_GT, bin_objs + 3, 1, url_cnts[1] + url_cnts[0]);
+  check_filter_count(decoder, bin_idx, sql::WHITE_OP_LT, bin_objs + 1, 1, url_cnts[2] + url_cnts[3]);
+  check_filter_count(decoder, bin_idx, sql::WHITE_OP_NU, bin_objs, 1, null_cnt);
+  check_filter_count(decoder, bin_idx, sql::WHITE_OP_NN, bin_objs, 1, ROW_CNT - null_cnt);
+
+  // general_ci collation falls back to decompressed values for EQ/NE as well
+  char upper_urls[4][128];
+  ObObj ci_objs[4];
+  for (int64_t i = 0; i < 4; ++i) {
+    const char *url = string_symbol_url(i);
+    const int64_t len = static_cast<int64_t>(strlen(url));
+    for (int64_t j = 0; j < len; ++j) {
+      upper_urls[i][j] = static_cast<char>(toupper(url[j]));
+    }
+    ci_objs[i].set_varchar(upper_urls[i], static_cast<int32_t>(len));
+    ci_objs[i].set_collation_type(CS_TYPE_UTF8MB4_GENERAL_CI);
+  }
+  check_string_symbol_fast_filter(decoder, ci_idx, sql::WHITE_OP_EQ, ci_objs[1], false);
+  check_string_symbol_fast_filter(decoder, bin_idx, sql::WHITE_OP_EQ, ci_objs[1], false);
+  check_filter_count(decoder, ci_idx, sql::WHITE_OP_EQ, ci_objs + 1, 1, url_cnts[1]);
+  check_filter_count(decoder, ci_idx, sql::WHITE_OP_NE, ci_objs + 1, 1, ROW_CNT - null_cnt - url_cnts[1]);
+  check_filter_count(decoder, ci_idx, sql::WHITE_OP_GT, ci_objs + 3, 1, url_cnts[1] + url_cnts[0]);
+  check_filter_count(decoder, ci_idx, sql::WHITE_OP_LE, ci_objs + 1, 1,
+      url_cnts[2] + url_cnts[3] + url_cnts[1]);
+  ObObj bt_objs[2] = {ci_objs[3], ci_objs[1]};
+  check_filter_count(decoder, ci_idx, sql::WHITE_OP_BT, bt_objs, 2, url_cnts[3] + url_cnts[1]);
+  ObObj in_objs[2] = {ci_objs[0], ci_objs[3]};
+  check_filter_count(decoder, ci_idx, sql::WHITE_OP_IN, in_objs, 2, url_cnts[0] + url_cnts[3]);
+  check_filter_count(decoder, ci_idx, sql::WHITE_OP_NU, ci_objs, 1, null_cnt);
+}
+
+void TestColumnDecoder::string_symbol_batch_decode_test()
+{
+  ObMicroBlockDecoder decoder;
+  build_string_symbol_block(decoder);
+  const int64_t ci_idx = rowkey_cnt_ + extra_rowkey_cnt_;
+  const int64_t bin_idx = ci_idx + 1;
+  const char *cell_datas[ROW_CNT];
+  // decode the odd rows in reverse order
+  const int64_t batch_cnt = ROW_CNT / 2;
+  int64_t row_ids[ROW_CNT / 2];
+  for (int64_t i = 0; i < batch_cnt; ++i) {
+    row_ids[i] = ROW_CNT - 1 - 2 * i;
+  }
+  for (int64_t col_idx = ci_idx; col_idx <= bin_idx; ++col_idx) {
+    ObDatum datums[ROW_CNT / 2];
+    ASSERT_EQ(OB_SUCCESS, decoder.decoders_[col_idx].batch_decode(
+        decoder.row_index_, row_ids, cell_datas, batch_cnt, datums));
+    for (int64_t i = 0; i < batch_cnt; ++i) {
+      const char *url = string_symbol_url(row_ids[i]);
+      if (nullptr == url) {
+        ASSERT_TRUE(datums[i].is_null()) << "row_id: " << row_ids[i];
+      } else {
+        ASSERT_EQ(ObString::make_string(url), datums[i].get_string()) << "row_id: " << row_ids[i];
+      }
+    }
+  }
+}
+
 // void TestColumnDecoder::batch_get_row_perf_test()
 // {
 //   ObDatumRow row;
@@ -81,6 +81,41 @@ public:
   virtual ~TestStringPrefixDecoder() {}
 };
 
+class TestColumnEqualDecoder : public TestColumnDecoder
+{
+public:
+  TestColumnEqualDecoder() : TestColumnDecoder(ObColumnHeader::Type::COLUMN_EQUAL) {}
+  virtual ~TestColumnEqualDecoder() {}
+};
+
+class TestInterColSubStrDecoder : public TestColumnDecoder
+{
+public:
+  TestInterColSubStrDecoder() : TestColumnDecoder(ObColumnHeader::Type::COLUMN_SUBSTR) {}
+  virtual ~TestInterColSubStrDecoder() {}
+};
+
+class TestIntStrideDiffDecoder : public TestColumnDecoder
+{
+public:
+  TestIntStrideDiffDecoder() : TestColumnDecoder(ObColumnHeader::Type::INTEGER_STRIDE_DIFF) {}
+  virtual ~TestIntStrideDiffDecoder() {}
+};
+
+class TestFloatDecimalDecoder : public TestColumnDecoder
+{
+public:
+  TestFloatDecimalDecoder() : TestColumnDecoder(ObColumnHeader::Type::FLOAT_DECIMAL) {}
+  virtual ~TestFloatDecimalDecoder() {}
+};
+
+class TestStringSymbolDecoder : public TestColumnDecoder
+{
+public:
+  TestStringSymbolDecoder() : TestColumnDecoder(ObColumnHeader::Type::STRING_SYMBOL) {}
+  virtual ~TestStringSymbolDecoder() {}
+};
+
 TEST_F(TestIntBaseDiffDecoder, filter_pushdown_comaprison_neg_test)
 {
   filter_pushdown_comaprison_neg_test();
@@ -90,12 +125,49 @@ PUSHDOWN_GENERAL_TEST(TestRetroPDDecoder);
 PUSHDOWN_GENERAL_TEST(TestDictDecoder);
 PUSHDOWN_GENERAL_TEST(TestRLEDecoder);
 PUSHDOWN_GENERAL_TEST(TestIntBaseDiffDecoder);
+PUSHDOWN_GENERAL_TEST(TestStringDiffDecoder);
+PUSHDOWN_GENERAL_TEST(TestStringPrefixDecoder);
 
 TEST_F(TestHexDecoder, basic_filter_pushdown_op_test_eq_ne_nu_nn)
 {
   basic_filter_pushdown_eq_ne_nu_nn_test();
 }
 
+TEST_F(TestStringDiffDecoder, filter_pushdown_collation_test)
+{
+  string_filter_collation_test();
+}
+
+TEST_F(TestStringPrefixDecoder, filter_pushdown_collation_test)
+{
+  string_filter_collation_test();
+}
+
+TEST_F(TestColumnEqualDecoder, filter_pushdown_exception_test)
+{
+  span_column_filter_pushdown_test();
+}
+
+TEST_F(TestInterColSubStrDecoder, filter_pushdown_exception_test)
+{
+  span_column_filter_pushdown_test();
+}
+
+TEST_F(TestIntStrideDiffDecoder, filter_pushdown_time_series_test)
+{
+  time_series_filter_pushdown_test();
+}
+
+TEST_F(TestFloatDecimalDecoder, filter_pushdown_time_series_test)
+{
+  time_series_filter_pushdown_test();
+}
+
+TEST_F(TestStringSymbolDecoder, filter_pushdown_symbol_test)
+{
+  string_symbol_filter_pushdown_test();
+}
+
 TEST_F(TestDictDecoder, batch_decode_to_datum_condense_test)
 {
   batch_decode_to_datum_test(true);
@@ -131,6 +203,21 @@ TEST_F(TestStringPrefixDecoder, batch_decode_to_datum_test)
   batch_decode_to_datum_test();
 }
 
+TEST_F(TestIntStrideDiffDecoder, batch_decode_time_series_test)
+{
+  time_series_batch_decode_test();
+}
+
+TEST_F(TestFloatDecimalDecoder, batch_decode_time_series_test)
+{
+  time_series_batch_decode_test();
+}
+
+TEST_F(TestStringSymbolDecoder, batch_decode_symbol_test)
+{
+  string_symbol_batch_decode_test();
+}
+
 // TEST_F(TestDictDecoder, batch_decode_perf_test)
 // {
 //   batch_get_row_perf_test();
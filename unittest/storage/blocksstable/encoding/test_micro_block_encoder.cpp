@@ -13,6 +13,8 @@
 #define USING_LOG_PREFIX STORAGE
 
 #include <gtest/gtest.h>
+#include <cmath>
+#include <limits>
 #define protected public
 #define private public
 #include "storage/blocksstable/encoding/ob_micro_block_encoder.h"
@@ -221,6 +223,281 @@ TEST_F(TestDictLargeVarchar, test_dict_large_varchar)
   ASSERT_TRUE(ObDatum::binary_equal(row.storage_datums_[3], read_row.storage_datums_[3]));
 }
 
+static ObObjType test_time_series[3] = {ObIntType, ObTimestampType, ObDoubleType};
+class TestTimeSeriesEncoding : public TestIColumnEncoder
+{
+public:
+  TestTimeSeriesEncoding()
+  {
+    rowkey_cnt_ = 1;
+    column_cnt_ = 3;
+    col_types_ = reinterpret_cast<ObObjType *>(allocator_.alloc(sizeof(ObObjType) * column_cnt_));
+    for (int64_t i = 0; i < column_cnt_; ++i) {
+      col_types_[i] = test_time_series[i];
+    }
+  }
+  virtual ~TestTimeSeriesEncoding()
+  {
+    allocator_.free(col_types_);
+  }
+};
+
+TEST_F(TestTimeSeriesEncoding, test_stride_diff_and_float_decimal)
+{
+  const int64_t row_cnt = 1000;
+  ctx_.major_working_cluster_version_ = CLUSTER_CURRENT_VERSION;
+  ctx_.column_encodings_ = static_cast<int64_t *>(allocator_.alloc(sizeof(int64_t) * column_cnt_));
+  ctx_.column_encodings_[0] = ObColumnHeader::Type::INTEGER_STRIDE_DIFF;
+  ctx_.column_encodings_[1] = ObColumnHeader::Type::INTEGER_STRIDE_DIFF;
+  ctx_.column_encodings_[2] = ObColumnHeader::Type::FLOAT_DECIMAL;
+  ObMicroBlockEncoder encoder;
+  ASSERT_EQ(OB_SUCCESS, encoder.init(ctx_));
+
+  ObDatumRow row;
+  ASSERT_EQ(OB_SUCCESS, row.init(allocator_, column_cnt_));
+  for (int64_t i = 0; i < row_cnt; ++i) {
+    row.storage_datums_[0].set_int(i + 1);
+    if (0 == i % 17) {
+      row.storage_datums_[1].set_null();
+    } else {
+      // one second interval with a few microseconds jitter
+      row.storage_datums_[1].set_int(1600000000000000L + i * 1000000L + i % 3);
+    }
+    row.storage_datums_[2].set_double(10.5 + static_cast<double>(i % 100) * 0.25);
+    ASSERT_EQ(OB_SUCCESS, encoder.append_row(row));
+  }
+
+  char *buf = nullptr;
+  int64_t size = 0;
+  ASSERT_EQ(OB_SUCCESS, encoder.build_block(buf, size));
+  ASSERT_EQ(ObColumnHeader::INTEGER_STRIDE_DIFF, encoder.encoders_.at(1)->get_type());
+  ASSERT_EQ(ObColumnHeader::FLOAT_DECIMAL, encoder.encoders_.at(2)->get_type());
+
+  ObMicroBlockData micro_data(buf, size);
+  ObMicroBlockDecoder decoder;
+  ObDatumRow read_row;
+  ASSERT_EQ(OB_SUCCESS, read_row.init(column_cnt_));
+  ASSERT_EQ(OB_SUCCESS, decoder.init(micro_data, read_info_));
+  for (int64_t i = 0; i < row_cnt; ++i) {
+    ASSERT_EQ(OB_SUCCESS, decoder.get_row(i, read_row));
+    ASSERT_EQ(i + 1, read_row.storage_datums_[0].get_int());
+    if (0 == i % 17) {
+      ASSERT_TRUE(read_row.storage_datums_[1].is_null());
+    } else {
+      ASSERT_EQ(1600000000000000L + i * 1000000L + i % 3, read_row.storage_datums_[1].get_int());
+    }
+    ASSERT_EQ(10.5 + static_cast<double>(i % 100) * 0.25, read_row.storage_datums_[2].get_double());
+  }
+}
+
+TEST_F(TestTimeSeriesEncoding, test_encoding_version_gate)
+{
+  const int64_t row_cnt = 1000;
+  ObMicroBlockEncoder encoder;
+  ASSERT_EQ(OB_SUCCESS, encoder.init(ctx_));
+  ASSERT_FALSE(encoder.is_encoding_supported(ObColumnHeader::INTEGER_STRIDE_DIFF));
+  ASSERT_FALSE(encoder.is_encoding_supported(ObColumnHeader::FLOAT_DECIMAL));
+  ASSERT_FALSE(encoder.is_encoding_supported(ObColumnHeader::STRING_SYMBOL));
+  ASSERT_TRUE(encoder.is_encoding_supported(ObColumnHeader::INTEGER_BASE_DIFF));
+
+  ObDatumRow row;
+  ASSERT_EQ(OB_SUCCESS, row.init(allocator_, column_cnt_));
+  for (int64_t i = 0; i < row_cnt; ++i) {
+    row.storage_datums_[0].set_int(i + 1);
+    row.storage_datums_[1].set_int(1600000000000000L + i * 1000000L);
+    row.storage_datums_[2].set_double(10.5 + static_cast<double>(i % 100) * 0.25);
+    ASSERT_EQ(OB_SUCCESS, encoder.append_row(row));
+  }
+  char *buf = nullptr;
+  int64_t size = 0;
+  ASSERT_EQ(OB_SUCCESS, encoder.build_block(buf, size));
+  for (int64_t i = 0; i < column_cnt_; ++i) {
+    ASSERT_NE(ObColumnHeader::INTEGER_STRIDE_DIFF, encoder.encoders_.at(i)->get_type());
+    ASSERT_NE(ObColumnHeader::FLOAT_DECIMAL, encoder.encoders_.at(i)->get_type());
+  }
+
+  // 4.1.0.0 replicas can't decode them either
+  ctx_.major_working_cluster_version_ = CLUSTER_VERSION_4_1_0_0;
+  ObMicroBlockEncoder encoder_4100;
+  ASSERT_EQ(OB_SUCCESS, encoder_4100.init(ctx_));
+  ASSERT_FALSE(encoder_4100.is_encoding_supported(ObColumnHeader::INTEGER_STRIDE_DIFF));
+  ASSERT_FALSE(encoder_4100.is_encoding_supported(ObColumnHeader::FLOAT_DECIMAL));
+  ASSERT_FALSE(encoder_4100.is_encoding_supported(ObColumnHeader::STRING_SYMBOL));
+  ctx_.major_working_cluster_version_ = CLUSTER_VERSION_4_1_0_1;
+  ObMicroBlockEncoder encoder_4101;
+  ASSERT_EQ(OB_SUCCESS, encoder_4101.init(ctx_));
+  ASSERT_TRUE(encoder_4101.is_encoding_supported(ObColumnHeader::INTEGER_STRIDE_DIFF));
+  ASSERT_TRUE(encoder_4101.is_encoding_supported(ObColumnHeader::FLOAT_DECIMAL));
+  ASSERT_TRUE(encoder_4101.is_encoding_supported(ObColumnHeader::STRING_SYMBOL));
+}
+
+TEST_F(TestTimeSeriesEncoding, test_stride_not_fit)
+{
+  const int64_t row_cnt = 1000;
+  ctx_.major_working_cluster_version_ = CLUSTER_CURRENT_VERSION;
+  // 0: the distance between the first and the last value overflows int64
+  // 1: a single not null value has no stride
+  for (int64_t c = 0; c < 2; ++c) {
+    ObMicroBlockEncoder encoder;
+    ASSERT_EQ(OB_SUCCESS, encoder.init(ctx_));
+    ObDatumRow row;
+    ASSERT_EQ(OB_SUCCESS, row.init(allocator_, column_cnt_));
+    for (int64_t i = 0; i < row_cnt; ++i) {
+      row.storage_datums_[0].set_int(i + 1);
+      if (0 == c) {
+        row.storage_datums_[1].set_int(0 == i % 2 ? INT64_MIN + 1 + i : INT64_MAX - i);
+      } else if (0 == i) {
+        row.storage_datums_[1].set_int(1600000000000000L);
+      } else {
+        row.storage_datums_[1].set_null();
+      }
+      row.storage_datums_[2].set_double(0.5);
+      ASSERT_EQ(OB_SUCCESS, encoder.append_row(row));
+    }
+    char *buf = nullptr;
+    int64_t size = 0;
+    ASSERT_EQ(OB_SUCCESS, encoder.build_block(buf, size));
+    ASSERT_NE(ObColumnHeader::INTEGER_STRIDE_DIFF, encoder.encoders_.at(1)->get_type()) << "case: " << c;
+
+    ObMicroBlockData micro_data(buf, size);
+    ObMicroBlockDecoder decoder;
+    ObDatumRow read_row;
+    ASSERT_EQ(OB_SUCCESS, read_row.init(column_cnt_));
+    ASSERT_EQ(OB_SUCCESS, decoder.init(micro_data, read_info_));
+    for (int64_t i = 0; i < row_cnt; ++i) {
+      ASSERT_EQ(OB_SUCCESS, decoder.get_row(i, read_row));
+      if (0 == c) {
+        ASSERT_EQ(0 == i % 2 ? INT64_MIN + 1 + i : INT64_MAX - i,
+            read_row.storage_datums_[1].get_int());
+      } else if (0 == i) {
+        ASSERT_EQ(1600000000000000L, read_row.storage_datums_[1].get_int());
+      } else {
+        ASSERT_TRUE(read_row.storage_datums_[1].is_null());
+      }
+    }
+  }
+}
+
+TEST_F(TestTimeSeriesEncoding, test_float_decimal_not_fit)
+{
+  const int64_t row_cnt = 1000;
+  ctx_.major_working_cluster_version_ = CLUSTER_CURRENT_VERSION;
+  // none of them round trips through a scaled integer
+  const double specials[] = {-0.0, std::nan(""), std::numeric_limits<double>::infinity(),
+      -std::numeric_limits<double>::infinity(), 1.0 / 3};
+  for (int64_t c = 0; c < ARRAYSIZEOF(specials); ++c) {
+    ObMicroBlockEncoder encoder;
+    ASSERT_EQ(OB_SUCCESS, encoder.init(ctx_));
+    ObDatumRow row;
+    ASSERT_EQ(OB_SUCCESS, row.init(allocator_, column_cnt_));
+    for (int64_t i = 0; i < row_cnt; ++i) {
+      row.storage_datums_[0].set_int(i + 1);
+      row.storage_datums_[1].set_int(1600000000000000L + i * 1000000L);
+      row.storage_datums_[2].set_double(
+          row_cnt / 2 == i ? specials[c] : 10.5 + static_cast<double>(i % 100) * 0.25);
+      ASSERT_EQ(OB_SUCCESS, encoder.append_row(row));
+    }
+    char *buf = nullptr;
+    int64_t size = 0;
+    ASSERT_EQ(OB_SUCCESS, encoder.build_block(buf, size));
+    ASSERT_NE(ObColumnHeader::FLOAT_DECIMAL, encoder.encoders_.at(2)->get_type()) << "case: " << c;
+
+    ObMicroBlockData micro_data(buf, size);
+    ObMicroBlockDecoder decoder;
+    ObDatumRow read_row;
+    ASSERT_EQ(OB_SUCCESS, read_row.init(column_cnt_));
+    ASSERT_EQ(OB_SUCCESS, decoder.init(micro_data, read_info_));
+    for (int64_t i = 0; i < row_cnt; ++i) {
+      ASSERT_EQ(OB_SUCCESS, decoder.get_row(i, read_row));
+      const double expect = row_cnt / 2 == i ? specials[c] : 10.5 + static_cast<double>(i % 100) * 0.25;
+      const double value = read_row.storage_datums_[2].get_double();
+      // bit exact, which also tells -0.0 from 0.0 and keeps the NaN payload
+      ASSERT_EQ(0, MEMCMP(&expect, &value, sizeof(double))) << "case: " << c << " row: " << i;
+    }
+  }
+}
+
+static ObObjType test_string_symbol[2] = {ObIntType, ObVarcharType};
+class TestStringSymbolEncoding : public TestIColumnEncoder
+{
+public:
+  TestStringSymbolEncoding()
+  {
+    rowkey_cnt_ = 1;
+    column_cnt_ = 2;
+    col_types_ = reinterpret_cast<ObObjType *>(allocator_.alloc(sizeof(ObObjType) * column_cnt_));
+    for (int64_t i = 0; i < column_cnt_; ++i) {
+      col_types_[i] = test_string_symbol[i];
+    }
+  }
+  virtual ~TestStringSymbolEncoding()
+  {
+    allocator_.free(col_types_);
+  }
+};
+
+TEST_F(TestStringSymbolEncoding, test_string_symbol)
+{
+  const int64_t row_cnt = 500;
+  const char *hosts[] = {"www.oceanbase.com", "open.oceanbase.com", "ask.oceanbase.com"};
+  const char *paths[] = {"docs/community/observer", "blog/details", "quiz/product/question"};
+  ctx_.major_working_cluster_version_ = CLUSTER_CURRENT_VERSION;
+  ctx_.column_encodings_ = static_cast<int64_t *>(allocator_.alloc(sizeof(int64_t) * column_cnt_));
+  ctx_.column_encodings_[0] = ObColumnHeader::Type::RAW;
+  ctx_.column_encodings_[1] = ObColumnHeader::Type::STRING_SYMBOL;
+  ObMicroBlockEncoder encoder;
+  ASSERT_EQ(OB_SUCCESS, encoder.init(ctx_));
+
+  ObDatumRow row;
+  ASSERT_EQ(OB_SUCCESS, row.init(allocator_, column_cnt_));
+  char urls[row_cnt][128];
+  for (int64_t i = 0; i < row_cnt; ++i) {
+    row.storage_datums_[0].set_int(i);
+    const int64_t len = snprintf(urls[i], sizeof(urls[i]), "https://%s/%s?id=%ld&from=search",
+        hosts[i % 3], paths[(i / 3) % 3], i * 7919 % 1000);
+    if (0 == i % 13) {
+      row.storage_datums_[1].set_null();
+    } else {
+      row.storage_datums_[1].set_string(urls[i], static_cast<int32_t>(len));
+    }
+    ASSERT_EQ(OB_SUCCESS, encoder.append_row(row));
+  }
+
+  char *buf = nullptr;
+  int64_t size = 0;
+  ASSERT_EQ(OB_SUCCESS, encoder.build_block(buf, size));
+  ASSERT_EQ(ObColumnHeader::STRING_SYMBOL, encoder.encoders_.at(1)->get_type());
+
+  ObMicroBlockData micro_data(buf, size);
+  ObMicroBlockDecoder decoder;
+  ObDatumRow read_row;
+  ASSERT_EQ(OB_SUCCESS, read_row.init(column_cnt_));
+  ASSERT_EQ(OB_SUCCESS, decoder.init(micro_data, read_info_));
+  for (int64_t i = row_cnt - 1; i >= 0; --i) {
+    ASSERT_EQ(OB_SUCCESS, decoder.get_row(i, read_row));
+    if (0 == i % 13) {
+      ASSERT_TRUE(read_row.storage_datums_[1].is_null());
+    } else {
+      ASSERT_EQ(ObString(urls[i]), read_row.storage_datums_[1].get_string());
+    }
+  }
+
+  // equal strings are compressed to equal codes by a table rebuilt from meta
+  const ObStringSymbolHeader *header = static_cast<ObStringSymbolEncoder *>(
+      encoder.encoders_.at(1))->header_;
+  ObStringSymbolTable table;
+  table.build(*header);
+  unsigned char codes[2][256];
+  char decompressed[128 + ObStringSymbolHeader::MAX_SYMBOL_LEN];
+  const int64_t url_len = static_cast<int64_t>(strlen(urls[1]));
+  const int64_t code_len = table.compress(urls[1], url_len, codes[0]);
+  ASSERT_LT(code_len, url_len);
+  ASSERT_EQ(code_len, table.compress(urls[1], url_len, codes[1]));
+  ASSERT_EQ(0, MEMCMP(codes[0], codes[1], code_len));
+  ASSERT_EQ(url_len, header->decompress(codes[0], code_len, decompressed));
+  ASSERT_EQ(0, MEMCMP(urls[1], decompressed, url_len));
+}
+
 class TestEncodingRowBufHolder : public ::testing::Test
 {
 public:
@@ -0,0 +1,177 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+
+#define private public
+#define protected public
+
+#include "storage/compaction/ob_compaction_governor.h"
+
+namespace oceanbase
+{
+using namespace common;
+using namespace share;
+using namespace compaction;
+
+namespace unittest
+{
+class TestCompactionGovernor : public ::testing::Test
+{
+public:
+  TestCompactionGovernor() {}
+  virtual ~TestCompactionGovernor() {}
+};
+
+TEST_F(TestCompactionGovernor, rt_bucket)
+{
+  for (int64_t rt = 0; rt < 100000; ++rt) {
+    const int64_t idx = ObCompactionGovernor::get_rt_bucket_idx(rt);
+    ASSERT_LT(rt, ObCompactionGovernor::get_rt_bucket_upper_bound(idx));
+    if (idx > 0) {
+      ASSERT_GE(rt, ObCompactionGovernor::get_rt_bucket_upper_bound(idx - 1));
+    }
+  }
+  ASSERT_EQ(ObCompactionGovernor::RT_BUCKET_CNT - 1, ObCompactionGovernor::get_rt_bucket_idx(INT64_MAX));
+  ASSERT_EQ(0, ObCompactionGovernor::get_rt_bucket_idx(-1));
+}
+
+TEST_F(TestCompactionGovernor, rt_percentile)
+{
+  int64_t buckets[ObCompactionGovernor::RT_BUCKET_CNT];
+  MEMSET(buckets, 0, sizeof(buckets));
+  ASSERT_EQ(0, ObCompactionGovernor::calc_rt_percentile(buckets, 0, 99));
+
+  // 990 requests of 100us and 10 requests of 10ms
+  buckets[ObCompactionGovernor::get_rt_bucket_idx(100)] += 990;
+  buckets[ObCompactionGovernor::get_rt_bucket_idx(10000)] += 10;
+  const int64_t p99 = ObCompactionGovernor::calc_rt_percentile(buckets, 1000, 99);
+  ASSERT_LT(100, p99);
+  ASSERT_GE(125, p99);
+  buckets[ObCompactionGovernor::get_rt_bucket_idx(10000)] += 1;
+  const int64_t p99_slow = ObCompactionGovernor::calc_rt_percentile(buckets, 1001, 99);
+  ASSERT_LT(10000, p99_slow);
+  ASSERT_GE(12500, p99_slow);
+}
+
+TEST_F(TestCompactionGovernor, next_throttle)
+{
+  const int64_t target_rt = 10 * 1000;
+  const int64_t MB = 1L << 20;
+  int64_t io_bandwidth_baseline = 0;
+  ObCompactionThrottleInfo info;
+  ASSERT_FALSE(info.is_throttled());
+
+  // slow foreground requests halve the merge concurrency and cap compaction io
+  info.fg_request_cnt_ = 1000;
+  info.fg_rt_us_ = 2 * target_rt;
+  ObCompactionGovernor::calc_next_throttle(target_rt, 80 * MB, io_bandwidth_baseline, info);
+  ASSERT_TRUE(info.is_throttled());
+  ASSERT_EQ(50, info.concurrency_pct_);
+  ASSERT_EQ(80 * MB, io_bandwidth_baseline);
+  ASSERT_EQ(40 * MB, info.io_bandwidth_limit_);
+
+  // the baseline is kept while throttled
+  ObCompactionGovernor::calc_next_throttle(target_rt, 40 * MB, io_bandwidth_baseline, info);
+  ASSERT_EQ(25, info.concurrency_pct_);
+  ASSERT_EQ(80 * MB, io_bandwidth_baseline);
+  ASSERT_EQ(20 * MB, info.io_bandwidth_limit_);
+  for (int64_t i = 0; i < 10; ++i) {
+    ObCompactionGovernor::calc_next_throttle(target_rt, MB, io_bandwidth_baseline, info);
+  }
+  ASSERT_EQ(ObCompactionGovernor::MIN_CONCURRENCY_PCT, info.concurrency_pct_);
+  ASSERT_EQ(8 * MB, info.io_bandwidth_limit_);
+
+  // deep user io queue is overload as well
+  info.fg_rt_us_ = target_rt / 2;
+  info.user_io_depth_ = ObCompactionGovernor::MAX_USER_IO_DEPTH + 1;
+  ObCompactionGovernor::calc_next_throttle(target_rt, MB, io_bandwidth_baseline, info);
+  ASSERT_EQ(ObCompactionGovernor::MIN_CONCURRENCY_PCT, info.concurrency_pct_);
+
+  // between 80% and 100% of the target, keep the current throttle
+  info.user_io_depth_ = 0;
+  info.fg_rt_us_ = target_rt * 9 / 10;
+  ObCompactionGovernor::calc_next_throttle(target_rt, MB, io_bandwidth_baseline, info);
+  ASSERT_EQ(ObCompactionGovernor::MIN_CONCURRENCY_PCT, info.concurrency_pct_);
+
+  // restored step by step
+  info.fg_rt_us_ = target_rt / 2;
+  ObCompactionGovernor::calc_next_throttle(target_rt, MB, io_bandwidth_baseline, info);
+  ASSERT_EQ(20, info.concurrency_pct_);
+  ASSERT_EQ(16 * MB, info.io_bandwidth_limit_);
+  for (int64_t i = 0; i < 10; ++i) {
+    ObCompactionGovernor::calc_next_throttle(target_rt, MB, io_bandwidth_baseline, info);
+  }
+  ASSERT_FALSE(info.is_throttled());
+  ASSERT_EQ(0, info.io_bandwidth_limit_);
+
+  // too few requests to tell the p99
+  info.fg_request_cnt_ = ObCompactionGovernor::MIN_REQUEST_CNT - 1;
+  info.fg_rt_us_ = 2 * target_rt;
+  ObCompactionGovernor::calc_next_throttle(target_rt, MB, io_bandwidth_baseline, info);
+  ASSERT_FALSE(info.is_throttled());
+
+  // disabled
+  info.fg_request_cnt_ = 1000;
+  ObCompactionGovernor::calc_next_throttle(target_rt, MB, io_bandwidth_baseline, info);
+  ASSERT_TRUE(info.is_throttled());
+  ObCompactionGovernor::calc_next_throttle(0, MB, io_bandwidth_baseline, info);
+  ASSERT_FALSE(info.is_throttled());
+  ASSERT_EQ(0, info.io_bandwidth_limit_);
+  ASSERT_EQ(2 * target_rt, info.fg_rt_us_);
+}
+
+TEST_F(TestCompactionGovernor, io_throttle)
+{
+  const int64_t target_rt = 10 * 1000;
+  int64_t io_bandwidth_baseline = 0;
+  ObCompactionThrottleInfo info;
+  // the limit never falls below one macro block per second
+  info.fg_request_cnt_ = 1000;
+  info.fg_rt_us_ = 2 * target_rt;
+  ObCompactionGovernor::calc_next_throttle(target_rt, 1L << 20, io_bandwidth_baseline, info);
+  ASSERT_EQ(ObCompactionGovernor::MIN_IO_BANDWIDTH_LIMIT, info.io_bandwidth_limit_);
+
+  // only the merges of the COMPACTION_MID/LOW dags are throttled
+  ASSERT_TRUE(ObCompactionGovernor::need_throttle_io(storage::MINI_MINOR_MERGE));
+  ASSERT_TRUE(ObCompactionGovernor::need_throttle_io(storage::MINOR_MERGE));
+  ASSERT_TRUE(ObCompactionGovernor::need_throttle_io(storage::MAJOR_MERGE));
+  ASSERT_FALSE(ObCompactionGovernor::need_throttle_io(storage::MINI_MERGE));
+  ASSERT_FALSE(ObCompactionGovernor::need_throttle_io(storage::DDL_KV_MERGE));
+
+  // 1MB at 10MB/s keeps the next write 100ms away
+  ObCompactionGovernor governor;
+  governor.throttle_io(1L << 20);
+  ASSERT_EQ(1L << 20, governor.io_bytes_);
+  ASSERT_EQ(0, governor.io_throttle_ts_);
+  governor.io_bandwidth_limit_ = 10L << 20;
+  const int64_t start_ts = ObTimeUtility::current_time();
+  governor.throttle_io(1L << 20);
+  governor.throttle_io(1L << 20);
+  const int64_t cost_us = ObTimeUtility::current_time() - start_ts;
+  ASSERT_LE(100 * 1000, cost_us);
+  ASSERT_GT(1000 * 1000, cost_us);
+  ASSERT_EQ(3L << 20, governor.io_bytes_);
+}
+
+}  // end namespace unittest
+}  // end namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  system("rm -f test_compaction_governor.log*");
+  OB_LOGGER.set_file_name("test_compaction_governor.log");
+  CLOG_LOG(INFO, "begin unittest: test_compaction_governor");
+  oceanbase::common::ObLogger::get_logger().set_log_level("INFO");
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -868,6 +868,49 @@ TEST_F(TestCompactionPolicy, check_no_need_major_merge)
 }
 
 
+TEST_F(TestCompactionPolicy, tiered_merge_window)
+{
+  const int64_t MB = 1024L * 1024L;
+  ObSEArray<int64_t, 16> table_sizes;
+  int64_t start_idx = 0;
+  int64_t end_idx = 0;
+  ASSERT_FALSE(ObPartitionMergePolicy::find_tiered_merge_window(table_sizes, 3, 4, start_idx, end_idx));
+
+  // a large L1 sstable followed by mini sstables: only the mini sstables are merged
+  ASSERT_EQ(OB_SUCCESS, table_sizes.push_back(512 * MB));
+  ASSERT_EQ(OB_SUCCESS, table_sizes.push_back(8 * MB));
+  ASSERT_EQ(OB_SUCCESS, table_sizes.push_back(4 * MB));
+  ASSERT_FALSE(ObPartitionMergePolicy::find_tiered_merge_window(table_sizes, 3, 4, start_idx, end_idx));
+  ASSERT_EQ(OB_SUCCESS, table_sizes.push_back(6 * MB));
+  ASSERT_TRUE(ObPartitionMergePolicy::find_tiered_merge_window(table_sizes, 3, 4, start_idx, end_idx));
+  ASSERT_EQ(1, start_idx);
+  ASSERT_EQ(4, end_idx);
+
+  // two tiers with enough sstables, prefer the one with more sstables
+  table_sizes.reset();
+  ASSERT_EQ(OB_SUCCESS, table_sizes.push_back(100 * MB));
+  ASSERT_EQ(OB_SUCCESS, table_sizes.push_back(120 * MB));
+  ASSERT_EQ(OB_SUCCESS, table_sizes.push_back(90 * MB));
+  ASSERT_EQ(OB_SUCCESS, table_sizes.push_back(10 * MB));
+  ASSERT_EQ(OB_SUCCESS, table_sizes.push_back(8 * MB));
+  ASSERT_EQ(OB_SUCCESS, table_sizes.push_back(9 * MB));
+  ASSERT_EQ(OB_SUCCESS, table_sizes.push_back(12 * MB));
+  ASSERT_TRUE(ObPartitionMergePolicy::find_tiered_merge_window(table_sizes, 3, 4, start_idx, end_idx));
+  ASSERT_EQ(3, start_idx);
+  ASSERT_EQ(7, end_idx);
+
+  // same count, prefer the smaller tier
+  table_sizes.pop_back();
+  ASSERT_TRUE(ObPartitionMergePolicy::find_tiered_merge_window(table_sizes, 3, 4, start_idx, end_idx));
+  ASSERT_EQ(3, start_idx);
+  ASSERT_EQ(6, end_idx);
+
+  // a larger size ratio merges the neighbour tiers together
+  ASSERT_TRUE(ObPartitionMergePolicy::find_tiered_merge_window(table_sizes, 3, 20, start_idx, end_idx));
+  ASSERT_EQ(0, start_idx);
+  ASSERT_EQ(6, end_idx);
+}
+
 } //unittest
 } //oceanbase
 
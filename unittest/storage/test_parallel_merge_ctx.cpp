@@ -0,0 +1,156 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+
+#define private public
+#define protected public
+
+#include "storage/compaction/ob_partition_parallel_merge_ctx.h"
+
+namespace oceanbase
+{
+using namespace common;
+using namespace storage;
+using namespace blocksstable;
+
+namespace unittest
+{
+class TestParallelMergeCtx : public ::testing::Test
+{
+public:
+  TestParallelMergeCtx() {}
+  virtual ~TestParallelMergeCtx() {}
+  void prepare_ctx(const int64_t range_cnt, const int64_t task_cnt, ObParallelMergeCtx &ctx);
+};
+
+void TestParallelMergeCtx::prepare_ctx(const int64_t range_cnt, const int64_t task_cnt, ObParallelMergeCtx &ctx)
+{
+  ObDatumRange range;
+  range.set_whole_range();
+  for (int64_t i = 0; i < range_cnt; ++i) {
+    ASSERT_EQ(OB_SUCCESS, ctx.range_array_.push_back(range));
+  }
+  ctx.concurrent_cnt_ = range_cnt;
+  ctx.parallel_type_ = ObParallelMergeCtx::PARALLEL_MINI_MINOR;
+  ASSERT_EQ(OB_SUCCESS, ctx.init_range_runs(task_cnt));
+  ctx.is_inited_ = true;
+  ASSERT_TRUE(ctx.is_valid());
+}
+
+TEST_F(TestParallelMergeCtx, static_ranges)
+{
+  ObParallelMergeCtx ctx;
+  prepare_ctx(5, 5, ctx);
+  ASSERT_FALSE(ctx.is_dynamic_split());
+  int64_t next_idx = 0;
+  for (int64_t i = 0; i < 4; ++i) {
+    ASSERT_EQ(OB_SUCCESS, ctx.get_next_task_idx(i, next_idx));
+    ASSERT_EQ(i + 1, next_idx);
+  }
+  ASSERT_EQ(OB_ITER_END, ctx.get_next_task_idx(4, next_idx));
+  ASSERT_EQ(OB_ITER_END, ctx.get_next_range_idx(0, next_idx));
+  ASSERT_EQ(OB_ITER_END, ctx.steal_ranges(next_idx));
+}
+
+TEST_F(TestParallelMergeCtx, task_idx)
+{
+  for (int64_t range_cnt = 2; range_cnt <= 64; ++range_cnt) {
+    for (int64_t task_cnt = 1; task_cnt < range_cnt; ++task_cnt) {
+      ObParallelMergeCtx ctx;
+      prepare_ctx(range_cnt, task_cnt, ctx);
+      ASSERT_TRUE(ctx.is_dynamic_split());
+      int64_t task_idx = 0;
+      int64_t cnt = 1;
+      int64_t next_idx = 0;
+      while (OB_SUCCESS == ctx.get_next_task_idx(task_idx, next_idx)) {
+        ASSERT_EQ(cnt * range_cnt / task_cnt, next_idx);
+        task_idx = next_idx;
+        ++cnt;
+      }
+      ASSERT_EQ(task_cnt, cnt);
+    }
+  }
+}
+
+TEST_F(TestParallelMergeCtx, steal_ranges)
+{
+  const int64_t range_cnt = 40;
+  const int64_t task_cnt = 4;
+  ObParallelMergeCtx ctx;
+  prepare_ctx(range_cnt, task_cnt, ctx);
+
+  // task 0 merges one range in each round, the others are ten times faster and keep stealing
+  int64_t owners[range_cnt];
+  int64_t run_idxs[task_cnt];
+  bool finished[task_cnt];
+  for (int64_t i = 0; i < range_cnt; ++i) {
+    owners[i] = -1;
+  }
+  run_idxs[0] = 0;
+  finished[0] = false;
+  owners[0] = 0;
+  for (int64_t i = 1; i < task_cnt; ++i) {
+    ASSERT_EQ(OB_SUCCESS, ctx.get_next_task_idx(run_idxs[i - 1], run_idxs[i]));
+    owners[run_idxs[i]] = run_idxs[i];
+    finished[i] = false;
+  }
+  int64_t finished_cnt = 0;
+  while (finished_cnt < task_cnt) {
+    for (int64_t i = 0; i < task_cnt; ++i) {
+      for (int64_t j = 0; !finished[i] && j < (0 == i ? 1 : 10); ++j) {
+        int64_t range_idx = 0;
+        int ret = ctx.get_next_range_idx(run_idxs[i], range_idx);
+        if (OB_SUCCESS == ret) {
+          ASSERT_EQ(-1, owners[range_idx]);
+          ASSERT_EQ(run_idxs[i], owners[range_idx - 1]);
+          owners[range_idx] = run_idxs[i];
+        } else if (OB_ITER_END == ret) {
+          ret = ctx.steal_ranges(run_idxs[i]);
+          if (OB_SUCCESS == ret) {
+            ASSERT_EQ(-1, owners[run_idxs[i]]);
+            owners[run_idxs[i]] = run_idxs[i];
+          } else {
+            ASSERT_EQ(OB_ITER_END, ret);
+            finished[i] = true;
+            ++finished_cnt;
+          }
+        } else {
+          ASSERT_EQ(OB_SUCCESS, ret);
+        }
+      }
+    }
+  }
+  // every range is merged once, task 0 keeps only a few of its own
+  int64_t task0_range_cnt = 0;
+  for (int64_t i = 0; i < range_cnt; ++i) {
+    ASSERT_LE(0, owners[i]);
+    ASSERT_LE(owners[i], i);
+    if (0 == owners[i]) {
+      ++task0_range_cnt;
+    }
+  }
+  ASSERT_GT(range_cnt / task_cnt, task0_range_cnt);
+}
+
+}  // end namespace unittest
+}  // end namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  system("rm -f test_parallel_merge_ctx.log*");
+  OB_LOGGER.set_file_name("test_parallel_merge_ctx.log");
+  CLOG_LOG(INFO, "begin unittest: test_parallel_merge_ctx");
+  oceanbase::common::ObLogger::get_logger().set_log_level("INFO");
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
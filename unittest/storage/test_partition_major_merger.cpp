@@ -0,0 +1,313 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX STORAGE
+#include <gtest/gtest.h>
+#define private public
+#define protected public
+#include "storage/compaction/ob_partition_merger.h"
+#include "storage/compaction/ob_partition_merge_iter.h"
+#include "storage/compaction/ob_partition_merge_fuser.h"
+#include "storage/compaction/ob_tablet_merge_ctx.h"
+#include "storage/blocksstable/ob_macro_block_writer.h"
+#include "storage/blocksstable/ob_macro_block_meta.h"
+
+namespace oceanbase
+{
+using namespace common;
+using namespace blocksstable;
+using namespace compaction;
+
+namespace unittest
+{
+
+class MockMicroBlockWriter : public ObIMicroBlockWriter
+{
+public:
+  MockMicroBlockWriter() : row_cnt_(0), block_size_(0) {}
+  virtual ~MockMicroBlockWriter() {}
+  virtual int append_row(const ObDatumRow &row) override { UNUSED(row); return OB_NOT_SUPPORTED; }
+  virtual int build_block(char *&buf, int64_t &size) override { UNUSEDx(buf, size); return OB_NOT_SUPPORTED; }
+  virtual int64_t get_row_count() const override { return row_cnt_; }
+  virtual int64_t get_data_size() const override { return block_size_; }
+  virtual int64_t get_block_size() const override { return block_size_; }
+  virtual int64_t get_column_count() const override { return 1; }
+  virtual int64_t get_original_size() const override { return block_size_; }
+  virtual void reset() override { row_cnt_ = 0; block_size_ = 0; }
+
+  int64_t row_cnt_;
+  int64_t block_size_;
+};
+
+class MockMergeIter : public ObPartitionMergeIter
+{
+public:
+  MockMergeIter() : open_cnt_(0), opened_for_rewrite_(false) {}
+  virtual ~MockMergeIter() {}
+  virtual int next() override { return OB_ITER_END; }
+  virtual int open_curr_range(const bool for_rewrite, const bool for_compare = false) override
+  {
+    UNUSED(for_compare);
+    ++open_cnt_;
+    opened_for_rewrite_ = for_rewrite;
+    return OB_SUCCESS;
+  }
+  virtual bool inner_check(const ObMergeParameter &merge_param) override { UNUSED(merge_param); return true; }
+  virtual int inner_init(const ObMergeParameter &merge_param) override { UNUSED(merge_param); return OB_SUCCESS; }
+
+  int64_t open_cnt_;
+  bool opened_for_rewrite_;
+};
+
+class MockMergeFuser : public ObIPartitionMergeFuser
+{
+public:
+  MockMergeFuser() : fuse_cnt_(0) {}
+  virtual ~MockMergeFuser() {}
+  virtual bool is_valid() const override { return true; }
+  virtual int fuse_row(MERGE_ITER_ARRAY &macro_row_iters) override
+  {
+    UNUSED(macro_row_iters);
+    ++fuse_cnt_;
+    return OB_SUCCESS;
+  }
+  virtual const char *get_fuser_name() const override { return "MockMergeFuser"; }
+  virtual int inner_check_merge_param(const ObMergeParameter &merge_param) override { UNUSED(merge_param); return OB_SUCCESS; }
+  virtual int inner_init(const ObMergeParameter &merge_param) override { UNUSED(merge_param); return OB_SUCCESS; }
+  virtual int fuse_delete_row(ObPartitionMergeIter *row_iter, ObDatumRow &row,
+                              const int64_t rowkey_column_cnt) override
+  {
+    UNUSEDx(row_iter, row, rowkey_column_cnt);
+    return OB_NOT_SUPPORTED;
+  }
+
+  int64_t fuse_cnt_;
+};
+
+class TestPartitionMajorMerger : public ::testing::Test
+{
+public:
+  static const int64_t MICRO_BLOCK_SIZE = 16L << 10;
+  static const int64_t MACRO_BLOCK_SIZE = 2L << 20;
+  TestPartitionMajorMerger()
+    : allocator_(), desc_(), micro_writer_(), macro_writer_(), merge_param_(), merge_ctx_(merge_param_, allocator_),
+      rowkey_datum_(), macro_meta_(), macro_desc_()
+  {}
+  virtual ~TestPartitionMajorMerger() {}
+  virtual void SetUp() override;
+  virtual void TearDown() override;
+  void prepare_micro_block(const int64_t data_length, ObMicroBlock &micro_block);
+  void prepare_merger(ObPartitionMajorMerger &merger, MockMergeFuser &fuser);
+  void release_merger(ObPartitionMajorMerger &merger);
+
+  ObArenaAllocator allocator_;
+  ObDataStoreDesc desc_;
+  MockMicroBlockWriter micro_writer_;
+  ObMacroBlockWriter macro_writer_;
+  ObTabletMergeDagParam merge_param_;
+  ObTabletMergeCtx merge_ctx_;
+  ObStorageDatum rowkey_datum_;
+  ObDataMacroBlockMeta macro_meta_;
+  ObMacroBlockDesc macro_desc_;
+  char block_buf_[8];
+};
+
+void TestPartitionMajorMerger::SetUp()
+{
+  desc_.micro_block_size_ = MICRO_BLOCK_SIZE;
+  desc_.macro_block_size_ = MACRO_BLOCK_SIZE;
+  macro_writer_.data_store_desc_ = &desc_;
+  macro_writer_.micro_writer_ = &micro_writer_;
+
+  // a macro block well above the rewrite threshold, written in an older progressive round
+  rowkey_datum_.set_int(1);
+  macro_meta_.val_.rowkey_count_ = 1;
+  macro_meta_.val_.column_count_ = 1;
+  macro_meta_.val_.compressor_type_ = ObCompressorType::NONE_COMPRESSOR;
+  macro_meta_.val_.row_store_type_ = ENCODING_ROW_STORE;
+  macro_meta_.val_.logic_id_.logic_version_ = 1;
+  macro_meta_.val_.logic_id_.tablet_id_ = 200001;
+  macro_meta_.val_.macro_id_ = MacroBlockId(0, 1, 0);
+  macro_meta_.val_.data_zsize_ = MACRO_BLOCK_SIZE / 2;
+  macro_meta_.val_.progressive_merge_round_ = 1;
+  macro_meta_.end_key_.assign(&rowkey_datum_, 1);
+  macro_desc_.macro_meta_ = &macro_meta_;
+  ASSERT_TRUE(macro_desc_.is_valid_with_macro_meta());
+
+  merge_ctx_.progressive_merge_num_ = 0;
+  merge_ctx_.progressive_merge_round_ = 1;
+  merge_ctx_.progressive_merge_step_ = 0;
+}
+
+void TestPartitionMajorMerger::TearDown()
+{
+  // owned by the test, don't let the writer free them
+  macro_writer_.data_store_desc_ = nullptr;
+  macro_writer_.micro_writer_ = nullptr;
+}
+
+void TestPartitionMajorMerger::prepare_micro_block(const int64_t data_length, ObMicroBlock &micro_block)
+{
+  micro_block.range_.set_whole_range();
+  micro_block.header_.column_count_ = 1;
+  micro_block.header_.rowkey_column_count_ = 1;
+  micro_block.header_.row_store_type_ = ENCODING_ROW_STORE;
+  micro_block.header_.header_size_ = ObMicroBlockHeader::get_serialize_size(1, false);
+  micro_block.header_.data_length_ = data_length;
+  micro_block.data_.buf_ = block_buf_;
+  micro_block.data_.size_ = sizeof(block_buf_);
+  // only checked to be set
+  micro_block.read_info_ = reinterpret_cast<const ObTableReadInfo *>(block_buf_);
+  micro_block.micro_index_info_ = reinterpret_cast<const ObMicroIndexInfo *>(block_buf_);
+  ASSERT_TRUE(micro_block.is_valid());
+}
+
+void TestPartitionMajorMerger::prepare_merger(ObPartitionMajorMerger &merger, MockMergeFuser &fuser)
+{
+  merger.is_inited_ = true;
+  merger.merge_ctx_ = &merge_ctx_;
+  merger.macro_writer_ = &macro_writer_;
+  merger.partition_fuser_ = &fuser;
+}
+
+void TestPartitionMajorMerger::release_merger(ObPartitionMajorMerger &merger)
+{
+  merger.merge_ctx_ = nullptr;
+  merger.macro_writer_ = nullptr;
+  merger.partition_fuser_ = nullptr;
+  merger.is_inited_ = false;
+}
+
+TEST_F(TestPartitionMajorMerger, micro_block_reuse)
+{
+  ObMicroBlock micro_block;
+  bool need_merge = false;
+
+  // well sized micro block with nothing pending is copied as is
+  prepare_micro_block(MICRO_BLOCK_SIZE * 3 / 4, micro_block);
+  ASSERT_EQ(OB_SUCCESS, macro_writer_.check_micro_block_need_merge(micro_block, need_merge));
+  ASSERT_FALSE(need_merge);
+
+  // still reused behind the pending rows of a rewritten neighbour which can't share one block
+  micro_writer_.row_cnt_ = 10;
+  micro_writer_.block_size_ = MICRO_BLOCK_SIZE / 2;
+  ASSERT_EQ(OB_SUCCESS, macro_writer_.check_micro_block_need_merge(micro_block, need_merge));
+  ASSERT_FALSE(need_merge);
+
+  // a small tail of pending rows fitting into the same micro block is merged
+  micro_writer_.block_size_ = MICRO_BLOCK_SIZE / 8;
+  ASSERT_EQ(OB_SUCCESS, macro_writer_.check_micro_block_need_merge(micro_block, need_merge));
+  ASSERT_TRUE(need_merge);
+}
+
+TEST_F(TestPartitionMajorMerger, micro_block_rewrite)
+{
+  ObMicroBlock micro_block;
+  bool need_merge = false;
+
+  // small micro blocks are always decoded to be consolidated
+  prepare_micro_block(MICRO_BLOCK_SIZE / 2, micro_block);
+  ASSERT_EQ(OB_SUCCESS, macro_writer_.check_micro_block_need_merge(micro_block, need_merge));
+  ASSERT_TRUE(need_merge);
+  micro_writer_.row_cnt_ = 10;
+  micro_writer_.block_size_ = MICRO_BLOCK_SIZE;
+  ASSERT_EQ(OB_SUCCESS, macro_writer_.check_micro_block_need_merge(micro_block, need_merge));
+  ASSERT_TRUE(need_merge);
+
+  ObMicroBlock invalid_block;
+  ASSERT_EQ(OB_INVALID_ARGUMENT, macro_writer_.check_micro_block_need_merge(invalid_block, need_merge));
+}
+
+TEST_F(TestPartitionMajorMerger, small_macro_block_rewrite)
+{
+  ObPartitionMajorMerger merger;
+  MockMergeFuser fuser;
+  MockMergeIter iter;
+  MERGE_ITER_ARRAY minimum_iters;
+  bool rewrite = false;
+  prepare_merger(merger, fuser);
+  ASSERT_EQ(OB_SUCCESS, minimum_iters.push_back(&iter));
+
+  // large macro blocks are reused
+  ASSERT_EQ(OB_SUCCESS, merger.try_rewrite_macro_block(macro_desc_, rewrite));
+  ASSERT_FALSE(rewrite);
+  ASSERT_FALSE(merger.is_progressive_rewrite_);
+
+  // small macro blocks are rewritten, opened at micro level to reuse the micro blocks
+  macro_meta_.val_.data_zsize_ = MACRO_BLOCK_SIZE * ObMacroBlockWriter::DEFAULT_MACRO_BLOCK_REWRTIE_THRESHOLD / 100 - 1;
+  ASSERT_EQ(OB_SUCCESS, merger.try_rewrite_macro_block(macro_desc_, rewrite));
+  ASSERT_TRUE(rewrite);
+  ASSERT_FALSE(merger.is_progressive_rewrite_);
+  ASSERT_EQ(OB_SUCCESS, merger.rewrite_macro_block(minimum_iters));
+  ASSERT_EQ(1, iter.open_cnt_);
+  ASSERT_FALSE(iter.opened_for_rewrite_);
+  ASSERT_EQ(0, fuser.fuse_cnt_);
+
+  // only one iter can be rewritten
+  ASSERT_EQ(OB_SUCCESS, minimum_iters.push_back(&iter));
+  ASSERT_EQ(OB_INNER_STAT_ERROR, merger.rewrite_macro_block(minimum_iters));
+  release_merger(merger);
+}
+
+TEST_F(TestPartitionMajorMerger, progressive_rewrite)
+{
+  ObPartitionMajorMerger merger;
+  MockMergeFuser fuser;
+  MockMergeIter iter;
+  MERGE_ITER_ARRAY minimum_iters;
+  bool rewrite = false;
+  prepare_merger(merger, fuser);
+  ASSERT_EQ(OB_SUCCESS, minimum_iters.push_back(&iter));
+  merge_ctx_.progressive_merge_num_ = 2;
+  merge_ctx_.progressive_merge_round_ = 2;
+  merger.need_rewrite_block_cnt_ = 1;
+
+  // progressive rewrite re-encodes every row of the macro block
+  ASSERT_EQ(OB_SUCCESS, merger.try_rewrite_macro_block(macro_desc_, rewrite));
+  ASSERT_TRUE(rewrite);
+  ASSERT_TRUE(merger.is_progressive_rewrite_);
+  ASSERT_EQ(1, merger.rewrite_block_cnt_);
+  ObDatumRow row;
+  iter.curr_row_ = &row;
+  iter.iter_end_ = true;
+  ASSERT_EQ(OB_SUCCESS, merger.rewrite_macro_block(minimum_iters));
+  ASSERT_EQ(1, iter.open_cnt_);
+  ASSERT_TRUE(iter.opened_for_rewrite_);
+
+  // the progressive quota is used up, the large macro block is reused and the flag is cleared
+  ASSERT_EQ(OB_SUCCESS, merger.try_rewrite_macro_block(macro_desc_, rewrite));
+  ASSERT_FALSE(rewrite);
+  ASSERT_FALSE(merger.is_progressive_rewrite_);
+
+  // a small macro block out of the quota is rewritten at micro level
+  macro_meta_.val_.data_zsize_ = 1;
+  iter.curr_row_ = nullptr;
+  ASSERT_EQ(OB_SUCCESS, merger.try_rewrite_macro_block(macro_desc_, rewrite));
+  ASSERT_TRUE(rewrite);
+  ASSERT_FALSE(merger.is_progressive_rewrite_);
+  ASSERT_EQ(OB_SUCCESS, merger.rewrite_macro_block(minimum_iters));
+  ASSERT_EQ(2, iter.open_cnt_);
+  ASSERT_FALSE(iter.opened_for_rewrite_);
+  release_merger(merger);
+}
+
+} // end namespace unittest
+} // end namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  system("rm -f test_partition_major_merger.log*");
+  OB_LOGGER.set_file_name("test_partition_major_merger.log", true);
+  OB_LOGGER.set_log_level("INFO");
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
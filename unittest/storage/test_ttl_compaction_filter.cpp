@@ -0,0 +1,319 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+
+#define private public
+#define protected public
+
+#include "storage/compaction/ob_i_compaction_filter.h"
+#include "storage/compaction/ob_tablet_merge_ctx.h"
+#include "storage/access/ob_multiple_merge.h"
+#include "storage/blocksstable/ob_datum_row.h"
+#include "share/schema/ob_table_schema.h"
+#include "share/schema/ob_table_dml_param.h"
+
+namespace oceanbase
+{
+using namespace common;
+using namespace share::schema;
+using namespace blocksstable;
+using namespace compaction;
+using namespace storage;
+
+namespace unittest
+{
+static const int64_t USECS_PER_DAY = 24L * 3600L * 1000L * 1000L;
+
+class MockMultipleMerge : public ObMultipleMerge
+{
+public:
+  MockMultipleMerge() {}
+  virtual ~MockMultipleMerge() {}
+protected:
+  virtual int calc_scan_range() override { return OB_SUCCESS; }
+  virtual int construct_iters() override { return OB_SUCCESS; }
+  virtual int is_range_valid() const override { return OB_SUCCESS; }
+  virtual int inner_get_next_row(ObDatumRow &row) override { UNUSED(row); return OB_ITER_END; }
+  virtual void collect_merge_stat(ObTableStoreStat &stat) const override { UNUSED(stat); }
+};
+
+class TestTTLCompactionFilter : public ::testing::Test
+{
+public:
+  TestTTLCompactionFilter() : allocator_() {}
+  virtual ~TestTTLCompactionFilter() {}
+  // pk int, c1 int, gmt_create timestamp, expired one day after gmt_create
+  void prepare_schema(ObTableSchema &table_schema);
+  ObArenaAllocator allocator_;
+};
+
+void TestTTLCompactionFilter::prepare_schema(ObTableSchema &table_schema)
+{
+  const uint64_t table_id = 500001;
+  const char *names[] = {"pk", "c1", "gmt_create"};
+  const ObObjType types[] = {ObIntType, ObIntType, ObTimestampType};
+  ObColumnSchemaV2 column;
+  table_schema.reset();
+  ASSERT_EQ(OB_SUCCESS, table_schema.set_table_name("test_ttl"));
+  table_schema.set_tenant_id(1);
+  table_schema.set_database_id(1);
+  table_schema.set_table_id(table_id);
+  table_schema.set_rowkey_column_num(1);
+  table_schema.set_max_used_column_id(OB_APP_MIN_COLUMN_ID + 2);
+  table_schema.set_compress_func_name("none");
+  table_schema.set_row_store_type(FLAT_ROW_STORE);
+  for (int64_t i = 0; i < 3; ++i) {
+    column.reset();
+    column.set_table_id(table_id);
+    column.set_column_id(OB_APP_MIN_COLUMN_ID + i);
+    ASSERT_EQ(OB_SUCCESS, column.set_column_name(names[i]));
+    column.set_data_type(types[i]);
+    column.set_collation_type(CS_TYPE_BINARY);
+    column.set_rowkey_position(0 == i ? 1 : 0);
+    ASSERT_EQ(OB_SUCCESS, table_schema.add_column(column));
+  }
+  ASSERT_EQ(OB_SUCCESS, table_schema.set_expire_info("gmt_create + INTERVAL 1 DAY"));
+}
+
+TEST_F(TestTTLCompactionFilter, parse_expire_info)
+{
+  ObString column_name;
+  int64_t ttl_us = 0;
+  ASSERT_EQ(OB_SUCCESS, ObTableTTLParam::parse_expire_info("c1 + INTERVAL 1 DAY", column_name, ttl_us));
+  ASSERT_EQ(0, column_name.compare("c1"));
+  ASSERT_EQ(USECS_PER_DAY, ttl_us);
+
+  ASSERT_EQ(OB_SUCCESS, ObTableTTLParam::parse_expire_info("`gmt_create`+interval 30 second", column_name, ttl_us));
+  ASSERT_EQ(0, column_name.compare("gmt_create"));
+  ASSERT_EQ(30L * 1000L * 1000L, ttl_us);
+
+  ASSERT_EQ(OB_SUCCESS, ObTableTTLParam::parse_expire_info("  c1  +  INTERVAL  2  week ", column_name, ttl_us));
+  ASSERT_EQ(14 * USECS_PER_DAY, ttl_us);
+
+  ASSERT_EQ(OB_NOT_SUPPORTED, ObTableTTLParam::parse_expire_info("", column_name, ttl_us));
+  ASSERT_EQ(OB_NOT_SUPPORTED, ObTableTTLParam::parse_expire_info("c1 < now()", column_name, ttl_us));
+  ASSERT_EQ(OB_NOT_SUPPORTED, ObTableTTLParam::parse_expire_info("c1 + INTERVAL 0 DAY", column_name, ttl_us));
+  ASSERT_EQ(OB_NOT_SUPPORTED, ObTableTTLParam::parse_expire_info("c1 + INTERVAL -1 DAY", column_name, ttl_us));
+  ASSERT_EQ(OB_NOT_SUPPORTED, ObTableTTLParam::parse_expire_info("c1 + INTERVAL 1 MONTH", column_name, ttl_us));
+  ASSERT_EQ(OB_NOT_SUPPORTED, ObTableTTLParam::parse_expire_info("c1 + INTERVAL 1 DAY + 1", column_name, ttl_us));
+  ASSERT_EQ(OB_NOT_SUPPORTED,
+      ObTableTTLParam::parse_expire_info("c1 + INTERVAL 99999999999999999999 SECOND", column_name, ttl_us));
+  ASSERT_EQ(OB_NOT_SUPPORTED,
+      ObTableTTLParam::parse_expire_info("c1 + INTERVAL 9999999999999 WEEK", column_name, ttl_us));
+}
+
+TEST_F(TestTTLCompactionFilter, is_expired)
+{
+  const int64_t now_us = 1700000000L * 1000L * 1000L;
+  const int64_t snapshot_version = now_us * 1000L;
+  ObStorageDatum datum;
+  ASSERT_FALSE(ObTableTTLParam::is_expired(datum, USECS_PER_DAY, snapshot_version)); // nop
+  datum.set_null();
+  ASSERT_FALSE(ObTableTTLParam::is_expired(datum, USECS_PER_DAY, snapshot_version));
+  datum.reuse();
+  datum.set_timestamp(now_us - USECS_PER_DAY + 1);
+  ASSERT_FALSE(ObTableTTLParam::is_expired(datum, USECS_PER_DAY, snapshot_version));
+  datum.set_timestamp(now_us - USECS_PER_DAY);
+  ASSERT_TRUE(ObTableTTLParam::is_expired(datum, USECS_PER_DAY, snapshot_version));
+}
+
+TEST_F(TestTTLCompactionFilter, filter)
+{
+  const int64_t now_us = 1700000000L * 1000L * 1000L;
+  ObTTLCompactionFilter filter;
+  ObTableTTLParam ttl_param;
+  ObDatumRow row;
+  ObICompactionFilter::ObFilterRet filter_ret = ObICompactionFilter::FILTER_RET_MAX;
+  ASSERT_EQ(OB_SUCCESS, row.init(allocator_, 4));
+  row.storage_datums_[0].set_int(1);
+  row.storage_datums_[1].set_int(-now_us * 1000L);
+  row.storage_datums_[2].set_int(0);
+  row.storage_datums_[3].set_timestamp(now_us - 2 * USECS_PER_DAY);
+
+  ASSERT_EQ(OB_NOT_INIT, filter.filter(row, filter_ret));
+  ASSERT_EQ(OB_INVALID_ARGUMENT, filter.init(ttl_param, now_us * 1000L, false));
+  ttl_param.col_idx_ = 3;
+  ttl_param.ttl_us_ = USECS_PER_DAY;
+  ASSERT_EQ(OB_SUCCESS, filter.init(ttl_param, now_us * 1000L, true));
+  ASSERT_TRUE(filter.is_full_merge_);
+  filter.reset();
+  ASSERT_EQ(OB_SUCCESS, filter.init(ttl_param, now_us * 1000L, false));
+  ASSERT_FALSE(filter.is_full_merge_);
+
+  ASSERT_EQ(OB_SUCCESS, filter.filter(row, filter_ret));
+  ASSERT_EQ(ObICompactionFilter::FILTER_RET_REMOVE, filter_ret);
+  row.storage_datums_[3].set_timestamp(now_us);
+  ASSERT_EQ(OB_SUCCESS, filter.filter(row, filter_ret));
+  ASSERT_EQ(ObICompactionFilter::FILTER_RET_NOT_CHANGE, filter_ret);
+  row.storage_datums_[3].set_nop();
+  ASSERT_EQ(OB_SUCCESS, filter.filter(row, filter_ret));
+  ASSERT_EQ(ObICompactionFilter::FILTER_RET_NOT_CHANGE, filter_ret);
+
+  row.count_ = 3;
+  ASSERT_EQ(OB_INVALID_ARGUMENT, filter.filter(row, filter_ret));
+}
+
+TEST_F(TestTTLCompactionFilter, init_ttl_filter)
+{
+  const int64_t snapshot_version = 1700000000L * 1000L * 1000L * 1000L;
+  ObTableSchema table_schema;
+  ObTabletMergeDagParam param;
+  ObTabletMergeCtx ctx(param, allocator_);
+  prepare_schema(table_schema);
+  ctx.sstable_version_range_.snapshot_version_ = snapshot_version;
+
+  // no table schema or no expire info, no filter
+  ASSERT_EQ(OB_SUCCESS, ctx.init_ttl_filter());
+  ASSERT_TRUE(nullptr == ctx.compaction_filter_);
+  ObTableSchema no_ttl_schema;
+  ASSERT_EQ(OB_SUCCESS, no_ttl_schema.assign(table_schema));
+  ASSERT_EQ(OB_SUCCESS, no_ttl_schema.set_expire_info(ObString()));
+  ctx.schema_ctx_.table_schema_ = &no_ttl_schema;
+  ctx.schema_ctx_.merge_schema_ = &no_ttl_schema;
+  ASSERT_EQ(OB_SUCCESS, ctx.init_ttl_filter());
+  ASSERT_TRUE(nullptr == ctx.compaction_filter_);
+
+  ctx.schema_ctx_.table_schema_ = &table_schema;
+  ctx.schema_ctx_.merge_schema_ = nullptr;
+  ASSERT_EQ(OB_ERR_UNEXPECTED, ctx.init_ttl_filter());
+  ASSERT_TRUE(nullptr == ctx.compaction_filter_);
+
+  // the ttl column is located in the multi version row: pk, trans version, sql sequence, c1, gmt_create
+  // no base sstable has expired rows, so no full merge is forced
+  ctx.schema_ctx_.merge_schema_ = &table_schema;
+  ASSERT_EQ(OB_SUCCESS, ctx.init_ttl_filter());
+  ASSERT_EQ(&ctx.ttl_filter_, ctx.compaction_filter_);
+  ASSERT_FALSE(ctx.ttl_filter_.is_full_merge_);
+  ASSERT_EQ(4, ctx.ttl_filter_.ttl_param_.col_idx_);
+  ASSERT_EQ(USECS_PER_DAY, ctx.ttl_filter_.ttl_param_.ttl_us_);
+  ASSERT_EQ(snapshot_version, ctx.ttl_filter_.snapshot_version_);
+  ctx.compaction_filter_ = nullptr;
+
+  // the ttl column must be a timestamp
+  ObTableSchema bad_schema;
+  ASSERT_EQ(OB_SUCCESS, bad_schema.assign(table_schema));
+  ASSERT_EQ(OB_SUCCESS, bad_schema.set_expire_info("c1 + INTERVAL 1 DAY"));
+  ctx.schema_ctx_.table_schema_ = &bad_schema;
+  ctx.schema_ctx_.merge_schema_ = &bad_schema;
+  ctx.ttl_filter_.reset();
+  ASSERT_EQ(OB_NOT_SUPPORTED, ctx.init_ttl_filter());
+  ASSERT_TRUE(nullptr == ctx.compaction_filter_);
+  ctx.schema_ctx_.table_schema_ = nullptr;
+  ctx.schema_ctx_.merge_schema_ = nullptr;
+}
+
+TEST_F(TestTTLCompactionFilter, dml_schema_param)
+{
+  ObTableSchema table_schema;
+  prepare_schema(table_schema);
+  ObTableSchemaParam schema_param(allocator_);
+  ASSERT_EQ(OB_SUCCESS, schema_param.convert(&table_schema));
+  // dml reads the columns in schema order: pk, c1, gmt_create
+  ASSERT_EQ(2, schema_param.get_ttl_param().col_idx_);
+  ASSERT_EQ(USECS_PER_DAY, schema_param.get_ttl_param().ttl_us_);
+
+  char buf[4096];
+  int64_t pos = 0;
+  ASSERT_EQ(OB_SUCCESS, schema_param.serialize(buf, sizeof(buf), pos));
+  ASSERT_EQ(pos, schema_param.get_serialize_size());
+  ObTableSchemaParam des_param(allocator_);
+  const int64_t data_len = pos;
+  pos = 0;
+  ASSERT_EQ(OB_SUCCESS, des_param.deserialize(buf, data_len, pos));
+  ASSERT_EQ(2, des_param.get_ttl_param().col_idx_);
+  ASSERT_EQ(USECS_PER_DAY, des_param.get_ttl_param().ttl_us_);
+
+  ObTableSchemaParam no_ttl_param(allocator_);
+  ASSERT_EQ(OB_SUCCESS, table_schema.set_expire_info(ObString()));
+  ASSERT_EQ(OB_SUCCESS, no_ttl_param.convert(&table_schema));
+  ASSERT_FALSE(no_ttl_param.get_ttl_param().is_valid());
+}
+
+TEST_F(TestTTLCompactionFilter, mask_expired_row_on_read)
+{
+  const int64_t now_us = 1700000000L * 1000L * 1000L;
+  MockMultipleMerge merge;
+  ObTableAccessParam access_param;
+  ObTableAccessContext access_ctx;
+  ObTableTTLParam ttl_param;
+  ObSEArray<int32_t, 2> out_cols_project;
+  ObDatumRow in_row;
+  ObDatumRow *out_row = nullptr;
+  ASSERT_EQ(OB_SUCCESS, out_cols_project.push_back(0));
+  ASSERT_EQ(OB_SUCCESS, out_cols_project.push_back(1));
+  access_param.iter_param_.out_cols_project_ = &out_cols_project;
+  access_ctx.trans_version_range_.snapshot_version_ = now_us * 1000L;
+  ttl_param.col_idx_ = 2;
+  ttl_param.ttl_us_ = USECS_PER_DAY;
+  access_param.ttl_param_ = &ttl_param;
+  merge.access_param_ = &access_param;
+  merge.access_ctx_ = &access_ctx;
+  ASSERT_EQ(OB_SUCCESS, merge.cur_row_.init(allocator_, 2));
+  // the ttl column is read even if not in the output
+  ASSERT_EQ(OB_SUCCESS, in_row.init(allocator_, 3));
+  in_row.storage_datums_[0].set_int(1);
+  in_row.storage_datums_[1].set_int(100);
+
+  // expired at the read snapshot, masked even if major merge hasn't removed it
+  in_row.storage_datums_[2].set_timestamp(now_us - 2 * USECS_PER_DAY);
+  ASSERT_EQ(OB_SUCCESS, merge.process_fuse_row(true, in_row, out_row));
+  ASSERT_TRUE(nullptr == out_row);
+  ASSERT_EQ(0, access_ctx.out_cnt_);
+
+  in_row.storage_datums_[2].set_timestamp(now_us - USECS_PER_DAY + 1);
+  ASSERT_EQ(OB_SUCCESS, merge.process_fuse_row(true, in_row, out_row));
+  ASSERT_EQ(&merge.cur_row_, out_row);
+  ASSERT_EQ(1, access_ctx.out_cnt_);
+  ASSERT_EQ(2, out_row->count_);
+  ASSERT_EQ(100, out_row->storage_datums_[1].get_int());
+
+  // null ttl column never expires
+  in_row.storage_datums_[2].set_null();
+  ASSERT_EQ(OB_SUCCESS, merge.process_fuse_row(true, in_row, out_row));
+  ASSERT_EQ(&merge.cur_row_, out_row);
+  ASSERT_EQ(2, access_ctx.out_cnt_);
+
+  // an older snapshot still sees the row
+  in_row.storage_datums_[2].set_timestamp(now_us - 2 * USECS_PER_DAY);
+  access_ctx.trans_version_range_.snapshot_version_ = (now_us - USECS_PER_DAY - 1) * 1000L;
+  ASSERT_EQ(OB_SUCCESS, merge.process_fuse_row(true, in_row, out_row));
+  ASSERT_EQ(&merge.cur_row_, out_row);
+  ASSERT_EQ(3, access_ctx.out_cnt_);
+
+  // no ttl, nothing masked
+  access_ctx.trans_version_range_.snapshot_version_ = now_us * 1000L;
+  access_param.ttl_param_ = nullptr;
+  ASSERT_EQ(OB_SUCCESS, merge.process_fuse_row(true, in_row, out_row));
+  ASSERT_EQ(&merge.cur_row_, out_row);
+
+  // the ttl column is missing in the row
+  access_param.ttl_param_ = &ttl_param;
+  in_row.count_ = 2;
+  ASSERT_EQ(OB_ERR_UNEXPECTED, merge.process_fuse_row(true, in_row, out_row));
+  ASSERT_TRUE(nullptr == out_row);
+  merge.access_param_ = nullptr;
+  merge.access_ctx_ = nullptr;
+}
+
+}  // end namespace unittest
+}  // end namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  system("rm -f test_ttl_compaction_filter.log*");
+  OB_LOGGER.set_file_name("test_ttl_compaction_filter.log");
+  CLOG_LOG(INFO, "begin unittest: test_ttl_compaction_filter");
+  oceanbase::common::ObLogger::get_logger().set_log_level("INFO");
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}